@@ -30,12 +30,32 @@ uniform highp sampler2D shadowMaps[MAX_SHADOW_CASTERS];
 uniform mat4 lightVPs[MAX_SHADOW_CASTERS];
 uniform Light lights[MAX_LIGHTS];
 uniform int lightCounts;
+
+// 分簇光照, 与 LightClusterGrid.h / LightingManager.h 保持一致
+#define CLUSTER_DIM_X 16
+#define CLUSTER_DIM_Y 9
+#define CLUSTER_DIM_Z 24
+#define MAX_LIGHTS_PER_CLUSTER 64
+#define CLUSTER_TEX_WIDTH 1024
+#define CLUSTER_HEADER_BASE 1024
+#define CLUSTER_INDEX_BASE 4480
+
+uniform int useClusteredLights;
+uniform vec2 clusterParams; // near, 切片系数
+uniform highp sampler2D clusterData;
+uniform mat4 matView;
+uniform mat4 matProj;
 uniform vec3 emissiveColor;
 uniform float emissiveIntensity;
 
 uniform vec3 viewPos;
 uniform vec4 baseColor;
+#ifdef INSTANCING
+flat in vec4 fragInstanceColor;
+#define totalBaseColor fragInstanceColor
+#else
 uniform vec4 totalBaseColor;
+#endif
 
 uniform highp sampler2D u_diffuseMap;
 uniform int u_diffuseMap_frameCount;
@@ -180,6 +200,44 @@ vec3 CalcLight(Light light, vec3 normal, vec3 fragPos, vec3 viewDir, float shado
     vec3 radiance = light.color * light.intensity * attenuation;
     return (diff + spec) * radiance * (1.0f - shadow);
 }
+vec4 FetchClusterTexel(int index) {
+    return texelFetch(clusterData, ivec2(index % CLUSTER_TEX_WIDTH, index / CLUSTER_TEX_WIDTH), 0);
+}
+vec3 CalcClusteredLights(vec3 normal, vec3 fragPos, vec3 viewDir) {
+    vec4 viewP = matView * vec4(fragPos, 1.0f);
+    vec4 clipP = matProj * viewP;
+    vec2 ndc = clipP.xy / clipP.w;
+    float depth = max(-viewP.z, clusterParams.x);
+
+    int cx = clamp(int(floor((ndc.x * 0.5f + 0.5f) * float(CLUSTER_DIM_X))), 0, CLUSTER_DIM_X - 1);
+    int cy = clamp(int(floor((ndc.y * 0.5f + 0.5f) * float(CLUSTER_DIM_Y))), 0, CLUSTER_DIM_Y - 1);
+    int cz = clamp(int(floor(log(depth / clusterParams.x) * clusterParams.y)), 0, CLUSTER_DIM_Z - 1);
+    vec4 header = FetchClusterTexel(CLUSTER_HEADER_BASE + (cz * CLUSTER_DIM_Y + cy) * CLUSTER_DIM_X + cx);
+    int offset = int(header.x);
+    int count = int(header.y);
+
+    vec3 result = vec3(0.0f);
+    for(int i = 0; i < MAX_LIGHTS_PER_CLUSTER; i++) {
+        if(i >= count)
+            break;
+        int k = offset + i;
+        int lightIndex = int(FetchClusterTexel(CLUSTER_INDEX_BASE + k / 4)[k % 4]);
+        vec4 posRange = FetchClusterTexel(lightIndex * 2);
+        vec4 colorIntensity = FetchClusterTexel(lightIndex * 2 + 1);
+
+        Light light;
+        light.type = 1;
+        light.position = posRange.xyz;
+        light.direction = vec3(0.0f);
+        light.color = colorIntensity.rgb;
+        light.intensity = colorIntensity.a;
+        light.range = posRange.w;
+        light.shadowIndex = -1;
+        light.shadowBias = 0.0f;
+        result += CalcLight(light, normal, fragPos, viewDir, 0.0f);
+    }
+    return result;
+}
 void main() {
     vec3 norm = normalize(fragNormal);
     vec3 viewDir = normalize(viewPos - fragPosition);
@@ -206,6 +264,8 @@ void main() {
         totalLight += CalcLight(lights[i], norm, fragPosition, viewDir, shadow);
 
     }
+    if(useClusteredLights == 1)
+        totalLight += CalcClusteredLights(norm, fragPosition, viewDir);
 
     float currentFrame = floor(mod(gameTime * u_diffuseMap_animSpeed, float(u_diffuseMap_frameCount)));
     vec2 animatedUV = fragTexCoord;
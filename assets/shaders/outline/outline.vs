@@ -3,10 +3,21 @@ precision highp float;
 in vec3 vertexPosition;
 in vec3 vertexNormal;
 
+#ifdef INSTANCING
+layout(location = 8) in mat4 instanceTransform;
+layout(location = 12) in vec4 instanceColor;
+uniform mat4 u_vp;
+flat out vec4 fragInstanceColor;
+#else
 uniform mat4 u_mvp;
+#endif
 uniform float u_outlineWidth;
 uniform float realTime;
 void main() {
+#ifdef INSTANCING
+    mat4 u_mvp = u_vp * instanceTransform;
+    fragInstanceColor = instanceColor;
+#endif
     vec3 normal = normalize(vertexPosition);
     vec3 offsetPos = vertexPosition + normal * u_outlineWidth * (sin(realTime * 2.0f) + 1.0f);
     gl_Position = u_mvp * vec4(offsetPos, 1.0f);
@@ -7,7 +7,12 @@ uniform highp sampler2D u_diffuseMap;
 uniform int u_diffuseMap_frameCount;
 uniform float u_diffuseMap_animSpeed;
 uniform vec4 baseColor;
+#ifdef INSTANCING
+flat in vec4 fragInstanceColor;
+#define totalBaseColor fragInstanceColor
+#else
 uniform vec4 totalBaseColor;
+#endif
 uniform float gameTime;
 uniform float realTime;
 
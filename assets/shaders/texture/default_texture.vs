@@ -4,14 +4,27 @@ in vec3 vertexPosition;
 in vec2 vertexTexCoord;
 in vec3 vertexNormal;
 
+#ifdef INSTANCING
+// 实例化变体: 模型矩阵与整体颜色来自每实例属性
+layout(location = 8) in mat4 instanceTransform;
+layout(location = 12) in vec4 instanceColor;
+uniform mat4 u_vp;
+flat out vec4 fragInstanceColor;
+#else
 uniform mat4 u_mvp;
 uniform mat4 transform;
+#endif
 
 out vec3 fragPosition;
 out vec2 fragTexCoord;
 out vec3 fragNormal;
 
 void main() {
+#ifdef INSTANCING
+    mat4 transform = instanceTransform;
+    mat4 u_mvp = u_vp * instanceTransform;
+    fragInstanceColor = instanceColor;
+#endif
     fragPosition = vec3(transform * vec4(vertexPosition, 1.0f));
     fragTexCoord = vertexTexCoord;
     fragNormal = normalize(vec3(transform * vec4(vertexNormal, 0.0f)));
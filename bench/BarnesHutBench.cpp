@@ -0,0 +1,162 @@
+// Barnes-Hut 引力基准: GravityOctree 与逐对精确求和对比
+// 两种分布, 质量 1 ~ 10:
+//   - 均匀: 刚体随机分布在半径 100 的球内
+//   - 成团: 32 个半径约 3 的星团散布在同一球内, 节点质心常偏在一角
+// 对每个规模与 theta:
+//   - 建树耗时, 每个刚体 ComputeForce 的平均耗时与参与计算的质点/节点数
+//   - 随机抽取 256 个刚体与精确合力比较, 统计相对误差的均值与最大值
+// 精确求和的每刚体耗时同样在抽样刚体上计时.
+// 另有一组偏心布局: 原点 1 个刚体, 对角 (1, 1, 1) 附近 4 个, 根节点质心偏向对角,
+// theta = 1 时开角判断会接受包含原点刚体的根节点, 用来确认自身质量不会被并入合力.
+#include "Game/Systems/Physics/GravityOctree.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    constexpr float kG = 1.0f;
+    constexpr size_t kSamples = 256;
+    constexpr int kClusters = 32;
+
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedNs(Clock::time_point since)
+    {
+        return std::chrono::duration<double, std::nano>(Clock::now() - since).count();
+    }
+
+    Vector3f RandomInBall(std::mt19937 &rng, float radius)
+    {
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        while (true)
+        {
+            const Vector3f p(unit(rng), unit(rng), unit(rng));
+            if (p.LengthSquared() <= 1.0f)
+                return p * radius;
+        }
+    }
+
+    void MakeBodies(size_t count, bool clustered, std::mt19937 &rng, std::vector<Vector3f> &positions,
+                    std::vector<float> &masses)
+    {
+        std::uniform_real_distribution<float> massDist(1.0f, 10.0f);
+        std::vector<Vector3f> centers;
+        for (int c = 0; c < kClusters; c++)
+            centers.push_back(RandomInBall(rng, 100.0f));
+        for (size_t i = 0; i < count; i++)
+        {
+            if (clustered)
+                positions.push_back(centers[i % kClusters] + RandomInBall(rng, 3.0f));
+            else
+                positions.push_back(RandomInBall(rng, 100.0f));
+            masses.push_back(massDist(rng));
+        }
+    }
+
+    // 与 SolarStage 精确模式相同的逐对求和
+    Vector3f ExactForce(size_t body, const std::vector<Vector3f> &positions, const std::vector<float> &masses)
+    {
+        Vector3f force = Vector3f::ZERO;
+        for (size_t other = 0; other < positions.size(); other++)
+        {
+            if (other == body)
+                continue;
+            auto distance = Vector3f::Distance(positions[body], positions[other]);
+            if (distance <= 1e-5f)
+                continue;
+            auto f = kG * masses[body] * masses[other] / (distance * distance);
+            force += (positions[other] - positions[body]).Normalized() * f;
+        }
+        return force;
+    }
+
+    // 返回 0 表示偏心布局中原点刚体的受力与精确值一致
+    int RunOffCenter()
+    {
+        std::vector<Vector3f> positions = {Vector3f(0.0f, 0.0f, 0.0f)};
+        for (int i = 0; i < 4; i++)
+            positions.push_back(Vector3f(1.0f - 0.01f * (i & 1), 1.0f - 0.01f * (i >> 1), 1.0f));
+        const std::vector<float> masses(positions.size(), 1.0f);
+        GravityOctree octree;
+        octree.Build(positions, masses);
+        size_t unused = 0;
+        const Vector3f exact = ExactForce(0, positions, masses);
+        const Vector3f approx = octree.ComputeForce(0, kG, 1.0f, unused);
+        const double error = (approx - exact).Length() / exact.Length();
+        std::printf("[BarnesHutBench] off-center root (1 + 4 bodies) theta=1.0: rel. error %.3f%%\n", 100.0 * error);
+        return error > 1e-4 ? 1 : 0;
+    }
+
+    // 返回平均相对误差超过 5% 的 theta 个数
+    int RunCase(size_t bodyCount, bool clustered)
+    {
+        std::mt19937 rng(11);
+        std::vector<Vector3f> positions;
+        std::vector<float> masses;
+        MakeBodies(bodyCount, clustered, rng, positions, masses);
+
+        std::vector<size_t> samples(kSamples);
+        std::uniform_int_distribution<size_t> pick(0, bodyCount - 1);
+        for (size_t &s : samples)
+            s = pick(rng);
+
+        std::vector<Vector3f> exact(kSamples);
+        auto start = Clock::now();
+        for (size_t s = 0; s < kSamples; s++)
+            exact[s] = ExactForce(samples[s], positions, masses);
+        const double exactNs = ElapsedNs(start) / kSamples;
+        std::printf("[BarnesHutBench] %s bodies=%5zu exact pairwise: %9.1f ns/body\n",
+                    clustered ? "clustered" : "uniform  ", bodyCount, exactNs);
+
+        int failures = 0;
+        GravityOctree octree;
+        for (float theta : {0.3f, 0.5f, 0.7f, 1.0f})
+        {
+            start = Clock::now();
+            octree.Build(positions, masses);
+            const double buildUs = ElapsedNs(start) / 1000.0;
+
+            size_t interactions = 0;
+            start = Clock::now();
+            for (size_t body = 0; body < bodyCount; body++)
+                octree.ComputeForce(body, kG, theta, interactions);
+            const double treeNs = ElapsedNs(start) / bodyCount;
+
+            double sumError = 0.0, maxError = 0.0;
+            size_t unused = 0;
+            for (size_t s = 0; s < kSamples; s++)
+            {
+                const Vector3f approx = octree.ComputeForce(samples[s], kG, theta, unused);
+                const double error = (approx - exact[s]).Length() / std::max(exact[s].Length(), 1e-12f);
+                sumError += error;
+                maxError = std::max(maxError, error);
+            }
+            const double meanError = sumError / kSamples;
+
+            std::printf("[BarnesHutBench]   theta=%.1f build %7.1f us | %8.1f ns/body (x%5.1f) | "
+                        "interactions/body %6.1f | rel. error mean %.3f%% max %.3f%%\n",
+                        theta, buildUs, treeNs, exactNs / treeNs, double(interactions) / bodyCount,
+                        100.0 * meanError, 100.0 * maxError);
+            if (meanError > 0.05)
+                failures++;
+        }
+        return failures;
+    }
+}
+
+int main()
+{
+    int failures = RunOffCenter();
+    for (bool clustered : {false, true})
+    {
+        for (size_t bodyCount : {1000, 5000, 20000})
+            failures += RunCase(bodyCount, clustered);
+    }
+    if (failures != 0)
+        std::printf("[BarnesHutBench] FAILED: %d runs exceed their force error bound\n", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,120 @@
+// 碰撞粗测基准: SweepAndPrune 与原先的两两 AABB 循环对比
+// 100 到 10000 个单位方块以恒定密度随机分布, 每帧做小幅抖动(模拟帧间相干的运动),
+// 分别计时两种粗测每帧的耗时, 并核对两者输出的候选对数量一致.
+#include "Engine/Core/GameWorld.h"
+#include "Engine/Core/Components/Components.h"
+#include "Engine/System/Physics/BroadPhase/SweepAndPrune.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    // CollisionStage 改用 SAP 之前的粗测: 所有激活对象两两检查组件与世界包围盒
+    size_t PairLoop(const std::vector<GameObject *> &gameObjects)
+    {
+        size_t pairs = 0;
+        for (size_t i = 0; i < gameObjects.size(); i++)
+        {
+            GameObject *go1 = gameObjects[i];
+            if (!go1->HasComponent<RigidbodyComponent>() || !go1->HasComponent<TransformComponent>())
+                continue;
+            if (!go1->GetComponent<RigidbodyComponent>().Collidable)
+                continue;
+            for (size_t j = i + 1; j < gameObjects.size(); j++)
+            {
+                GameObject *go2 = gameObjects[j];
+                if (!go2->HasComponent<RigidbodyComponent>() || !go2->HasComponent<TransformComponent>())
+                    continue;
+                if (!go2->GetComponent<RigidbodyComponent>().Collidable)
+                    continue;
+                if (AABB::IsCollide(go1->GetWorldAABB(), go2->GetWorldAABB()))
+                    pairs++;
+            }
+        }
+        return pairs;
+    }
+
+    template <typename Fn>
+    double ElapsedUs(const Fn &fn)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+int main()
+{
+    int failures = 0;
+    for (int bodyCount : {100, 500, 1000, 2500, 5000, 10000})
+    {
+        GameWorld world(HeadlessWorld{}, [](ScriptingFactory &, PhysicsStageFactory &, ParticleFactory &) {}, "");
+        std::mt19937 rng(11);
+        // 每个方块平均占 3x3x3 的空间, 数量增加时场景按体积放大
+        const float extent = 3.0f * std::cbrt((float)bodyCount);
+        std::uniform_real_distribution<float> place(0.0f, extent);
+        std::uniform_real_distribution<float> jitter(-0.05f, 0.05f);
+
+        std::vector<TransformComponent *> transforms;
+        for (int i = 0; i < bodyCount; i++)
+        {
+            GameObject &object = world.CreateGameObject();
+            auto &tf = object.AddComponent<TransformComponent>();
+            tf.SetLocalPosition(Vector3f(place(rng), place(rng), place(rng)));
+            auto &rb = object.AddComponent<RigidbodyComponent>();
+            rb.colliderType = ColliderType::BOX;
+            rb.SetHitbox(Vector3f(1.0f, 1.0f, 1.0f));
+            object.SetActive(true);
+            transforms.push_back(&tf);
+        }
+        world.SyncActiveEntities();
+        world.UpdateTransforms();
+        const std::vector<GameObject *> &objects = world.GetActivateGameObjects();
+
+        auto move = [&]()
+        {
+            for (auto *tf : transforms)
+                tf->SetLocalPosition(tf->GetLocalPosition() + Vector3f(jitter(rng), jitter(rng), jitter(rng)));
+            world.UpdateTransforms();
+        };
+
+        SweepAndPrune sap;
+        sap.Update(objects);
+        sap.ComputePairs();
+
+        // 两两循环为 O(n^2), 帧数随规模减少, 保证总耗时可控
+        const int sapFrames = 200;
+        const int loopFrames = std::clamp(50000000 / (bodyCount * bodyCount), 1, 200);
+        size_t sapPairs = 0, loopPairs = 0;
+        double sapUs = 0.0, loopUs = 0.0;
+        for (int f = 0; f < sapFrames; f++)
+        {
+            move();
+            sapUs += ElapsedUs([&]
+                               {
+                                   sap.Update(objects);
+                                   sapPairs = sap.ComputePairs().size();
+                               });
+            if (f < loopFrames)
+            {
+                loopUs += ElapsedUs([&]
+                                    { loopPairs = PairLoop(objects); });
+                if (loopPairs != sapPairs)
+                    failures++;
+            }
+        }
+        sapUs /= sapFrames;
+        loopUs /= loopFrames;
+
+        std::printf("[BroadPhaseBench] bodies=%5d pairs=%5zu | pair loop %10.1f us/frame | SAP %7.1f us/frame "
+                    "(swaps/frame=%zu) | speedup x%.1f\n",
+                    bodyCount, sapPairs, loopUs, sapUs, sap.GetStats().sortSwaps, loopUs / sapUs);
+    }
+    if (failures != 0)
+        std::printf("[BroadPhaseBench] FAILED: candidate pair counts differ on %d frames\n", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,176 @@
+// 变换层级基准: 10000 个节点, 分两种布局
+//   - 1000 棵树, 每棵 1 根 + 3 子 + 6 孙 (挂载子物体的对象)
+//   - 10000 个根节点 (物理刚体通常没有父节点)
+// 每帧根节点按 RotatorScript 的方式 "读世界 TRS -> 旋转 -> 写回", 再 UpdateTransforms,
+// 然后两个读者 (如渲染与物理) 各读一遍所有节点的世界旋转与缩放. 分别走
+//   1. 原路径: 读取时从 worldMatrix 分解, 写回用 SetWorldMatrix(CreateTransform(...)) 再分解出局部 TRS
+//   2. 现路径: GetWorldRotation/GetWorldScale 读缓存, 写回用 SetWorldTRS
+// 两个世界各自推进, 结束时核对所有节点的世界位置一致.
+#include "Engine/Core/GameWorld.h"
+#include "Engine/Core/Components/Components.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+    constexpr int kFrames = 200;
+    constexpr int kReaders = 2;
+
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedUs(Clock::time_point since)
+    {
+        return std::chrono::duration<double, std::micro>(Clock::now() - since).count();
+    }
+
+    struct Scene
+    {
+        std::vector<TransformComponent *> roots;
+        std::vector<TransformComponent *> nodes;
+    };
+
+    struct Layout
+    {
+        const char *name;
+        int trees;
+        int children;
+        int grandChildren;
+    };
+
+    void Build(GameWorld &world, const Layout &layout, Scene &scene)
+    {
+        auto create = [&](GameObject *parent, const Vector3f &pos) -> GameObject &
+        {
+            GameObject &object = world.CreateGameObject();
+            auto &tf = object.AddComponent<TransformComponent>();
+            tf.SetLocalPosition(pos);
+            tf.SetLocalScale(Vector3f(1.5f, 1.5f, 1.5f));
+            if (parent)
+                tf.SetParent(parent);
+            object.SetActive(true);
+            scene.nodes.push_back(&tf);
+            return object;
+        };
+        for (int t = 0; t < layout.trees; t++)
+        {
+            GameObject &root = create(nullptr, Vector3f(4.0f * (t % 100), 0.0f, 4.0f * (t / 100)));
+            scene.roots.push_back(&root.GetComponent<TransformComponent>());
+            for (int c = 0; c < layout.children; c++)
+            {
+                GameObject &child = create(&root, Vector3f(1.0f + c, 0.5f, 0.0f));
+                for (int g = 0; g < layout.grandChildren; g++)
+                    create(&child, Vector3f(0.0f, 0.5f, 0.5f + g));
+            }
+        }
+        world.SyncActiveEntities();
+        world.UpdateTransforms();
+    }
+
+    struct Timings
+    {
+        double writeUs = 0.0;
+        double updateUs = 0.0;
+        double readUs = 0.0;
+    };
+
+    // legacy = true 时按 TransformComponent 缓存世界 TRS 之前的做法读写
+    template <bool legacy>
+    Timings Run(GameWorld &world, Scene &scene)
+    {
+        const Quat4f step(Vector3f(0.0f, 0.02f, 0.01f));
+        Timings timings;
+        float sink = 0.0f;
+        for (int frame = 0; frame < kFrames; frame++)
+        {
+            auto start = Clock::now();
+            for (TransformComponent *tf : scene.roots)
+            {
+                const Vector3f pos = tf->GetWorldPosition();
+                if constexpr (legacy)
+                {
+                    const Matrix4f worldMatrix = tf->GetWorldMatrix();
+                    const Quat4f rot = worldMatrix.getRotation() * step;
+                    tf->SetWorldMatrix(Matrix4f::CreateTransform(pos, rot, worldMatrix.getScale()));
+                }
+                else
+                {
+                    tf->SetWorldTRS(pos, tf->GetWorldRotation() * step, tf->GetWorldScale());
+                }
+            }
+            timings.writeUs += ElapsedUs(start);
+
+            start = Clock::now();
+            world.UpdateTransforms();
+            timings.updateUs += ElapsedUs(start);
+
+            start = Clock::now();
+            for (int reader = 0; reader < kReaders; reader++)
+            {
+                for (TransformComponent *tf : scene.nodes)
+                {
+                    if constexpr (legacy)
+                    {
+                        const Matrix4f worldMatrix = tf->GetWorldMatrix();
+                        sink += worldMatrix.getRotation().w() + worldMatrix.getScale().x();
+                    }
+                    else
+                    {
+                        sink += tf->GetWorldRotation().w() + tf->GetWorldScale().x();
+                    }
+                }
+            }
+            timings.readUs += ElapsedUs(start);
+        }
+        if (sink == 0.0f)
+            std::printf("[HierarchyBench] (sink)\n");
+        timings.writeUs /= kFrames;
+        timings.updateUs /= kFrames;
+        timings.readUs /= kFrames;
+        return timings;
+    }
+
+    void Report(const char *name, const Timings &t)
+    {
+        std::printf("[HierarchyBench]   %-27s write %8.1f us | UpdateTransforms %8.1f us | reads %8.1f us | "
+                    "total %8.1f us/frame\n",
+                    name, t.writeUs, t.updateUs, t.readUs, t.writeUs + t.updateUs + t.readUs);
+    }
+}
+
+int main()
+{
+    int failures = 0;
+    for (const Layout &layout : {Layout{"1000 trees x 10 nodes", 1000, 3, 2}, Layout{"10000 roots", 10000, 0, 0}})
+    {
+        GameWorld legacyWorld(HeadlessWorld{}, [](ScriptingFactory &, PhysicsStageFactory &, ParticleFactory &) {}, "");
+        GameWorld cachedWorld(HeadlessWorld{}, [](ScriptingFactory &, PhysicsStageFactory &, ParticleFactory &) {}, "");
+        Scene legacyScene, cachedScene;
+        Build(legacyWorld, layout, legacyScene);
+        Build(cachedWorld, layout, cachedScene);
+
+        const Timings legacy = Run<true>(legacyWorld, legacyScene);
+        const Timings cached = Run<false>(cachedWorld, cachedScene);
+
+        float maxError = 0.0f;
+        for (size_t i = 0; i < legacyScene.nodes.size(); i++)
+        {
+            const Vector3f d = legacyScene.nodes[i]->GetWorldPosition() - cachedScene.nodes[i]->GetWorldPosition();
+            maxError = std::max(maxError, d.Length());
+        }
+
+        std::printf("[HierarchyBench] %s: %zu nodes, %zu roots rotated per frame, %d frames, %d readers of world "
+                    "rotation/scale\n",
+                    layout.name, cachedScene.nodes.size(), cachedScene.roots.size(), kFrames, kReaders);
+        Report("decompose + SetWorldMatrix", legacy);
+        Report("cached TRS + SetWorldTRS", cached);
+        std::printf("[HierarchyBench]   max world position difference after %d frames: %.6f\n", kFrames, maxError);
+        if (maxError > 1e-3f)
+        {
+            std::printf("[HierarchyBench] FAILED: the two paths diverged\n");
+            failures++;
+        }
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,147 @@
+// CPU 分簇 (LightClusterGrid::Build) 基准:
+// 随机点光源分布在视锥内 20 ~ 150 m 深处 (NDC 略超出屏幕边缘), 分别计时 16/128/512 个光源的构建耗时,
+// 并在同一深度范围内随机采样, 核对 "照到该点的光源一定出现在其簇列表中".
+#include "Engine/Graphics/Lighting/LightClusterGrid.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+namespace
+{
+    // 光源所在的视空间深度范围, 采样覆盖 [near, kLightFar]
+    constexpr float kLightNear = 20.0f;
+    constexpr float kLightFar = 150.0f;
+
+    // 列向量约定的透视矩阵 (与 rlgl 的 MatrixPerspective 一致)
+    Matrix4f Perspective(float fovy, float aspect, float nearPlane, float farPlane)
+    {
+        Matrix4f m(0.0f);
+        const float t = 1.0f / std::tan(fovy * 0.5f);
+        m(0, 0) = t / aspect;
+        m(1, 1) = t;
+        m(2, 2) = -(farPlane + nearPlane) / (farPlane - nearPlane);
+        m(2, 3) = -2.0f * farPlane * nearPlane / (farPlane - nearPlane);
+        m(3, 2) = -1.0f;
+        return m;
+    }
+
+    // 相机位于 eye, 绕 y 轴偏航 yaw 后看向 -z: view = R^T * (p - eye)
+    Matrix4f View(float yaw, const Vector3f &eye)
+    {
+        Matrix4f m(0.0f);
+        const float c = std::cos(yaw), s = std::sin(yaw);
+        m(0, 0) = c;
+        m(0, 2) = -s;
+        m(1, 1) = 1.0f;
+        m(2, 0) = s;
+        m(2, 2) = c;
+        m(3, 3) = 1.0f;
+        m(0, 3) = -(c * eye.x() - s * eye.z());
+        m(1, 3) = -eye.y();
+        m(2, 3) = -(s * eye.x() + c * eye.z());
+        return m;
+    }
+
+    // NDC xy + 视空间深度 -> 世界空间 (view 为正交旋转 + 平移)
+    Vector3f Unproject(const Matrix4f &view, const Matrix4f &proj, float nx, float ny, float depth)
+    {
+        const float v[3] = {nx * depth / proj(0, 0) - view(0, 3),
+                            ny * depth / proj(1, 1) - view(1, 3),
+                            -depth - view(2, 3)};
+        return Vector3f(view(0, 0) * v[0] + view(1, 0) * v[1] + view(2, 0) * v[2],
+                        view(0, 1) * v[0] + view(1, 1) * v[1] + view(2, 1) * v[2],
+                        view(0, 2) * v[0] + view(1, 2) * v[1] + view(2, 2) * v[2]);
+    }
+
+    bool ClusterContains(const LightClusterGrid &grid, int cluster, uint32_t light)
+    {
+        const uint32_t offset = grid.GetOffsets()[cluster];
+        const uint32_t count = grid.GetCounts()[cluster];
+        for (uint32_t k = 0; k < count; k++)
+            if (grid.GetIndices()[offset + k] == light)
+                return true;
+        return false;
+    }
+
+    // 在视锥 [near, kLightFar] 内按对数深度随机采样, 返回 (被照到的采样数, 漏分配数)
+    void Validate(const LightClusterGrid &grid, const std::vector<ClusterLight> &lights, const Matrix4f &view,
+                  const Matrix4f &proj, float nearPlane, std::mt19937 &rng, int &outLit, int &outMissing)
+    {
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        outLit = 0;
+        outMissing = 0;
+        for (int sample = 0; sample < 200000; sample++)
+        {
+            const float nx = unit(rng), ny = unit(rng);
+            const float depth = nearPlane * std::pow(kLightFar / nearPlane, (unit(rng) + 1.0f) * 0.5f);
+            const Vector3f world = Unproject(view, proj, nx, ny, depth);
+
+            const int cx = std::clamp((int)std::floor((nx * 0.5f + 0.5f) * CLUSTER_DIM_X), 0, CLUSTER_DIM_X - 1);
+            const int cy = std::clamp((int)std::floor((ny * 0.5f + 0.5f) * CLUSTER_DIM_Y), 0, CLUSTER_DIM_Y - 1);
+            const int cz = std::clamp((int)std::floor(std::log(std::max(depth, nearPlane) / nearPlane) *
+                                                      grid.GetSliceScale()),
+                                      0, CLUSTER_DIM_Z - 1);
+            const int cluster = LightClusterGrid::ClusterIndex(cx, cy, cz);
+
+            for (uint32_t i = 0; i < (uint32_t)lights.size(); i++)
+            {
+                const ClusterLight &light = lights[i];
+                const float dx = world.x() - light.position.x();
+                const float dy = world.y() - light.position.y();
+                const float dz = world.z() - light.position.z();
+                if (dx * dx + dy * dy + dz * dz > light.range * light.range)
+                    continue;
+                outLit++;
+                if (!ClusterContains(grid, cluster, i))
+                    outMissing++;
+            }
+        }
+    }
+}
+
+int main()
+{
+    const float nearPlane = 0.1f;
+    const float farPlane = 1000.0f;
+    const Matrix4f proj = Perspective(75.0f * 3.14159265f / 180.0f, 16.0f / 9.0f, nearPlane, farPlane);
+    const Matrix4f view = View(0.4f, Vector3f(3.0f, 2.0f, -5.0f));
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    LightClusterGrid grid;
+    int failures = 0;
+
+    for (int lightCount : {16, 128, MAX_CLUSTERED_LIGHTS})
+    {
+        std::vector<ClusterLight> lights(lightCount);
+        for (ClusterLight &light : lights)
+        {
+            const float depth = kLightNear + (unit(rng) + 1.0f) * 0.5f * (kLightFar - kLightNear);
+            light.position = Unproject(view, proj, unit(rng) * 1.2f, unit(rng) * 1.2f, depth);
+            light.range = 4.0f + (unit(rng) + 1.0f) * 8.0f;
+            light.color = Vector3f(1.0f, 1.0f, 1.0f);
+            light.intensity = 1.0f;
+        }
+
+        grid.Build(lights, view, proj, nearPlane, farPlane);
+        int lit = 0, missing = 0;
+        Validate(grid, lights, view, proj, nearPlane, rng, lit, missing);
+        failures += missing;
+
+        const int iterations = 2000;
+        const auto start = std::chrono::steady_clock::now();
+        for (int it = 0; it < iterations; it++)
+            grid.Build(lights, view, proj, nearPlane, farPlane);
+        const double us =
+            std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / iterations;
+
+        const LightClusterGrid::Stats &stats = grid.GetStats();
+        std::printf("[LightClusterBench] lights=%3d build=%.1f us visible=%u occupied=%u/%d indices=%u "
+                    "max/cluster=%u dropped=%u | lit samples=%d missing=%d\n",
+                    lightCount, us, stats.visibleLights, stats.occupiedClusters, CLUSTER_COUNT, stats.indices,
+                    stats.maxPerCluster, stats.dropped, lit, missing);
+    }
+    return failures == 0 ? 0 : 1;
+}
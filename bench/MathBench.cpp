@@ -0,0 +1,73 @@
+// 数学热点微基准: 原标量实现 (tests/MathBaseline.h) 与现内联 + SIMD 实现对比
+// 对 4096 组随机输入循环若干轮, 分别计时 4x4 乘法、4x4 乘向量、四元数乘法与 CreateTransform,
+// 输出每次调用的纳秒数.
+#include "MathBaseline.h"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    constexpr int kInputs = 4096;
+    constexpr int kRounds = 500;
+
+    // 完整结果写入全局数组, 防止只计算被读取的分量
+    std::vector<Matrix4f> g_matrixOut(kInputs);
+    std::vector<Vector4f> g_vectorOut(kInputs);
+    std::vector<Quat4f> g_quatOut(kInputs);
+
+    template <typename Fn>
+    double NsPerCall(const Fn &fn)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (int round = 0; round < kRounds; round++)
+            for (int i = 0; i < kInputs; i++)
+                fn(i);
+        const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        return ns / (double(kRounds) * kInputs);
+    }
+
+    void Report(const char *name, double baselineNs, double currentNs)
+    {
+        std::printf("[MathBench] %-16s scalar %6.2f ns | inline + SIMD %6.2f ns | speedup x%.2f\n", name, baselineNs,
+                    currentNs, baselineNs / currentNs);
+    }
+}
+
+int main()
+{
+    std::mt19937 rng(6);
+    std::uniform_real_distribution<float> value(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> positive(0.1f, 10.0f);
+
+    std::vector<Matrix4f> matrices(kInputs);
+    std::vector<Vector4f> vectors(kInputs);
+    std::vector<Quat4f> quats(kInputs);
+    std::vector<Vector3f> positions(kInputs), scales(kInputs);
+    for (int i = 0; i < kInputs; i++)
+    {
+        quats[i] = Quat4f(unit(rng), unit(rng), unit(rng), unit(rng));
+        positions[i] = Vector3f(value(rng), value(rng), value(rng));
+        scales[i] = Vector3f(positive(rng), positive(rng), positive(rng));
+        matrices[i] = MathBaseline::CreateTransform(positions[i], quats[i], scales[i]);
+        vectors[i] = Vector4f(value(rng), value(rng), value(rng), 1.0f);
+    }
+    auto next = [](int i) { return (i + 1) & (kInputs - 1); };
+
+    Report("mat4 * mat4",
+           NsPerCall([&](int i) { g_matrixOut[i] = MathBaseline::Mul(matrices[i], matrices[next(i)]); }),
+           NsPerCall([&](int i) { g_matrixOut[i] = matrices[i] * matrices[next(i)]; }));
+    Report("mat4 * vec4",
+           NsPerCall([&](int i) { g_vectorOut[i] = MathBaseline::Mul(matrices[i], vectors[i]); }),
+           NsPerCall([&](int i) { g_vectorOut[i] = matrices[i] * vectors[i]; }));
+    Report("quat * quat",
+           NsPerCall([&](int i) { g_quatOut[i] = MathBaseline::Mul(quats[i], quats[next(i)]); }),
+           NsPerCall([&](int i) { g_quatOut[i] = quats[i] * quats[next(i)]; }));
+    Report("CreateTransform",
+           NsPerCall([&](int i) { g_matrixOut[i] = MathBaseline::CreateTransform(positions[i], quats[i], scales[i]); }),
+           NsPerCall([&](int i) { g_matrixOut[i] = Matrix4f::CreateTransform(positions[i], quats[i], scales[i]); }));
+
+    return 0;
+}
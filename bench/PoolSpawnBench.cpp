@@ -0,0 +1,193 @@
+// 对象池生成基准: 场景里已有 5000 个激活刚体, 经 GameObjectPool::Spawn 一次生成 5000 发子弹,
+// 之后 60 个 tick 每 tick 回收最老的 500 发并重新生成 500 发, 其中 50 发在同一 tick 内命中回收.
+// 分别计时 Spawn/Recycle 与 SyncActiveEntities, 并把同一串激活变化交给原先的同步方式
+// (std::queue + 对激活列表 std::find) 计时对比; 每个 tick 核对两者得到的激活集合一致.
+#include "Engine/Core/GameWorld.h"
+#include "Engine/Core/Components/Components.h"
+#include "Engine/Core/GameObject/GameObjectPool.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <queue>
+#include <vector>
+
+namespace
+{
+    constexpr int kBackground = 5000;
+    constexpr int kBurst = 5000;
+    constexpr int kChurnTicks = 60;
+    constexpr int kChurnPerTick = 500;
+    constexpr int kHitsPerTick = 50;
+
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedUs(Clock::time_point since)
+    {
+        return std::chrono::duration<double, std::micro>(Clock::now() - since).count();
+    }
+
+    // 只含 Transform 与刚体的子弹预制体; 渲染与脚本组件在无窗口世界里不可用
+    const char *kBulletPrefab = R"({
+    "components": [
+        { "TransformComponent": { "position": [0, 0, 0], "scale": [0.5, 0.5, 1.5], "rotation": [0, 0, 0] } },
+        { "RigidBodyComponent": { "mass": 2.0, "elasticity": 0.9, "isCollidable": true, "colliderType": "BOX" } }
+    ]
+})";
+
+    // SyncActiveEntities 改为下标 + swap-and-pop 之前的做法
+    class LegacyActiveSet
+    {
+    public:
+        struct Change
+        {
+            GameObject *obj;
+            bool newState;
+        };
+
+        void Notify(GameObject *obj, bool active) { m_changes.push({obj, active}); }
+        void Sync()
+        {
+            while (!m_changes.empty())
+            {
+                Change change = m_changes.front();
+                m_changes.pop();
+                auto it = std::find(m_active.begin(), m_active.end(), change.obj);
+                const bool currentlyInList = it != m_active.end();
+                if (change.newState && !currentlyInList)
+                {
+                    m_active.push_back(change.obj);
+                }
+                else if (!change.newState && currentlyInList)
+                {
+                    *it = m_active.back();
+                    m_active.pop_back();
+                }
+            }
+        }
+        std::vector<GameObject *> &GetActive() { return m_active; }
+
+    private:
+        std::queue<Change> m_changes;
+        std::vector<GameObject *> m_active;
+    };
+
+    bool SameSet(std::vector<GameObject *> a, std::vector<GameObject *> b)
+    {
+        std::sort(a.begin(), a.end());
+        std::sort(b.begin(), b.end());
+        return a == b;
+    }
+
+    struct PhaseTimings
+    {
+        double spawnUs = 0.0;
+        double syncUs = 0.0;
+        double legacySyncUs = 0.0;
+    };
+
+    void Report(const char *name, const PhaseTimings &t, int ticks)
+    {
+        std::printf("[PoolSpawnBench]   %-34s Spawn/Recycle %9.1f us | SyncActiveEntities %8.1f us | "
+                    "std::find sync %10.1f us | sync speedup x%.1f\n",
+                    name, t.spawnUs / ticks, t.syncUs / ticks, t.legacySyncUs / ticks, t.legacySyncUs / t.syncUs);
+    }
+}
+
+int main()
+{
+    const std::filesystem::path prefabPath = std::filesystem::temp_directory_path() / "nw_pool_bench_bullet.json";
+    {
+        std::ofstream prefab(prefabPath);
+        prefab << kBulletPrefab;
+    }
+
+    GameWorld world(HeadlessWorld{}, [](ScriptingFactory &, PhysicsStageFactory &, ParticleFactory &) {}, "");
+    LegacyActiveSet legacy;
+
+    for (int i = 0; i < kBackground; i++)
+    {
+        GameObject &object = world.CreateGameObject();
+        object.AddComponent<TransformComponent>().SetLocalPosition(Vector3f((float)i, 0.0f, 0.0f));
+        object.AddComponent<RigidbodyComponent>();
+        object.SetActive(true);
+        legacy.Notify(&object, true);
+    }
+    world.SyncActiveEntities();
+    legacy.Sync();
+
+    GameObjectPool &pool = world.GetOrCreatePool("bullet", "bullet", prefabPath.string());
+    std::deque<GameObject *> live;
+    int failures = 0;
+    auto spawn = [&](int i)
+    {
+        GameObject *bullet = pool.Spawn("bullet", "bullet", Vector3f(0.1f * i, 1.0f, 0.0f), Quat4f::IDENTITY);
+        legacy.Notify(bullet, true);
+        return bullet;
+    };
+    auto recycle = [&](GameObject *bullet)
+    {
+        pool.Recycle(bullet);
+        legacy.Notify(bullet, false);
+    };
+    auto sync = [&](PhaseTimings &t)
+    {
+        auto start = Clock::now();
+        world.SyncActiveEntities();
+        t.syncUs += ElapsedUs(start);
+        start = Clock::now();
+        legacy.Sync();
+        t.legacySyncUs += ElapsedUs(start);
+        if (!SameSet(world.GetActivateGameObjects(), legacy.GetActive()))
+            failures++;
+    };
+
+    // 1. 一次生成 5000 发: 池为空, 每发都从预制体创建
+    PhaseTimings burst;
+    auto start = Clock::now();
+    for (int i = 0; i < kBurst; i++)
+        live.push_back(spawn(i));
+    burst.spawnUs += ElapsedUs(start);
+    sync(burst);
+
+    // 2. 持续回收/复用: 每 tick 回收最老的 500 发, 再从池中取 500 发, 其中 50 发当 tick 即命中回收
+    PhaseTimings churn;
+    const size_t queuedBefore = world.GetActiveSetStats().changesQueued;
+    const size_t coalescedBefore = world.GetActiveSetStats().changesCoalesced;
+    for (int tick = 0; tick < kChurnTicks; tick++)
+    {
+        start = Clock::now();
+        for (int i = 0; i < kChurnPerTick; i++)
+        {
+            recycle(live.front());
+            live.pop_front();
+        }
+        for (int i = 0; i < kChurnPerTick; i++)
+        {
+            GameObject *bullet = spawn(i);
+            if (i < kHitsPerTick)
+                recycle(bullet);
+            else
+                live.push_back(bullet);
+        }
+        churn.spawnUs += ElapsedUs(start);
+        sync(churn);
+    }
+    const ActiveSetStats &stats = world.GetActiveSetStats();
+
+    std::printf("[PoolSpawnBench] %d background bodies, %d-bullet burst, then %d ticks x %d recycled/spawned "
+                "(%d hit in the same tick)\n",
+                kBackground, kBurst, kChurnTicks, kChurnPerTick, kHitsPerTick);
+    Report("burst (prefab instantiation)", burst, 1);
+    Report("churn (per tick, pooled objects)", churn, kChurnTicks);
+    std::printf("[PoolSpawnBench]   churn notifications=%zu coalesced=%zu, active objects=%zu\n",
+                stats.changesQueued - queuedBefore, stats.changesCoalesced - coalescedBefore,
+                world.GetActivateGameObjects().size());
+
+    std::filesystem::remove(prefabPath);
+    if (failures != 0)
+        std::printf("[PoolSpawnBench] FAILED: active sets differ on %d ticks\n", failures);
+    return failures == 0 ? 0 : 1;
+}
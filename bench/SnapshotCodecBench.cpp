@@ -0,0 +1,143 @@
+// 位置同步编解码基准: PositionSnapshot (量化 + 增量) 与原始 PositionBroadcast 对比
+// 一半实体持续飞行、一半静止, 客户端的 ACK 延迟若干 tick 才到达服务端.
+// 分别统计每实体字节数与编码/解码耗时, 并记录快照往返后的最大位置误差.
+#include "Engine/Network/Protocol/SnapshotCodec.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <deque>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedNs(Clock::time_point since)
+    {
+        return std::chrono::duration<double, std::nano>(Clock::now() - since).count();
+    }
+
+    // 第 tick 帧的实体状态: 偶数下标沿螺旋线飞行, 奇数下标停在原地
+    void Simulate(std::vector<NetBroadcastEntry> &entries, uint32_t tick, float dt)
+    {
+        const float t = tick * dt;
+        for (size_t i = 0; i < entries.size(); i++)
+        {
+            NetTransformState &s = entries[i].transform;
+            const float phase = 0.37f * i;
+            const float speed = (i % 2 == 0) ? 1.0f : 0.0f;
+            const float angle = phase + 0.5f * t * speed;
+            s.posX = 200.0f * std::cos(phase) + 40.0f * std::cos(angle) * speed;
+            s.posY = 50.0f + 3.0f * i + 10.0f * t * speed;
+            s.posZ = 200.0f * std::sin(phase) + 40.0f * std::sin(angle) * speed;
+            s.rotW = std::cos(angle * 0.5f);
+            s.rotX = 0.0f;
+            s.rotY = std::sin(angle * 0.5f);
+            s.rotZ = 0.0f;
+            s.linVelX = -20.0f * std::sin(angle) * speed;
+            s.linVelY = 10.0f * speed;
+            s.linVelZ = 20.0f * std::cos(angle) * speed;
+            s.angVelX = 0.0f;
+            s.angVelY = 0.5f * speed;
+            s.angVelZ = 0.0f;
+        }
+    }
+}
+
+int main()
+{
+    constexpr uint32_t kTicks = 600;
+    constexpr uint32_t kAckLag = 6;
+    constexpr float kTickDt = 1.0f / 30.0f;
+    int failures = 0;
+
+    for (size_t entityCount : {16, 64, 256})
+    {
+        std::vector<NetBroadcastEntry> entries(entityCount);
+        for (size_t i = 0; i < entityCount; i++)
+        {
+            entries[i].clientID = (ClientID)(1 + i % 8);
+            entries[i].objectID = (NetObjectID)(i + 1);
+        }
+
+        std::vector<uint8_t> broadcastPacket;
+        std::vector<uint8_t> snapshotPacket;
+        std::vector<SnapshotEntity> snapshot;
+        std::vector<NetBroadcastEntry> decoded;
+        std::deque<uint32_t> acksInFlight;
+        SnapshotEncoder encoder;
+        SnapshotDecoder decoder;
+
+        double broadcastEncodeNs = 0.0, broadcastDecodeNs = 0.0;
+        double snapshotEncodeNs = 0.0, snapshotDecodeNs = 0.0;
+        size_t broadcastBytes = 0, snapshotBytes = 0, decodedEntities = 0;
+        float maxError = 0.0f;
+
+        for (uint32_t tick = 1; tick <= kTicks; tick++)
+        {
+            Simulate(entries, tick, kTickDt);
+
+            auto start = Clock::now();
+            PacketSerializer::BufferWriter writer(broadcastPacket);
+            PacketSerializer::WritePositionBroadcast(writer, entries.data(), entries.size(), tick);
+            broadcastEncodeNs += ElapsedNs(start);
+            broadcastBytes += broadcastPacket.size();
+
+            start = Clock::now();
+            std::vector<NetBroadcastEntry> received =
+                PacketSerializer::ReadBroadcastEntries(broadcastPacket.data(), broadcastPacket.size());
+            broadcastDecodeNs += ElapsedNs(start);
+            failures += received.size() == entityCount ? 0 : 1;
+
+            // 服务端每 tick 量化一次, 再按该客户端确认过的基线编码
+            start = Clock::now();
+            SnapshotCodec::BuildSnapshot(entries, snapshot);
+            encoder.Encode(snapshot, tick, snapshotPacket);
+            snapshotEncodeNs += ElapsedNs(start);
+            snapshotBytes += snapshotPacket.size();
+
+            start = Clock::now();
+            uint32_t serverTick = 0;
+            const bool ok = decoder.Decode(snapshotPacket.data(), snapshotPacket.size(), serverTick, decoded);
+            snapshotDecodeNs += ElapsedNs(start);
+            if (!ok || decoded.size() != entityCount)
+            {
+                failures++;
+                continue;
+            }
+            decodedEntities += decoded.size();
+
+            // 解码结果按 (clientID, objectID) 排序, 用 objectID 找回原实体
+            for (const NetBroadcastEntry &e : decoded)
+            {
+                const NetTransformState &a = entries[e.objectID - 1].transform;
+                const float dx = a.posX - e.transform.posX;
+                const float dy = a.posY - e.transform.posY;
+                const float dz = a.posZ - e.transform.posZ;
+                maxError = std::max(maxError, std::sqrt(dx * dx + dy * dy + dz * dz));
+            }
+
+            acksInFlight.push_back(serverTick);
+            if (acksInFlight.size() > kAckLag)
+            {
+                encoder.OnAck(acksInFlight.front());
+                acksInFlight.pop_front();
+            }
+        }
+
+        const double entityTicks = double(entityCount) * kTicks;
+        std::printf("[SnapshotCodecBench] entities=%3zu ticks=%u ack lag=%u\n", entityCount, kTicks, kAckLag);
+        std::printf("[SnapshotCodecBench]   PositionBroadcast: %6.1f B/entity  encode %6.1f ns/entity  "
+                    "decode %6.1f ns/entity (ReadBroadcastEntries)\n",
+                    broadcastBytes / entityTicks, broadcastEncodeNs / entityTicks, broadcastDecodeNs / entityTicks);
+        std::printf("[SnapshotCodecBench]   PositionSnapshot : %6.1f B/entity  encode %6.1f ns/entity  "
+                    "decode %6.1f ns/entity  full packets=%llu  max position error=%.2f mm\n",
+                    snapshotBytes / entityTicks, snapshotEncodeNs / entityTicks,
+                    snapshotDecodeNs / (decodedEntities ? double(decodedEntities) : 1.0),
+                    (unsigned long long)encoder.GetStats().fullPackets, maxError * 1000.0f);
+    }
+    if (failures != 0)
+        std::printf("[SnapshotCodecBench] FAILED: %d ticks did not round-trip\n", failures);
+    return failures == 0 ? 0 : 1;
+}
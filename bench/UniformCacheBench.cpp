@@ -0,0 +1,314 @@
+// 光照 uniform 上传基准 (不需要窗口/GL):
+// 16 个光源 x 8 个字段, 4 个 shader, 每帧只有一个光源移动. 分别走
+//   1. 原先按名字设置: 每次调用查 location 缓存(std::string 键), 再无条件调用 SetShaderValue
+//   2. ShaderWrapper 的 UniformID + 值缓存: 值未变化的设置直接跳过
+// raylib 的 shader 接口由下面的替身实现, 按 (program, location) 记录最终值并统计调用次数;
+// 结束时核对两条路径留在每个 program 里的 uniform 值一致.
+#include "Engine/Graphics/ShaderWrapper.h"
+#include "external/glad.h"
+#include "raylib.h"
+#include "rlgl.h"
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    constexpr int kLights = 16;
+    constexpr int kShaders = 4;
+    constexpr int kFrames = 20000;
+
+    // 替身 "驱动": location 按名字全局分配, 每个 program 保存各 location 的最终值
+    struct FakeDriver
+    {
+        std::unordered_map<std::string, int> locations;
+        std::vector<std::vector<std::array<uint32_t, 16>>> programs;
+        unsigned int nextProgram = 0;
+
+        size_t locationLookups = 0;
+        size_t uploads = 0;
+    };
+
+    FakeDriver g_driver;
+
+    void Upload(Shader shader, int loc, const void *value, size_t bytes)
+    {
+        g_driver.uploads++;
+        std::vector<std::array<uint32_t, 16>> &program = g_driver.programs[shader.id];
+        if ((size_t)loc >= program.size())
+            program.resize(loc + 1, std::array<uint32_t, 16>{});
+        std::memcpy(program[loc].data(), value, bytes);
+    }
+}
+
+// ── raylib / rlgl 替身 (ShaderWrapper.cpp 用到的部分) ──
+Shader LoadShader(const char *, const char *)
+{
+    Shader shader{};
+    shader.id = ++g_driver.nextProgram;
+    g_driver.programs.resize(shader.id + 1);
+    return shader;
+}
+Shader LoadShaderFromMemory(const char *vs, const char *fs) { return LoadShader(vs, fs); }
+void UnloadShader(Shader) {}
+void BeginShaderMode(Shader) {}
+void EndShaderMode(void) {}
+int GetShaderLocation(Shader, const char *uniformName)
+{
+    g_driver.locationLookups++;
+    auto it = g_driver.locations.emplace(uniformName, (int)g_driver.locations.size()).first;
+    return it->second;
+}
+int GetShaderLocationAttrib(Shader, const char *) { return -1; }
+void SetShaderValue(Shader shader, int locIndex, const void *value, int uniformType)
+{
+    size_t bytes = sizeof(float);
+    if (uniformType == SHADER_UNIFORM_VEC2)
+        bytes *= 2;
+    else if (uniformType == SHADER_UNIFORM_VEC3)
+        bytes *= 3;
+    else if (uniformType == SHADER_UNIFORM_VEC4)
+        bytes *= 4;
+    Upload(shader, locIndex, value, bytes);
+}
+void SetShaderValueMatrix(Shader shader, int locIndex, Matrix mat) { Upload(shader, locIndex, &mat, sizeof(mat)); }
+unsigned int rlCompileShader(const char *, int) { return 0; }
+unsigned int rlGetShaderIdDefault(void) { return 0; }
+void rlActiveTextureSlot(int) {}
+void rlEnableTexture(unsigned int) {}
+void rlEnableTextureCubemap(unsigned int) {}
+
+// TFB 构造函数用到的 GL 入口; rlCompileShader 替身返回 0, 不会走到这里
+PFNGLCREATEPROGRAMPROC glad_glCreateProgram = nullptr;
+PFNGLATTACHSHADERPROC glad_glAttachShader = nullptr;
+PFNGLBINDATTRIBLOCATIONPROC glad_glBindAttribLocation = nullptr;
+PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_glTransformFeedbackVaryings = nullptr;
+PFNGLLINKPROGRAMPROC glad_glLinkProgram = nullptr;
+PFNGLGETPROGRAMIVPROC glad_glGetProgramiv = nullptr;
+PFNGLGETPROGRAMINFOLOGPROC glad_glGetProgramInfoLog = nullptr;
+PFNGLDELETEPROGRAMPROC glad_glDeleteProgram = nullptr;
+PFNGLDELETESHADERPROC glad_glDeleteShader = nullptr;
+
+namespace
+{
+    struct LightData
+    {
+        int type;
+        Vector3f position;
+        Vector3f direction;
+        Vector3f color;
+        float intensity;
+        float range;
+        int shadowIndex;
+        float shadowBias;
+    };
+
+    // 原 ShaderWrapper 的按名字设置: location 以 std::string 为键缓存, 每次都上传
+    class LegacyShader
+    {
+    public:
+        LegacyShader() : m_shader(LoadShader(nullptr, nullptr)) {}
+
+        void SetInt(const std::string &name, int value)
+        {
+            int loc = GetLocation(name);
+            if (loc >= 0)
+                SetShaderValue(m_shader, loc, &value, SHADER_UNIFORM_INT);
+        }
+        void SetFloat(const std::string &name, float value)
+        {
+            int loc = GetLocation(name);
+            if (loc >= 0)
+                SetShaderValue(m_shader, loc, &value, SHADER_UNIFORM_FLOAT);
+        }
+        void SetVec3(const std::string &name, const Vector3f &value)
+        {
+            int loc = GetLocation(name);
+            if (loc >= 0)
+            {
+                float valueArr[3] = {value.x(), value.y(), value.z()};
+                SetShaderValue(m_shader, loc, valueArr, SHADER_UNIFORM_VEC3);
+            }
+        }
+        Shader GetShader() const { return m_shader; }
+
+    private:
+        int GetLocation(const std::string &name)
+        {
+            auto it = m_locationCache.find(name);
+            if (it != m_locationCache.end())
+                return it->second;
+            int loc = GetShaderLocation(m_shader, name.c_str());
+            m_locationCache[name] = loc;
+            return loc;
+        }
+        Shader m_shader;
+        std::unordered_map<std::string, int> m_locationCache;
+    };
+
+    struct LightNames
+    {
+        std::string type, position, direction, color, intensity, range, shadowIndex, shadowBias;
+    };
+    struct LightIDs
+    {
+        UniformID type, position, direction, color, intensity, range, shadowIndex, shadowBias;
+    };
+
+    // 原 LightingManager::UploadLights: 名字预先拼好, 逐字段按名字设置
+    void UploadLegacy(LegacyShader &shader, const std::vector<LightNames> &names, const std::vector<LightData> &lights,
+                      const Vector3f &viewPos)
+    {
+        shader.SetInt("lightCounts", (int)lights.size());
+        shader.SetVec3("viewPos", viewPos);
+        for (size_t i = 0; i < lights.size(); i++)
+        {
+            const LightNames &n = names[i];
+            const LightData &light = lights[i];
+            shader.SetInt(n.type, light.type);
+            shader.SetVec3(n.position, light.position);
+            shader.SetVec3(n.direction, light.direction);
+            shader.SetVec3(n.color, light.color);
+            shader.SetFloat(n.intensity, light.intensity);
+            shader.SetFloat(n.range, light.range);
+            shader.SetInt(n.shadowIndex, light.shadowIndex);
+            if (light.shadowIndex >= 0)
+                shader.SetFloat(n.shadowBias, light.shadowBias);
+        }
+    }
+
+    // 现 LightingManager::UploadLights: 按 UniformID 设置, 经过值缓存
+    void UploadCached(ShaderWrapper &shader, const std::vector<LightIDs> &ids, UniformID lightCounts, UniformID viewPosID,
+                      const std::vector<LightData> &lights, const Vector3f &viewPos)
+    {
+        shader.SetInt(lightCounts, (int)lights.size());
+        shader.SetVec3(viewPosID, viewPos);
+        for (size_t i = 0; i < lights.size(); i++)
+        {
+            const LightIDs &id = ids[i];
+            const LightData &light = lights[i];
+            shader.SetInt(id.type, light.type);
+            shader.SetVec3(id.position, light.position);
+            shader.SetVec3(id.direction, light.direction);
+            shader.SetVec3(id.color, light.color);
+            shader.SetFloat(id.intensity, light.intensity);
+            shader.SetFloat(id.range, light.range);
+            shader.SetInt(id.shadowIndex, light.shadowIndex);
+            if (light.shadowIndex >= 0)
+                shader.SetFloat(id.shadowBias, light.shadowBias);
+        }
+    }
+
+    // 第 frame 帧的光源: 只有 0 号光源绕圈移动
+    void Animate(std::vector<LightData> &lights, int frame)
+    {
+        const float t = frame * (1.0f / 60.0f);
+        lights[0].position = Vector3f(10.0f * std::cos(t), 4.0f, 10.0f * std::sin(t));
+    }
+
+    double ElapsedUs(std::chrono::steady_clock::time_point since)
+    {
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - since).count();
+    }
+}
+
+int main()
+{
+    std::vector<LightData> lights(kLights);
+    for (int i = 0; i < kLights; i++)
+    {
+        LightData &light = lights[i];
+        light.type = i % 3;
+        light.position = Vector3f(3.0f * i, 2.0f, -4.0f);
+        light.direction = Vector3f(0.0f, -1.0f, 0.0f);
+        light.color = Vector3f(1.0f, 0.9f, 0.8f - 0.02f * i);
+        light.intensity = 1.0f + 0.1f * i;
+        light.range = 20.0f;
+        light.shadowIndex = i < 2 ? i : -1;
+        light.shadowBias = 0.005f;
+    }
+    const Vector3f viewPos(0.0f, 5.0f, -10.0f);
+
+    std::vector<LightNames> names(kLights);
+    std::vector<LightIDs> ids(kLights);
+    for (int i = 0; i < kLights; i++)
+    {
+        const std::string base = "lights[" + std::to_string(i) + "]";
+        names[i] = {base + ".type", base + ".position", base + ".direction", base + ".color",
+                    base + ".intensity", base + ".range", base + ".shadowIndex", base + ".shadowBias"};
+        ids[i] = {ShaderWrapper::Intern(names[i].type), ShaderWrapper::Intern(names[i].position),
+                  ShaderWrapper::Intern(names[i].direction), ShaderWrapper::Intern(names[i].color),
+                  ShaderWrapper::Intern(names[i].intensity), ShaderWrapper::Intern(names[i].range),
+                  ShaderWrapper::Intern(names[i].shadowIndex), ShaderWrapper::Intern(names[i].shadowBias)};
+    }
+    const UniformID lightCountsID = ShaderWrapper::Intern("lightCounts");
+    const UniformID viewPosID = ShaderWrapper::Intern("viewPos");
+
+    // 1. 按名字设置
+    std::vector<LegacyShader> legacy(kShaders);
+    g_driver.uploads = 0;
+    g_driver.locationLookups = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < kFrames; frame++)
+    {
+        Animate(lights, frame);
+        for (LegacyShader &shader : legacy)
+            UploadLegacy(shader, names, lights, viewPos);
+    }
+    const double legacyUs = ElapsedUs(start);
+    const size_t legacyUploads = g_driver.uploads;
+    const size_t legacyLookups = g_driver.locationLookups;
+
+    // 2. UniformID + 值缓存
+    std::vector<std::unique_ptr<ShaderWrapper>> cached;
+    for (int s = 0; s < kShaders; s++)
+        cached.push_back(std::make_unique<ShaderWrapper>("", ""));
+    g_driver.uploads = 0;
+    g_driver.locationLookups = 0;
+    ShaderWrapper::GetUniformStats() = {};
+    start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < kFrames; frame++)
+    {
+        Animate(lights, frame);
+        for (auto &shader : cached)
+            UploadCached(*shader, ids, lightCountsID, viewPosID, lights, viewPos);
+    }
+    const double cachedUs = ElapsedUs(start);
+    const size_t cachedUploads = g_driver.uploads;
+    const size_t cachedLookups = g_driver.locationLookups;
+
+    // 两条路径最终留在各 program 里的 uniform 值应当一致
+    bool identical = true;
+    for (int s = 0; s < kShaders; s++)
+        identical &= g_driver.programs[legacy[s].GetShader().id] == g_driver.programs[cached[s]->GetShader().id];
+
+    const double shaderUploads = double(kFrames) * kShaders;
+    std::printf("[UniformCacheBench] %d lights x 8 fields, %d shaders, %d frames, one light moving\n", kLights,
+                kShaders, kFrames);
+    std::printf("[UniformCacheBench]   string path: %6.2f us/shader upload  GL uploads/shader upload=%6.1f  "
+                "location lookups=%zu\n",
+                legacyUs / shaderUploads, legacyUploads / shaderUploads, legacyLookups);
+    std::printf("[UniformCacheBench]   ID + cache : %6.2f us/shader upload  GL uploads/shader upload=%6.1f  "
+                "location lookups=%zu  skipped=%llu\n",
+                cachedUs / shaderUploads, cachedUploads / shaderUploads, cachedLookups,
+                (unsigned long long)ShaderWrapper::GetUniformStats().skipped);
+
+    int failures = 0;
+    if (!identical)
+    {
+        std::printf("[UniformCacheBench] FAILED: the two paths leave different uniform values\n");
+        failures++;
+    }
+    if (cachedUploads * 10 > legacyUploads)
+    {
+        std::printf("[UniformCacheBench] FAILED: value cache skips fewer uploads than expected\n");
+        failures++;
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -19,6 +19,8 @@ struct EngineConfig : public Config
 
     std::string serverIP = DEFAULT_SERVER_HOST;
     uint16_t serverPort = DEFAULT_SERVER_PORT;
+    // 网络收发放到独立 I/O 线程(Web 平台忽略); 重启后生效
+    bool networkIOThread = false;
     std::string nickname = "";
 
     void toJson(json &j) const
@@ -26,7 +28,7 @@ struct EngineConfig : public Config
         j = json{
             {"window", {{"width", screenWidth}, {"height", screenHeight}, {"title", windowTitle}, {"fullscreen", fullScreen}}},
             {"performance", {{"targetFPS", targetFPS}}},
-            {"network", {{"serverIP", serverIP}, {"serverPort", serverPort}}},
+            {"network", {{"serverIP", serverIP}, {"serverPort", serverPort}, {"ioThread", networkIOThread}}},
         };
     }
 
@@ -47,6 +49,7 @@ protected:
             const auto &networkJson = configJson.at("network");
             this->serverIP = networkJson.value("serverIP", this->serverIP);
             this->serverPort = networkJson.value("serverPort", this->serverPort);
+            this->networkIOThread = networkJson.value("ioThread", this->networkIOThread);
             // Nickname is server-authoritative and should not be loaded from local config.
             this->nickname.clear();
         }
@@ -0,0 +1,175 @@
+#pragma once
+#include "IComponent.h"
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class TransformComponent;
+struct RigidbodyComponent;
+
+// 热点组件集中存放在 GameWorld 的连续分块内存中, 其余组件仍由 GameObject 单独持有
+// 只有每帧被系统批量遍历的组件才值得放进池里
+template <typename T>
+struct IsPooledComponent : std::false_type
+{
+};
+template <>
+struct IsPooledComponent<TransformComponent> : std::true_type
+{
+};
+template <>
+struct IsPooledComponent<RigidbodyComponent> : std::true_type
+{
+};
+
+// GameObject 上的 O(1) 组件槽位, 省去 type_index 线性查找
+template <typename T>
+struct ComponentSlot
+{
+    static constexpr int value = -1;
+};
+template <>
+struct ComponentSlot<TransformComponent>
+{
+    static constexpr int value = 0;
+};
+template <>
+struct ComponentSlot<RigidbodyComponent>
+{
+    static constexpr int value = 1;
+};
+constexpr int COMPONENT_SLOT_COUNT = 2;
+
+class IComponentPool
+{
+public:
+    virtual ~IComponentPool() = default;
+    virtual void Release(IComponent *component) = 0;
+};
+
+// 分块存储: 块内连续, 块地址固定, 组件地址在整个生命周期内不变
+// (GetComponent 返回的引用会被脚本/系统长期缓存, 不能用 swap-and-pop 搬移)
+template <typename T>
+class ComponentPool : public IComponentPool
+{
+public:
+    static constexpr size_t CHUNK_SIZE = 256;
+
+    ComponentPool() = default;
+    ComponentPool(const ComponentPool &) = delete;
+    ComponentPool &operator=(const ComponentPool &) = delete;
+    ~ComponentPool() override
+    {
+        for (auto &chunk : m_chunks)
+        {
+            for (size_t i = 0; i < CHUNK_SIZE; i++)
+            {
+                if (chunk->used[i])
+                    chunk->At(i)->~T();
+            }
+        }
+    }
+
+    template <typename... Args>
+    T *Create(Args &&...args)
+    {
+        if (m_freeSlots.empty())
+            AddChunk();
+        auto [chunkIndex, slot] = m_freeSlots.back();
+        m_freeSlots.pop_back();
+        Chunk &chunk = *m_chunks[chunkIndex];
+        T *component = new (chunk.At(slot)) T(std::forward<Args>(args)...);
+        chunk.used[slot] = true;
+        m_count++;
+        return component;
+    }
+
+    void Release(IComponent *component) override
+    {
+        T *typed = static_cast<T *>(component);
+        for (size_t c = 0; c < m_chunks.size(); c++)
+        {
+            Chunk &chunk = *m_chunks[c];
+            T *first = chunk.At(0);
+            if (typed < first || typed >= first + CHUNK_SIZE)
+                continue;
+            size_t slot = static_cast<size_t>(typed - first);
+            typed->~T();
+            chunk.used[slot] = false;
+            m_freeSlots.push_back({c, slot});
+            m_count--;
+            return;
+        }
+    }
+
+    // 按内存顺序遍历所有存活组件
+    template <typename F>
+    void ForEach(F &&fn)
+    {
+        for (size_t c = 0; c < m_chunks.size(); c++)
+        {
+            for (size_t i = 0; i < CHUNK_SIZE; i++)
+            {
+                if (m_chunks[c]->used[i])
+                    fn(*m_chunks[c]->At(i));
+            }
+        }
+    }
+
+    size_t Size() const { return m_count; }
+    size_t Capacity() const { return m_chunks.size() * CHUNK_SIZE; }
+
+private:
+    struct Chunk
+    {
+        alignas(T) unsigned char storage[sizeof(T) * CHUNK_SIZE];
+        bool used[CHUNK_SIZE] = {};
+        T *At(size_t i) { return std::launder(reinterpret_cast<T *>(storage) + i); }
+    };
+
+    void AddChunk()
+    {
+        size_t chunkIndex = m_chunks.size();
+        m_chunks.push_back(std::make_unique<Chunk>());
+        // 逆序压栈, 保证先分配低地址
+        for (size_t i = CHUNK_SIZE; i > 0; i--)
+            m_freeSlots.push_back({chunkIndex, i - 1});
+    }
+
+    std::vector<std::unique_ptr<Chunk>> m_chunks;
+    std::vector<std::pair<size_t, size_t>> m_freeSlots;
+    size_t m_count = 0;
+};
+
+class ComponentRegistry
+{
+public:
+    template <typename T>
+    ComponentPool<T> &GetPool()
+    {
+        auto &pool = m_pools[std::type_index(typeid(T))];
+        if (!pool)
+            pool = std::make_unique<ComponentPool<T>>();
+        return static_cast<ComponentPool<T> &>(*pool);
+    }
+
+private:
+    std::unordered_map<std::type_index, std::unique_ptr<IComponentPool>> m_pools;
+};
+
+// 组件释放器: 池化组件归还到池, 其余直接 delete
+struct ComponentDeleter
+{
+    IComponentPool *pool = nullptr;
+    void operator()(IComponent *component) const
+    {
+        if (pool)
+            pool->Release(component);
+        else
+            delete component;
+    }
+};
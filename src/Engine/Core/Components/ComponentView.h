@@ -0,0 +1,33 @@
+#pragma once
+#include "Engine/Core/GameObject/GameObject.h"
+#include "Engine/Core/Components/ComponentStorage.h"
+
+// 以池化组件为主序遍历实体: 顺着主组件的连续内存走, 其余组件经 GameObject 槽位取得
+// 只访问激活且未等待销毁的对象
+template <typename Primary, typename... Others>
+class ComponentView
+{
+    static_assert(IsPooledComponent<Primary>::value, "ComponentView primary type must be a pooled component");
+
+public:
+    explicit ComponentView(ComponentPool<Primary> &pool) : m_pool(pool) {}
+
+    // fn(GameObject &, Primary &, Others &...)
+    template <typename F>
+    void Each(F &&fn)
+    {
+        m_pool.ForEach([&fn](Primary &component)
+                       {
+            GameObject *obj = component.owner;
+            if (obj == nullptr || !obj->IsActive() || obj->IsWaitingDestroy())
+                return;
+            if (!(obj->template HasComponent<Others>() && ...))
+                return;
+            fn(*obj, component, obj->template GetComponent<Others>()...); });
+    }
+
+    size_t Size() const { return m_pool.Size(); }
+
+private:
+    ComponentPool<Primary> &m_pool;
+};
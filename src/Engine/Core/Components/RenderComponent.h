@@ -24,6 +24,10 @@ struct RenderComponent : public IComponent
     Vector3f scale = Vector3f(1.0f, 1.0f, 1.0f); // 渲染缩放
     bool castShadows = true;
 
+    // 模型空间包围盒缓存, 渲染队列在 model.meshes 变化(换模型)时重算
+    BoundingBox localBounds = {};
+    const Mesh *localBoundsSource = nullptr;
+
     RenderComponent() = default;
     ~RenderComponent() = default;
 };
\ No newline at end of file
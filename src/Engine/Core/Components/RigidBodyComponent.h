@@ -5,6 +5,7 @@
 #include "Engine/Math/Math.h"
 #include <iostream>
 #include <limits>
+#include <cstdint>
 
 class GameObject;
 class TransformComponent;
@@ -59,6 +60,8 @@ struct RigidbodyComponent : public IComponent
     AABB localAABB = AABB(Vector3f(0.0f, 0.0f, 0.0f),
                           Vector3f(0.0f, 0.0f, 0.0f));
     float boudingRadius = 0.0f;
+    // 连续碰撞检测: 每步沿速度扫掠, 防止高速小物体穿透薄目标
+    bool continuousCollision = false;
     std::function<void(GameObject *)> collisionCallback;
 
     void setHitboxBox(const Vector3f &min, const Vector3f &max)
@@ -95,6 +98,12 @@ struct RigidbodyComponent : public IComponent
     Vector3f angularMomentum = Vector3f(0.0f, 0.0f, 0.0f);    // 角动量
     Vector3f accumulatedTorques = Vector3f(0.0f, 0.0f, 0.0f); // 当前扭矩
 
+    // 休眠状态, 由 IslandManager 维护
+    bool canSleep = true;
+    bool isSleeping = false;
+    float sleepTimer = 0.0f;     // 持续低速的时间
+    uint32_t sleepIslandID = 0;  // 一起入睡的岛编号, 0 表示无
+
     Vector3f velocity = Vector3f(0.0f, 0.0f, 0.0f);  // 当前速度
     Vector3f acceleration = {0.0f, 0.0f, 0.0f};      // 当前加速度
     Vector3f accumulatedForces = {0.0f, 0.0f, 0.0f}; // 当前合力
@@ -172,9 +181,16 @@ struct RigidbodyComponent : public IComponent
         Matrix3f worldInertia = rotationMatrix * (this->inertiaTensor) * rotationMatrix.transposed();
         this->angularMomentum = worldInertia * (this->angularVelocity);
     }
+    void WakeUp()
+    {
+        isSleeping = false;
+        sleepTimer = 0.0f;
+    }
     // 施加冲量
     void AddImpulse(Vector3f impulse, Vector3f r = Vector3f::ZERO)
     {
+        if (isSleeping)
+            WakeUp();
         float invMass = mass > std::numeric_limits<float>::min() ? 1.0f / mass : 0.0f;
         this->velocity += impulse * invMass;
         if (invMass > std::numeric_limits<float>::min())
@@ -183,10 +199,14 @@ struct RigidbodyComponent : public IComponent
     // 施加力
     void AddForce(Vector3f force)
     {
+        if (isSleeping)
+            WakeUp();
         accumulatedForces += force;
     }
     void AddTorque(Vector3f torque)
     {
+        if (isSleeping)
+            WakeUp();
         accumulatedTorques += torque;
     }
     // 清空受力 (每帧结束时调用)
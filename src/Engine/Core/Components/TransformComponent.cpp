@@ -14,7 +14,7 @@ void TransformComponent::SetOwner(GameObject *owner)
 {
     this->owner = owner;
 }
-std::vector<GameObject *> TransformComponent::GetChildren() const
+const std::vector<GameObject *> &TransformComponent::GetChildren() const
 {
     return children;
 }
@@ -47,11 +47,57 @@ void TransformComponent::SetWorldMatrix(const Matrix4f &newWorldMat)
     this->localRotation = localMat.getRotation();
     this->localScale = localMat.getScale();
     this->isDirty = false;
+    if (parent == nullptr)
+    {
+        // 根节点的局部 TRS 即世界 TRS, 直接复用这次分解
+        worldRotation = localRotation;
+        worldScale = localScale;
+        worldTRSValid = true;
+    }
+    else
+    {
+        worldTRSValid = false;
+    }
     for (auto *child : children)
     {
         if (child)
             child->GetComponent<TransformComponent>().SetDirty();
     }
+    if (owner)
+        owner->NotifyTransformMoved();
+}
+void TransformComponent::SetWorldTRS(const Vector3f &pos, const Quat4f &rot, const Vector3f &scl)
+{
+    Quat4f normalizedRot = rot.normalized();
+    if (parent != nullptr)
+    {
+        SetWorldMatrix(Matrix4f::CreateTransform(pos, normalizedRot, scl));
+    }
+    else
+    {
+        worldMatrix = Matrix4f::CreateTransform(pos, normalizedRot, scl);
+        localPosition = pos;
+        localRotation = normalizedRot;
+        localScale = scl;
+        isDirty = false;
+        for (auto *child : children)
+        {
+            if (child)
+                child->GetComponent<TransformComponent>().SetDirty();
+        }
+    }
+    worldRotation = normalizedRot;
+    worldScale = scl;
+    worldTRSValid = true;
+    // 非根节点已在 SetWorldMatrix 中通知
+    if (parent == nullptr && owner)
+        owner->NotifyTransformMoved();
+}
+void TransformComponent::DecomposeWorldMatrix() const
+{
+    worldRotation = worldMatrix.getRotation();
+    worldScale = worldMatrix.getScale();
+    worldTRSValid = true;
 }
 void TransformComponent::SetLocalPosition(const Vector3f &pos)
 {
@@ -100,11 +146,25 @@ void TransformComponent::SetDirty()
     if (isDirty)
         return;
     isDirty = true;
+    // 由干净变脏时登记到所属世界的脏队列, 之后只重算这些节点
+    if (owner)
+        owner->NotifyTransformDirty();
     for (auto *child : children)
     {
         child->GetComponent<TransformComponent>().SetDirty();
     }
 }
+void TransformComponent::UpdateWorldMatrix(const Matrix4f &parentWorldMatrix)
+{
+    worldMatrix = parentWorldMatrix * GetLocalMatrix();
+    worldTRSValid = false;
+    isDirty = false;
+    for (auto *child : children)
+    {
+        if (child)
+            child->GetComponent<TransformComponent>().SetDirty();
+    }
+}
 
 void TransformComponent::SetClean()
 {
@@ -114,10 +174,20 @@ Vector3f TransformComponent::GetWorldPosition() const { return worldMatrix.getTr
 
 void TransformComponent::SetWorldPosition(const Vector3f &pos)
 {
-    this->SetWorldMatrix(Matrix4f::CreateTransform(pos, this->GetWorldRotation(), this->GetWorldScale()));
+    this->SetWorldTRS(pos, this->GetWorldRotation(), this->GetWorldScale());
+}
+Quat4f TransformComponent::GetWorldRotation() const
+{
+    if (!worldTRSValid)
+        DecomposeWorldMatrix();
+    return worldRotation;
+}
+Vector3f TransformComponent::GetWorldScale() const
+{
+    if (!worldTRSValid)
+        DecomposeWorldMatrix();
+    return worldScale;
 }
-Quat4f TransformComponent::GetWorldRotation() const { return worldMatrix.getRotation(); }
-Vector3f TransformComponent::GetWorldScale() const { return worldMatrix.getScale(); }
 Vector3f TransformComponent::GetForward() const { return worldMatrix.getCol(2).xyz().Normalized(); }
 Vector3f TransformComponent::GetUp() const { return worldMatrix.getCol(1).xyz().Normalized(); }
 Vector3f TransformComponent::GetRight() const { return worldMatrix.getCol(0).xyz().Normalized(); }
\ No newline at end of file
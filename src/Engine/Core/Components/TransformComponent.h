@@ -13,6 +13,12 @@ private:
 
     Matrix4f worldMatrix = Matrix4f::identity();
 
+    // 世界空间 TRS 缓存, 失效时在首次读取时才从 worldMatrix 分解
+    mutable Quat4f worldRotation = Quat4f(1.0f, 0.0f, 0.0f, 0.0f);
+    mutable Vector3f worldScale = Vector3f(1.0f, 1.0f, 1.0f);
+    mutable bool worldTRSValid = true;
+    void DecomposeWorldMatrix() const;
+
     // 组件所属对象
     GameObject *parent = nullptr;       // 父对象
     std::vector<GameObject *> children; // 子对象
@@ -25,12 +31,14 @@ public:
 
     TransformComponent(const Vector3f &pos, const Quat4f &rot, const Vector3f &scl);
 
-    std::vector<GameObject *> GetChildren() const;
+    const std::vector<GameObject *> &GetChildren() const;
     void SetOwner(GameObject *owner);
 
     Matrix4f GetLocalMatrix() const;
     Matrix4f GetWorldMatrix() const;
     void SetWorldMatrix(const Matrix4f &mat);
+    // 直接设置世界 TRS: 根节点无需分解矩阵与求父矩阵逆, 缩放应为正
+    void SetWorldTRS(const Vector3f &pos, const Quat4f &rot, const Vector3f &scl);
 
     void SetLocalPosition(const Vector3f &pos);
     Vector3f GetLocalPosition() const;
@@ -45,6 +53,8 @@ public:
 
     void SetDirty();
     void SetClean();
+    // 由 GameWorld::UpdateTransforms 调用: 根据父节点世界矩阵重算自身, 不回推局部 TRS
+    void UpdateWorldMatrix(const Matrix4f &parentWorldMatrix);
 
     Vector3f GetWorldPosition() const;
     void SetWorldPosition(const Vector3f &pos);
@@ -0,0 +1,60 @@
+#include "EntityQuery.h"
+#include "Engine/Core/GameObject/GameObject.h"
+
+void EntityQuery::Rebuild(const std::vector<GameObject *> &activeObjects)
+{
+    m_entities.clear();
+    m_indexOf.clear();
+    m_pending.clear();
+    for (auto *obj : activeObjects)
+    {
+        if (!obj->IsWaitingDestroy() && m_predicate(*obj))
+        {
+            m_indexOf[obj] = m_entities.size();
+            m_entities.push_back(obj);
+        }
+    }
+    m_stats.rebuilds++;
+}
+
+void EntityQuery::Flush()
+{
+    if (m_pending.size() > m_stats.maxPending)
+        m_stats.maxPending = m_pending.size();
+    for (auto *obj : m_pending)
+        Refresh(obj);
+    m_pending.clear();
+}
+
+void EntityQuery::Refresh(GameObject *obj)
+{
+    bool matches = obj->IsInActiveList() && !obj->IsWaitingDestroy() && m_predicate(*obj);
+    auto it = m_indexOf.find(obj);
+    bool contained = (it != m_indexOf.end());
+    if (matches == contained)
+        return;
+    if (matches)
+    {
+        m_indexOf[obj] = m_entities.size();
+        m_entities.push_back(obj);
+    }
+    else
+    {
+        size_t index = it->second;
+        GameObject *last = m_entities.back();
+        m_entities[index] = last;
+        m_indexOf[last] = index;
+        m_entities.pop_back();
+        m_indexOf.erase(it);
+    }
+    m_stats.updates++;
+    for (auto &listener : m_listeners)
+        listener(obj, matches);
+}
+
+void EntityQuery::Clear()
+{
+    m_entities.clear();
+    m_indexOf.clear();
+    m_pending.clear();
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+class GameObject;
+
+struct EntityQueryStats
+{
+    uint64_t hits = 0;       // 直接复用缓存的次数
+    uint64_t rebuilds = 0;   // 全量扫描重建的次数
+    uint64_t updates = 0;    // 增量加入/移除的次数
+    uint64_t maxPending = 0; // 两次合并之间积压的最多变化数
+};
+
+// 按组件签名缓存的实体集合
+// 成员变化由 GameWorld 记入待处理列表, 在下一次查询或 SyncActiveEntities 时增量合并, 遍历返回的引用期间集合不会变动
+class EntityQuery
+{
+public:
+    using Predicate = bool (*)(const GameObject &);
+    // 合并变化时逐个通知加入(added = true)或移除的对象; 移除时对象仍然有效
+    using ChangeCallback = std::function<void(GameObject *obj, bool added)>;
+
+    explicit EntityQuery(Predicate predicate) : m_predicate(predicate) {}
+
+    void Rebuild(const std::vector<GameObject *> &activeObjects);
+    void MarkDirty(GameObject *obj)
+    {
+        // 连续添加多个组件只记一次
+        if (m_pending.empty() || m_pending.back() != obj)
+            m_pending.push_back(obj);
+    }
+    void Flush();
+    void Clear();
+    void AddListener(ChangeCallback callback) { m_listeners.push_back(std::move(callback)); }
+
+    const std::vector<GameObject *> &GetEntities() const { return m_entities; }
+    EntityQueryStats &GetStats() { return m_stats; }
+    const EntityQueryStats &GetStats() const { return m_stats; }
+
+private:
+    void Refresh(GameObject *obj);
+
+    Predicate m_predicate;
+    std::vector<GameObject *> m_entities;
+    std::unordered_map<GameObject *, size_t> m_indexOf;
+    std::vector<GameObject *> m_pending;
+    std::vector<ChangeCallback> m_listeners;
+    EntityQueryStats m_stats;
+};
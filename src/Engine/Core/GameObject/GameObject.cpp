@@ -1,9 +1,10 @@
 #include "GameObject.h"
+#include "Engine/Core/GameWorld.h"
 #include <iostream>
 #include <string>
 
 GameObject::GameObject(unsigned int s_nextID, std::string name, std::string tag)
-    : m_id(s_nextID), m_name(name), m_tag(tag), m_isWaitingDestroy(false), m_isDestroyed(false)
+    : m_id(s_nextID), m_name(name), m_tag(tag), m_tagID(TagRegistry::Intern(tag)), m_isWaitingDestroy(false), m_isDestroyed(false)
 {
 }
 GameObject::~GameObject()
@@ -23,6 +24,7 @@ void GameObject::SetName(const std::string &name)
 void GameObject::SetTag(const std::string &tag)
 {
     m_tag = tag;
+    m_tagID = TagRegistry::Intern(tag);
 }
 std::string GameObject::GetName() const
 {
@@ -40,11 +42,12 @@ GameWorld *GameObject::GetOwnerWorld() const
 void GameObject::SetOwnerWorld(GameWorld *world)
 {
     owner_world = world;
+    if (world && !m_componentRegistry)
+        m_componentRegistry = &world->GetComponentRegistry();
 }
 
 // 用于删除GameObject
 // 先销毁脚本
-#include "Engine/Core/GameWorld.h"
 #include "Engine/Graphics/Particle/ParticleEmitter.h"
 #include "Engine/Graphics/Particle/ParticleSystem.h"
 void GameObject::OnDestroy()
@@ -77,10 +80,14 @@ void GameObject::OnDestroy()
         }
     }
     m_isWaitingDestroy = true;
+    NotifyQueryChanged();
 }
 void GameObject::SetIsWaitingDestroy(bool isWaitingDestroy)
 {
+    if (m_isWaitingDestroy == isWaitingDestroy)
+        return;
     m_isWaitingDestroy = isWaitingDestroy;
+    NotifyQueryChanged();
 }
 bool GameObject::IsWaitingDestroy() const
 {
@@ -158,4 +165,34 @@ void GameObject::SetActive(bool active)
 bool GameObject::IsActive() const
 {
     return m_isActive;
+}
+void GameObject::SetActiveIndex(size_t index)
+{
+    bool wasInList = IsInActiveList();
+    m_activeIndex = index;
+    if (wasInList != IsInActiveList())
+        NotifyQueryChanged();
+}
+size_t GameObject::GetActiveIndex() const
+{
+    return m_activeIndex;
+}
+bool GameObject::IsInActiveList() const
+{
+    return m_activeIndex != INVALID_INDEX;
+}
+void GameObject::NotifyQueryChanged()
+{
+    if (owner_world)
+        owner_world->NotifyQueryChanged(this);
+}
+void GameObject::NotifyTransformDirty()
+{
+    if (owner_world)
+        owner_world->NotifyTransformDirty(this);
+}
+void GameObject::NotifyTransformMoved()
+{
+    if (owner_world)
+        owner_world->NotifyTransformMoved(this);
 }
\ No newline at end of file
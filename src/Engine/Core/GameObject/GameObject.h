@@ -1,8 +1,11 @@
 #pragma once
 #include "Engine/Core/Components/Components.h"
+#include "Engine/Core/Components/ComponentStorage.h"
+#include "Engine/Core/GameObject/TagRegistry.h"
 #include <vector>
 #include <memory>
 #include <typeindex>
+#include <type_traits>
 #include <stdexcept>
 #include <string>
 #include <sstream>
@@ -42,21 +45,42 @@ public:
     void SetTag(const std::string &tag);
     std::string GetName() const;
     std::string GetTag() const;
+    // 驻留后的标签编号, 配合 TagRegistry::Mask 做位比较
+    TagID GetTagID() const { return m_tagID; }
     GameWorld *GetOwnerWorld() const;
     void SetOwnerWorld(GameWorld *world);
 
     void SetActive(bool active);
     bool IsActive() const;
 
+    // Transform 变脏时由 TransformComponent 调用, 登记到 GameWorld 的脏队列
+    void NotifyTransformDirty();
+    // 世界矩阵被直接写入时由 TransformComponent 调用
+    void NotifyTransformMoved();
+
+    // 在 GameWorld 激活列表中的下标(SetActive 的变化在 SyncActiveEntities 时才生效)
+    static constexpr size_t INVALID_INDEX = static_cast<size_t>(-1);
+    void SetActiveIndex(size_t index);
+    size_t GetActiveIndex() const;
+    bool IsInActiveList() const;
+    // 本帧待同步的激活变化在 GameWorld 变化队列中的下标, 用于合并同一对象的多次变化
+    void SetActiveChangeSlot(size_t slot) { m_activeChangeSlot = slot; }
+    size_t GetActiveChangeSlot() const { return m_activeChangeSlot; }
+
 private:
     GameWorld *owner_world = nullptr;
 
     std::string m_name;
     std::string m_tag;
+    TagID m_tagID = 0;
 
-    std::vector<std::unique_ptr<IComponent>> m_components;
+    std::vector<std::unique_ptr<IComponent, ComponentDeleter>> m_components;
     // 组件索引
     std::vector<std::type_index> m_componentTypeIndex;
+    // 热点组件直接槽位
+    IComponent *m_componentSlots[COMPONENT_SLOT_COUNT] = {};
+    // 池化组件所在的存储, 由所属 GameWorld 提供
+    ComponentRegistry *m_componentRegistry = nullptr;
 
     const unsigned int m_id;
     static unsigned int s_nextID;
@@ -65,6 +89,11 @@ private:
     bool m_isDestroyed = false;
 
     bool m_isActive = false;
+    size_t m_activeIndex = INVALID_INDEX;
+    size_t m_activeChangeSlot = INVALID_INDEX;
+
+    // 组件/销毁状态变化时通知世界刷新实体查询缓存
+    void NotifyQueryChanged();
 };
 
 template <typename T, typename... TArgs>
@@ -77,11 +106,29 @@ T &GameObject::AddComponent(TArgs &&...args)
         return GetComponent<T>();
     }
 
-    auto newComponent = std::make_unique<T>(std::forward<TArgs>(args)...);
-    T *rawPtr = newComponent.get();
-
-    m_components.push_back(std::move(newComponent));
+    T *rawPtr = nullptr;
+    if constexpr (IsPooledComponent<T>::value)
+    {
+        if (m_componentRegistry)
+        {
+            auto &pool = m_componentRegistry->GetPool<T>();
+            rawPtr = pool.Create(std::forward<TArgs>(args)...);
+            m_components.emplace_back(rawPtr, ComponentDeleter{&pool});
+        }
+    }
+    if (rawPtr == nullptr)
+    {
+        rawPtr = new T(std::forward<TArgs>(args)...);
+        m_components.emplace_back(rawPtr, ComponentDeleter{});
+    }
+    rawPtr->owner = this;
     m_componentTypeIndex.push_back(std::type_index(typeid(T)));
+    if constexpr (ComponentSlot<T>::value >= 0)
+        m_componentSlots[ComponentSlot<T>::value] = rawPtr;
+    // 新建的 Transform 默认是脏的, 需要登记一次才会被计算
+    if constexpr (std::is_same_v<T, TransformComponent>)
+        NotifyTransformDirty();
+    NotifyQueryChanged();
 
     return *rawPtr;
 }
@@ -89,12 +136,21 @@ T &GameObject::AddComponent(TArgs &&...args)
 template <typename T>
 T &GameObject::GetComponent() const
 {
-    auto targetType = std::type_index(typeid(T));
-    for (size_t i = 0; i < m_componentTypeIndex.size(); ++i)
+    if constexpr (ComponentSlot<T>::value >= 0)
+    {
+        if (IComponent *slot = m_componentSlots[ComponentSlot<T>::value])
+            return *static_cast<T *>(slot);
+    }
+    else
     {
-        if (m_componentTypeIndex[i] == targetType)
+        auto targetType = std::type_index(typeid(T));
+        for (size_t i = 0; i < m_componentTypeIndex.size(); ++i)
         {
-            return *dynamic_cast<T *>(m_components[i].get());
+            if (m_componentTypeIndex[i] == targetType)
+            {
+                // type_index 精确匹配, 无需 dynamic_cast
+                return *static_cast<T *>(m_components[i].get());
+            }
         }
     }
     std::ostringstream oss;
@@ -108,6 +164,8 @@ T &GameObject::GetComponent() const
 template <typename T>
 bool GameObject::HasComponent() const
 {
+    if constexpr (ComponentSlot<T>::value >= 0)
+        return m_componentSlots[ComponentSlot<T>::value] != nullptr;
     auto targetType = std::type_index(typeid(T));
     for (const auto &type : m_componentTypeIndex)
     {
@@ -182,6 +182,7 @@ void GameObjectFactory::ParseRigidBodyComponent(GameObject &gameObject, const js
     rb.drag = prefab.value("drag", 0.0f);
     rb.angularDrag = prefab.value("angularDrag", 0.0f);
     rb.elasticity = prefab.value("elasticity", 0.0f);
+    rb.continuousCollision = prefab.value("continuousCollision", false);
 
     if (prefab.contains("velocity"))
         rb.velocity = JsonParser::ToVector3f(prefab["velocity"]);
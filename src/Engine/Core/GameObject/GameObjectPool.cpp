@@ -64,6 +64,7 @@ void GameObjectPool::Recycle(GameObject *obj)
         rb.velocity = Vector3f::ZERO;
         rb.angularVelocity = Vector3f::ZERO;
         rb.ClearForces();
+        rb.WakeUp();
     }
     if (obj->HasComponent<ScriptComponent>())
     {
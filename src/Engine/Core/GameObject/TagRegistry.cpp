@@ -0,0 +1,27 @@
+#include "TagRegistry.h"
+#include <iostream>
+
+TagRegistry::Storage &TagRegistry::GetStorage()
+{
+    static Storage storage;
+    return storage;
+}
+
+TagID TagRegistry::Intern(const std::string &tag)
+{
+    Storage &storage = GetStorage();
+    auto it = storage.ids.find(tag);
+    if (it != storage.ids.end())
+        return it->second;
+    TagID id = static_cast<TagID>(storage.names.size());
+    if (id == 64)
+        std::cerr << "[TagRegistry]: more than 64 tags, tag masks will not match \"" << tag << "\" and later tags" << std::endl;
+    storage.ids.emplace(tag, id);
+    storage.names.push_back(tag);
+    return id;
+}
+
+const std::string &TagRegistry::GetName(TagID id)
+{
+    return GetStorage().names.at(id);
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using TagID = uint32_t;
+using TagMask = uint64_t;
+
+// 标签字符串驻留为整数编号, 热路径用位掩码比较代替字符串比较
+// 前 64 个标签各占一位; 超出的标签只能被 ALL_TAGS 匹配
+class TagRegistry
+{
+public:
+    static constexpr TagMask ALL_TAGS = ~TagMask(0);
+
+    static TagID Intern(const std::string &tag);
+    static const std::string &GetName(TagID id);
+
+    static TagMask MaskOf(TagID id) { return id < 64 ? (TagMask(1) << id) : 0; }
+    static TagMask Mask(const std::string &tag) { return MaskOf(Intern(tag)); }
+    static bool Matches(TagID id, TagMask mask) { return mask == ALL_TAGS || (MaskOf(id) & mask) != 0; }
+
+private:
+    struct Storage
+    {
+        std::unordered_map<std::string, TagID> ids;
+        std::vector<std::string> names;
+    };
+    static Storage &GetStorage();
+};
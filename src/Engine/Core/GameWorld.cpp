@@ -16,11 +16,13 @@ GameWorld::GameWorld(std::function<void(ScriptingFactory &, PhysicsStageFactory
       m_audioManager(audioManager),
       m_nextObjectID(0)
 {
+    m_componentRegistry = std::make_unique<ComponentRegistry>();
     m_timeManager = std::make_unique<TimeManager>();
     m_timerManager = std::make_unique<TimerManager>();
     m_cameraManager = std::make_unique<CameraManager>();
     m_inputManager = std::make_unique<InputManager>();
     m_physicsSystem = std::make_unique<PhysicsSystem>();
+    m_jobSystem = std::make_unique<JobSystem>();
     m_physicsStageFactory = std::make_unique<PhysicsStageFactory>();
     m_scriptingFactory = std::make_unique<ScriptingFactory>();
     m_scriptingSystem = std::make_unique<ScriptingSystem>();
@@ -47,6 +49,31 @@ GameWorld::GameWorld(std::function<void(ScriptingFactory &, PhysicsStageFactory
     }
 }
 
+GameWorld::GameWorld(HeadlessWorld,
+                     std::function<void(ScriptingFactory &, PhysicsStageFactory &, ParticleFactory &)> configCallback,
+                     const std::string &sceneConfigPath)
+    : m_nextObjectID(0),
+      m_resourceManager(nullptr),
+      m_audioManager(nullptr),
+      m_headless(true)
+{
+    m_componentRegistry = std::make_unique<ComponentRegistry>();
+    m_timeManager = std::make_unique<TimeManager>();
+    m_timerManager = std::make_unique<TimerManager>();
+    m_physicsSystem = std::make_unique<PhysicsSystem>();
+    m_jobSystem = std::make_unique<JobSystem>();
+    m_physicsStageFactory = std::make_unique<PhysicsStageFactory>();
+    m_scriptingFactory = std::make_unique<ScriptingFactory>();
+    m_scriptingSystem = std::make_unique<ScriptingSystem>();
+    m_eventManager = std::make_unique<EventManager>();
+    m_particleFactory = std::make_unique<ParticleFactory>();
+    m_sceneManager = std::make_unique<SceneManager>();
+
+    configCallback(*m_scriptingFactory, *m_physicsStageFactory, *m_particleFactory);
+
+    m_sceneManager->LoadPhysics(sceneConfigPath, *this);
+}
+
 GameWorld::~GameWorld()
 {
     OnDestroy();
@@ -58,16 +85,21 @@ void GameWorld::OnDestroy()
         obj->SetIsWaitingDestroy(true);
     }
     DestroyWaitingObjects();
+    m_queries.clear();
+    m_spatialHash.Clear();
     m_gameObjects.clear();
 
-    m_audioManager->ClearOneShots();
-    m_resourceManager->GameWorldUnloadAll();
+    if (m_audioManager)
+        m_audioManager->ClearOneShots();
+    if (m_resourceManager)
+        m_resourceManager->GameWorldUnloadAll();
 }
 
 GameObject &GameWorld::CreateGameObject()
 {
     auto newObject = std::make_unique<GameObject>(m_nextObjectID++);
     GameObject *rawPtr = newObject.get();
+    rawPtr->SetOwnerWorld(this);
     m_gameObjects.push_back(std::move(newObject));
     return *rawPtr;
 }
@@ -97,6 +129,14 @@ bool GameWorld::Update(float DeltaTime)
     m_scriptingSystem->Update(*this, DeltaTime);
     this->SyncActiveEntities();
 
+    if (m_headless)
+    {
+        this->UpdateTransforms();
+        m_lastFrameTransformStats = m_transformStats;
+        m_transformStats = TransformUpdateStats();
+        return true;
+    }
+
     m_particleSystem->Update(*this, DeltaTime);
     this->UpdateTransforms();
 
@@ -116,39 +156,63 @@ bool GameWorld::Update(float DeltaTime)
             m_networkSyncSystem->Update(*this, *m_networkClient, DeltaTime);
     }
 
+    m_lastFrameTransformStats = m_transformStats;
+    m_transformStats = TransformUpdateStats();
     return true;
 }
 
 void GameWorld::UpdateTransforms()
 {
-    for (auto &obj : m_gameObjects)
+    // 只处理脏节点: 按深度从浅到深计算, 父节点一定先于子节点完成
+    // 重算时子节点被置脏并追加到队列, 由下一批次处理
+    bool anyRecomputed = false;
+    while (!m_dirtyTransforms.empty())
     {
-        if (obj->IsWaitingDestroy())
-            continue;
-        if (!obj->HasComponent<TransformComponent>())
-            continue;
-        auto &tf = obj->GetComponent<TransformComponent>();
-        if (tf.GetParent() == nullptr)
+        m_transformBatch.clear();
+        for (auto *obj : m_dirtyTransforms)
         {
-            UpdateHierarchyLogic(obj.get(), Matrix4f::identity());
+            if (obj->IsWaitingDestroy() || !obj->HasComponent<TransformComponent>())
+                continue;
+            int depth = 0;
+            for (GameObject *p = obj->GetComponent<TransformComponent>().GetParent(); p; p = p->GetComponent<TransformComponent>().GetParent())
+                depth++;
+            m_transformBatch.push_back({depth, obj});
+        }
+        m_dirtyTransforms.clear();
+        std::sort(m_transformBatch.begin(), m_transformBatch.end(),
+                  [](const auto &a, const auto &b)
+                  { return a.first < b.first; });
+
+        for (auto &[depth, obj] : m_transformBatch)
+        {
+            auto &tf = obj->GetComponent<TransformComponent>();
+            if (!tf.isDirty)
+                continue;
+            GameObject *parent = tf.GetParent();
+            tf.UpdateWorldMatrix(parent ? parent->GetComponent<TransformComponent>().GetWorldMatrix()
+                                        : Matrix4f::identity());
+            m_transformStats.matricesRecomputed++;
+            anyRecomputed = true;
+            if (obj->IsInActiveList())
+                m_spatialHash.Update(obj, tf.GetWorldPosition());
         }
     }
+    // 场景查询的 BVH 在下一次查询时重拟合
+    if (anyRecomputed)
+        m_physicsSystem->GetQuery().MarkStale();
 }
-
-void GameWorld::UpdateHierarchyLogic(GameObject *obj, const Matrix4f &parentWorldMatrix)
+void GameWorld::NotifyTransformDirty(GameObject *obj)
 {
-    auto &tf = obj->GetComponent<TransformComponent>();
-    if (tf.isDirty)
-    {
-        Matrix4f localMat = tf.GetLocalMatrix();
-        tf.SetWorldMatrix(parentWorldMatrix * localMat);
-        tf.SetClean();
-    }
-    for (auto *child : tf.GetChildren())
-    {
-        if (child && !child->IsWaitingDestroy())
-            UpdateHierarchyLogic(child, tf.GetWorldMatrix());
-    }
+    m_dirtyTransforms.push_back(obj);
+    m_transformStats.dirtyQueued++;
+}
+void GameWorld::NotifyTransformMoved(GameObject *obj)
+{
+    if (obj->IsInActiveList())
+        m_spatialHash.Update(obj, obj->GetComponent<TransformComponent>().GetWorldPosition());
+    // 刚体被积分/碰撞/CCD/网络直接移动时, 场景查询的 BVH 同样需要重拟合
+    if (m_physicsSystem && obj->HasComponent<RigidbodyComponent>())
+        m_physicsSystem->GetQuery().MarkStale();
 }
 const std::vector<std::unique_ptr<GameObject>> &GameWorld::GetGameObjects() const
 {
@@ -174,6 +238,13 @@ void GameWorld::DestroyWaitingObjects()
     }
     if (anyObjectDestroyed)
     {
+        // 先让激活列表、查询缓存与脏队列丢弃这些对象, 再释放内存
+        SyncActiveEntities();
+        m_dirtyTransforms.erase(
+            std::remove_if(m_dirtyTransforms.begin(), m_dirtyTransforms.end(),
+                           [](GameObject *obj)
+                           { return obj->IsWaitingDestroy(); }),
+            m_dirtyTransforms.end());
         m_gameObjects.erase(
             std::remove_if(
                 m_gameObjects.begin(),
@@ -187,44 +258,73 @@ void GameWorld::DestroyWaitingObjects()
 }
 void GameWorld::Render()
 {
+    if (m_headless)
+        return;
     m_renderer->RenderScene(*this, *m_cameraManager);
 }
 
 void GameWorld::NotifyActivateStateChanged(GameObject *obj, bool active)
 {
-    m_activeChanges.push({obj, active});
-    // if (activate)
-    // {
-    //     m_activateGameObjects.push_back(obj);
-    // }
-    // else
-    // {
-    //     auto it = std::find(m_activateGameObjects.begin(), m_activateGameObjects.end(), obj);
-    //     if (it != m_activateGameObjects.end())
-    //     {
-    //         *it = m_activateGameObjects.back();
-    //         m_activateGameObjects.pop_back();
-    //     }
-    // }
+    size_t slot = obj->GetActiveChangeSlot();
+    if (slot != GameObject::INVALID_INDEX)
+    {
+        m_activeChanges[slot].newState = active;
+        m_activeSetStats.changesQueued++;
+        m_activeSetStats.changesCoalesced++;
+        return;
+    }
+    obj->SetActiveChangeSlot(m_activeChanges.size());
+    m_activeChanges.push_back({obj, active});
+    m_activeSetStats.changesQueued++;
 }
 void GameWorld::SyncActiveEntities()
 {
-    while (!m_activeChanges.empty())
+    // 每个对象记录自身下标, 加入/移除均为 O(1) 的 swap-and-pop
+    for (auto &change : m_activeChanges)
     {
-        auto change = m_activeChanges.front();
-        m_activeChanges.pop();
-        auto it = std::find(m_activateGameObjects.begin(), m_activateGameObjects.end(), change.obj);
-        bool currentlyInList = (it != m_activateGameObjects.end());
+        GameObject *obj = change.obj;
+        obj->SetActiveChangeSlot(GameObject::INVALID_INDEX);
+        bool currentlyInList = obj->IsInActiveList();
         if (change.newState && !currentlyInList)
         {
-            m_activateGameObjects.push_back(change.obj);
+            obj->SetActiveIndex(m_activateGameObjects.size());
+            m_activateGameObjects.push_back(obj);
+            if (obj->HasComponent<TransformComponent>())
+                m_spatialHash.Update(obj, obj->GetComponent<TransformComponent>().GetWorldPosition());
+            m_activeSetStats.changesApplied++;
         }
         else if (!change.newState && currentlyInList)
         {
-            *it = m_activateGameObjects.back();
+            size_t index = obj->GetActiveIndex();
+            GameObject *last = m_activateGameObjects.back();
+            m_activateGameObjects[index] = last;
+            last->SetActiveIndex(index);
             m_activateGameObjects.pop_back();
+            obj->SetActiveIndex(GameObject::INVALID_INDEX);
+            m_spatialHash.Remove(obj);
+            m_activeSetStats.changesApplied++;
         }
     }
+    m_activeChanges.clear();
+    // 每次同步都合并所有查询的积压变化, 很少被读取的签名也不会无限增长
+    FlushAllQueries();
+}
+
+void GameWorld::NotifyQueryChanged(GameObject *obj)
+{
+    for (auto &query : m_queries)
+    {
+        if (query)
+            query->MarkDirty(obj);
+    }
+}
+void GameWorld::FlushAllQueries()
+{
+    for (auto &query : m_queries)
+    {
+        if (query)
+            query->Flush();
+    }
 }
 
 GameObject *GameWorld::FindEntityByName(const std::string &name) const
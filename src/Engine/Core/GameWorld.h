@@ -1,6 +1,10 @@
 #pragma once
 #include "Engine/Core/GameObject/GameObject.h"
 #include "Engine/Core/GameObject/GameObjectPool.h"
+#include "Engine/Core/Components/ComponentView.h"
+#include "Engine/Core/EntityQuery.h"
+#include "Engine/Core/Jobs/JobSystem.h"
+#include "Engine/Core/Spatial/SpatialHash.h"
 #include "Engine/Core/Events/Events.h"
 #include "Engine/Graphics/Graphics.h"
 #include "Engine/System/System.h"
@@ -9,7 +13,6 @@
 #include <memory>
 #include <functional>
 #include <string>
-#include <queue>
 
 #include "Engine/Network/Client/NetworkClient.h"
 #include "Engine/Network/Sync/NetworkSyncSystem.h"
@@ -18,6 +21,24 @@
 class ScriptingFactory;
 class ScriptingSystem;
 
+struct ActiveSetStats
+{
+    size_t changesQueued = 0;    // 累计收到的 SetActive 通知数
+    size_t changesCoalesced = 0; // 被同一对象后续变化覆盖的通知数
+    size_t changesApplied = 0;   // 真正改变激活列表的次数
+};
+
+struct TransformUpdateStats
+{
+    size_t dirtyQueued = 0;         // 登记到脏队列的节点数
+    size_t matricesRecomputed = 0;  // 实际重算的世界矩阵数
+};
+
+// 无窗口世界的构造标记(专用服务器)
+struct HeadlessWorld
+{
+};
+
 class GameWorld
 {
 public:
@@ -29,20 +50,32 @@ public:
               const std::string &inputConfigPath = "assets/config/input_config.json",
               const std::string &renderView = "assets/view/test_view.json",
               const std::string &effectLibPath = "assets/Library/particle_effects.json");
+    // 无窗口世界: 只创建脚本/物理/事件等纯逻辑子系统, 场景文件只读取 physics 段
+    // 渲染/相机/输入/粒子/音频/资源均不存在, 只能调用 FixedUpdate 与 Update
+    GameWorld(HeadlessWorld,
+              std::function<void(ScriptingFactory &, PhysicsStageFactory &, ParticleFactory &)> configCallback,
+              const std::string &sceneConfigPath = "assets/scenes/test_scene.json");
     ~GameWorld();
     void OnDestroy();
+    bool IsHeadless() const { return m_headless; }
 
     GameObject &CreateGameObject();
     bool FixedUpdate(float fexedDeltaTime);
     bool Update(float deltaTime);
     void Render();
     void UpdateTransforms();
+    void NotifyTransformDirty(GameObject *obj);
+    // 直接写入世界矩阵(SetWorldTRS/SetWorldMatrix)不经过脏队列, 在此同步空间哈希与查询 BVH
+    void NotifyTransformMoved(GameObject *obj);
+    // 上一帧(含该帧内所有固定步)的层级更新开销
+    const TransformUpdateStats &GetTransformUpdateStats() const { return m_lastFrameTransformStats; }
 
     const std::vector<std::unique_ptr<GameObject>> &GetGameObjects() const;
     const std::vector<GameObject *> &GetActivateGameObjects() const;
 
     PhysicsStageFactory &GetPhysicsStageFactory() { return *m_physicsStageFactory; };
     PhysicsSystem &GetPhysicsSystem() { return *m_physicsSystem; };
+    JobSystem &GetJobSystem() { return *m_jobSystem; };
 
     ScriptingFactory &GetScriptingFactory() { return *m_scriptingFactory; };
     ScriptingSystem &GetScriptingSystem() { return *m_scriptingSystem; };
@@ -67,45 +100,98 @@ public:
     /// Inject a shared NetworkClient owned by ScreenManager.
     void SetNetworkClient(std::shared_ptr<NetworkClient> client) { m_networkClient = std::move(client); }
 
+    ComponentRegistry &GetComponentRegistry() { return *m_componentRegistry; }
+
+    // 连续内存上的类型化遍历, 例: world.View<RigidbodyComponent, TransformComponent>().Each(...)
+    template <typename Primary, typename... Others>
+    ComponentView<Primary, Others...> View()
+    {
+        return ComponentView<Primary, Others...>(m_componentRegistry->GetPool<Primary>());
+    }
+
+    // 返回按组件签名缓存的实体列表, 无分配; 引用在下一次同签名查询或 SyncActiveEntities 前保持稳定
     template <typename... Components>
-    std::vector<GameObject *> GetEntitiesWith()
+    const std::vector<GameObject *> &GetEntitiesWith()
     {
-        std::vector<GameObject *> results;
-        for (auto *obj : m_activateGameObjects)
-        {
-            if (!obj->IsWaitingDestroy() && (obj->HasComponent<Components>() && ...))
-            {
-                results.push_back(obj);
-            }
-        }
-        return results;
+        EntityQuery &query = GetOrCreateQuery<Components...>();
+        query.Flush();
+        query.GetStats().hits++;
+        return query.GetEntities();
+    }
+
+    template <typename... Components>
+    const EntityQueryStats &GetEntityQueryStats()
+    {
+        return GetOrCreateQuery<Components...>().GetStats();
     }
 
+    // 订阅某签名的成员增减; 订阅前已在集合中的对象不会补发通知
+    template <typename... Components>
+    void SubscribeEntityQuery(EntityQuery::ChangeCallback callback)
+    {
+        GetOrCreateQuery<Components...>().AddListener(std::move(callback));
+    }
+
+    void NotifyQueryChanged(GameObject *obj);
+
     void SyncActiveEntities();
     void NotifyActivateStateChanged(GameObject *obj, bool activate);
+    const ActiveSetStats &GetActiveSetStats() const { return m_activeSetStats; }
 
     GameObject *FindEntityByName(const std::string &name) const;
 
+    // 半径查询: 激活对象中与 pos 距离不超过 radius、标签在 tagMask 内的对象写入 out
+    // 例: world.QueryRadius(pos, 30.0f, ~TagRegistry::Mask("mine"), targets)
+    size_t QueryRadius(const Vector3f &pos, float radius, TagMask tagMask, std::vector<GameObject *> &out,
+                       const GameObject *ignore = nullptr)
+    {
+        return m_spatialHash.QueryRadius(pos, radius, tagMask, out, ignore);
+    }
+    SpatialHash &GetSpatialHash() { return m_spatialHash; }
+
     GameObjectPool &GetOrCreatePool(const std::string &name, const std::string &tag, const std::string &prefab, size_t preloadCount = 0);
     GameObjectPool &GetPool(const std::string &name) const;
 
 private:
-    void UpdateHierarchyLogic(GameObject *obj, const Matrix4f &parentWorldMatrix);
+    template <typename... Components>
+    EntityQuery &GetOrCreateQuery()
+    {
+        static const size_t queryID = s_nextQueryID++;
+        if (queryID >= m_queries.size())
+            m_queries.resize(queryID + 1);
+        auto &query = m_queries[queryID];
+        if (!query)
+        {
+            query = std::make_unique<EntityQuery>([](const GameObject &obj)
+                                                  { return (obj.HasComponent<Components>() && ...); });
+            query->Rebuild(m_activateGameObjects);
+        }
+        return *query;
+    }
+    void FlushAllQueries();
+
     void DestroyWaitingObjects();
 
     std::unique_ptr<TimeManager> m_timeManager;
     std::unique_ptr<TimerManager> m_timerManager;
 
     unsigned m_nextObjectID = 0;
+    // 必须先于 m_gameObjects 声明: 对象析构时要把池化组件归还
+    std::unique_ptr<ComponentRegistry> m_componentRegistry;
     std::vector<std::unique_ptr<GameObject>> m_gameObjects;
     std::vector<GameObject *> m_activateGameObjects;
 
+    // 实体查询缓存, 以签名类型的全局编号为下标
+    inline static size_t s_nextQueryID = 0;
+    std::vector<std::unique_ptr<EntityQuery>> m_queries;
+
     std::unique_ptr<Renderer> m_renderer;
     std::unique_ptr<CameraManager> m_cameraManager;
     std::unique_ptr<InputManager> m_inputManager;
 
     std::unique_ptr<PhysicsStageFactory> m_physicsStageFactory;
     std::unique_ptr<PhysicsSystem> m_physicsSystem;
+    std::unique_ptr<JobSystem> m_jobSystem;
 
     std::unique_ptr<ScriptingFactory> m_scriptingFactory;
     std::unique_ptr<ScriptingSystem> m_scriptingSystem;
@@ -127,8 +213,19 @@ private:
         GameObject *obj;
         bool newState;
     };
-    std::queue<ActiveChange> m_activeChanges;
+    // 每个对象在一帧内最多占一项, 多次 SetActive 只保留最后状态
+    std::vector<ActiveChange> m_activeChanges;
+    ActiveSetStats m_activeSetStats;
+
+    // 待重算的 Transform, 以及按层级深度排序后的本轮批次
+    std::vector<GameObject *> m_dirtyTransforms;
+    std::vector<std::pair<int, GameObject *>> m_transformBatch;
+    TransformUpdateStats m_transformStats;
+    TransformUpdateStats m_lastFrameTransformStats;
+    // 激活对象的世界坐标网格
+    SpatialHash m_spatialHash;
     std::unordered_map<std::string, std::unique_ptr<GameObjectPool>> m_pools;
 
     AudioManager *m_audioManager;
+    bool m_headless = false;
 };
\ No newline at end of file
@@ -0,0 +1,109 @@
+#include "JobSystem.h"
+#include <algorithm>
+
+JobSystem::JobSystem(size_t workerCount)
+{
+#if !defined(PLATFORM_WEB)
+    if (workerCount == 0)
+    {
+        unsigned int hardware = std::thread::hardware_concurrency();
+        workerCount = hardware > 1 ? hardware - 1 : 0;
+    }
+    for (size_t i = 0; i < workerCount; i++)
+        m_workers.emplace_back(&JobSystem::WorkerLoop, this);
+#else
+    (void)workerCount;
+#endif
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wakeCondition.notify_all();
+    for (auto &worker : m_workers)
+        worker.join();
+}
+
+void JobSystem::ParallelFor(size_t count, size_t grain, const RangeFn &fn)
+{
+    if (count == 0)
+        return;
+    grain = std::max<size_t>(grain, 1);
+    size_t chunkCount = (count + grain - 1) / grain;
+    if (m_workers.empty() || chunkCount == 1)
+    {
+        for (size_t begin = 0; begin < count; begin += grain)
+            fn(begin, std::min(begin + grain, count));
+        return;
+    }
+
+    Batch batch;
+    batch.fn = &fn;
+    batch.count = count;
+    batch.grain = grain;
+    batch.chunkCount = chunkCount;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_batches.push_back(&batch);
+    }
+    m_wakeCondition.notify_all();
+
+    // 调用线程同样领取块; 嵌套调用时它只等待自己的批次, 不会与外层互相等待
+    RunChunks(batch);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_doneCondition.wait(lock, [&batch]
+                         { return batch.finishedChunks.load() == batch.chunkCount && batch.busyWorkers == 0; });
+    m_batches.erase(std::find(m_batches.begin(), m_batches.end(), &batch));
+}
+
+void JobSystem::RunChunks(Batch &batch)
+{
+    size_t finished = 0;
+    for (;;)
+    {
+        size_t chunk = batch.nextChunk.fetch_add(1);
+        if (chunk >= batch.chunkCount)
+            break;
+        size_t begin = chunk * batch.grain;
+        (*batch.fn)(begin, std::min(begin + batch.grain, batch.count));
+        finished++;
+    }
+    if (finished > 0)
+        batch.finishedChunks.fetch_add(finished);
+}
+
+JobSystem::Batch *JobSystem::FindOpenBatch()
+{
+    for (auto it = m_batches.rbegin(); it != m_batches.rend(); ++it)
+    {
+        if ((*it)->nextChunk.load() < (*it)->chunkCount)
+            return *it;
+    }
+    return nullptr;
+}
+
+void JobSystem::WorkerLoop()
+{
+    for (;;)
+    {
+        Batch *batch = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wakeCondition.wait(lock, [&]
+                                 { return m_stopping || (batch = FindOpenBatch()) != nullptr; });
+            if (m_stopping)
+                return;
+            batch->busyWorkers++;
+        }
+        RunChunks(*batch);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            batch->busyWorkers--;
+        }
+        m_doneCondition.notify_all();
+    }
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// 常驻工作线程池, 只提供按区间切块的 ParallelFor
+// 调用线程同样参与执行; Web 平台或单核环境下退化为直接串行调用
+class JobSystem
+{
+public:
+    using RangeFn = std::function<void(size_t begin, size_t end)>;
+
+    // workerCount 为 0 时取硬件线程数 - 1
+    explicit JobSystem(size_t workerCount = 0);
+    ~JobSystem();
+
+    JobSystem(const JobSystem &) = delete;
+    JobSystem &operator=(const JobSystem &) = delete;
+
+    // 把 [0, count) 切成长度为 grain 的块分发执行, 返回时所有块均已完成
+    // 切块方式只取决于 count 与 grain, 与线程数无关; 块内可以嵌套调用, 空闲线程会协助执行内层批次
+    void ParallelFor(size_t count, size_t grain, const RangeFn &fn);
+
+    size_t GetWorkerCount() const { return m_workers.size(); }
+
+private:
+    // 一次 ParallelFor 调用, 存放在调用者栈上, 全部完成前挂在 m_batches 中
+    struct Batch
+    {
+        const RangeFn *fn = nullptr;
+        size_t count = 0;
+        size_t grain = 1;
+        size_t chunkCount = 0;
+        std::atomic<size_t> nextChunk{0};
+        std::atomic<size_t> finishedChunks{0};
+        // 正在执行该批次的工作线程数, 归零后调用者才能返回(受 m_mutex 保护)
+        size_t busyWorkers = 0;
+    };
+
+    void WorkerLoop();
+    static void RunChunks(Batch &batch);
+    // 需持有 m_mutex; 优先返回最近加入(最内层)且仍有未领取块的批次
+    Batch *FindOpenBatch();
+
+    std::vector<std::thread> m_workers;
+
+    std::mutex m_mutex;
+    std::condition_variable m_wakeCondition;
+    std::condition_variable m_doneCondition;
+    bool m_stopping = false;
+    std::vector<Batch *> m_batches;
+};
@@ -0,0 +1,56 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+// 单生产者单消费者环形队列, 无锁
+// 槽位预先构造并循环复用(如 std::vector 槽保留容量), 稳定后不再分配
+// 生产者: BeginPush 取空槽 -> 填写 -> CommitPush; 消费者: Front -> 读取 -> Pop
+template <typename T>
+class SpscRing
+{
+public:
+    // 容量向上取整为 2 的幂
+    explicit SpscRing(size_t capacity = 1024)
+    {
+        size_t size = 2;
+        while (size < capacity)
+            size <<= 1;
+        m_slots.resize(size);
+        m_mask = size - 1;
+    }
+
+    SpscRing(const SpscRing &) = delete;
+    SpscRing &operator=(const SpscRing &) = delete;
+
+    // 仅生产者线程调用; 队列满时返回 nullptr
+    T *BeginPush()
+    {
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_head.load(std::memory_order_acquire) > m_mask)
+            return nullptr;
+        return &m_slots[tail & m_mask];
+    }
+    void CommitPush() { m_tail.store(m_tail.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+    // 仅消费者线程调用; 队列空时返回 nullptr
+    T *Front()
+    {
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_tail.load(std::memory_order_acquire))
+            return nullptr;
+        return &m_slots[head & m_mask];
+    }
+    void Pop() { m_head.store(m_head.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+    // 近似值, 仅用于统计
+    size_t Size() const { return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire); }
+    size_t Capacity() const { return m_slots.size(); }
+
+private:
+    std::vector<T> m_slots;
+    size_t m_mask = 0;
+    // 读写索引分处不同缓存行, 避免两个线程互相失效
+    alignas(64) std::atomic<size_t> m_head{0};
+    alignas(64) std::atomic<size_t> m_tail{0};
+};
@@ -0,0 +1,121 @@
+#include "SpatialHash.h"
+#include "Engine/Core/GameObject/GameObject.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    constexpr int32_t COORD_LIMIT = (1 << 20) - 1;
+}
+
+int32_t SpatialHash::CellCoord(float v) const
+{
+    float c = std::floor(v * m_invCellSize);
+    c = std::max(-static_cast<float>(COORD_LIMIT), std::min(static_cast<float>(COORD_LIMIT), c));
+    return static_cast<int32_t>(c);
+}
+
+int64_t SpatialHash::CellKey(int32_t x, int32_t y, int32_t z)
+{
+    // 每轴 21 位
+    auto pack = [](int32_t v)
+    { return static_cast<int64_t>(static_cast<uint32_t>(v + COORD_LIMIT + 1) & 0x1FFFFF); };
+    return (pack(x) << 42) | (pack(y) << 21) | pack(z);
+}
+
+void SpatialHash::RemoveFromCell(int64_t cell, uint32_t index)
+{
+    auto it = m_cells.find(cell);
+    auto &items = it->second;
+    items[index] = items.back();
+    m_entries[items[index].obj].index = index;
+    items.pop_back();
+    // 空格子立即删除, 否则对象穿越世界时格子数无限增长
+    if (items.empty())
+        m_cells.erase(it);
+}
+
+void SpatialHash::Update(GameObject *obj, const Vector3f &position)
+{
+    int64_t cell = CellKey(CellCoord(position.x()), CellCoord(position.y()), CellCoord(position.z()));
+    auto it = m_entries.find(obj);
+    if (it != m_entries.end())
+    {
+        if (it->second.cell == cell)
+        {
+            m_cells[cell][it->second.index].position = position;
+            return;
+        }
+        RemoveFromCell(it->second.cell, it->second.index);
+        m_stats.moves++;
+    }
+    else
+    {
+        it = m_entries.emplace(obj, Entry{cell, 0}).first;
+    }
+    auto &items = m_cells[cell];
+    it->second.cell = cell;
+    it->second.index = static_cast<uint32_t>(items.size());
+    items.push_back({obj, position});
+    m_stats.objects = m_entries.size();
+    m_stats.cells = m_cells.size();
+}
+
+void SpatialHash::Remove(GameObject *obj)
+{
+    auto it = m_entries.find(obj);
+    if (it == m_entries.end())
+        return;
+    Entry entry = it->second;
+    RemoveFromCell(entry.cell, entry.index);
+    m_entries.erase(obj);
+    m_stats.objects = m_entries.size();
+    m_stats.cells = m_cells.size();
+}
+
+void SpatialHash::Clear()
+{
+    m_entries.clear();
+    m_cells.clear();
+    m_stats = Stats();
+}
+
+size_t SpatialHash::QueryRadius(const Vector3f &pos, float radius, TagMask tagMask, std::vector<GameObject *> &out,
+                                const GameObject *ignore)
+{
+    out.clear();
+    m_stats.queries++;
+    const float radiusSq = radius * radius;
+    auto visit = [&](const std::vector<Item> &items)
+    {
+        for (const auto &item : items)
+        {
+            m_stats.candidates++;
+            if (item.obj == ignore || (item.position - pos).LengthSquared() > radiusSq)
+                continue;
+            if (TagRegistry::Matches(item.obj->GetTagID(), tagMask))
+                out.push_back(item.obj);
+        }
+    };
+
+    int32_t minX = CellCoord(pos.x() - radius), maxX = CellCoord(pos.x() + radius);
+    int32_t minY = CellCoord(pos.y() - radius), maxY = CellCoord(pos.y() + radius);
+    int32_t minZ = CellCoord(pos.z() - radius), maxZ = CellCoord(pos.z() + radius);
+    double range = double(maxX - minX + 1) * double(maxY - minY + 1) * double(maxZ - minZ + 1);
+    if (range > static_cast<double>(m_cells.size()))
+    {
+        // 范围内格子数超过非空格子数时, 直接遍历非空格子
+        for (auto &[cell, items] : m_cells)
+            visit(items);
+        return out.size();
+    }
+    for (int32_t x = minX; x <= maxX; x++)
+        for (int32_t y = minY; y <= maxY; y++)
+            for (int32_t z = minZ; z <= maxZ; z++)
+            {
+                auto it = m_cells.find(CellKey(x, y, z));
+                if (it != m_cells.end())
+                    visit(it->second);
+            }
+    return out.size();
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include "Engine/Core/GameObject/TagRegistry.h"
+#include "Engine/Math/Math.h"
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+class GameObject;
+
+// 世界级均匀网格: 激活且带 Transform 的对象按世界坐标落入格子
+// 由 GameWorld 在激活集变化与 UpdateTransforms 时维护, 位置与上一次变换更新一致
+class SpatialHash
+{
+public:
+    struct Stats
+    {
+        size_t objects = 0;
+        size_t cells = 0;      // 非空格子数
+        size_t moves = 0;     // 跨格移动次数
+        size_t queries = 0;
+        size_t candidates = 0; // 查询时检查过的对象数
+    };
+
+    explicit SpatialHash(float cellSize = 16.0f) : m_cellSize(cellSize), m_invCellSize(1.0f / cellSize) {}
+
+    // 插入或更新位置
+    void Update(GameObject *obj, const Vector3f &position);
+    void Remove(GameObject *obj);
+    void Clear();
+
+    // 写入与 pos 距离不超过 radius 且标签匹配的对象, 返回数量; out 先被清空
+    size_t QueryRadius(const Vector3f &pos, float radius, TagMask tagMask, std::vector<GameObject *> &out,
+                       const GameObject *ignore = nullptr);
+
+    bool Contains(const GameObject *obj) const { return m_entries.count(const_cast<GameObject *>(obj)) != 0; }
+    const Stats &GetStats() const { return m_stats; }
+
+private:
+    struct Entry
+    {
+        int64_t cell;
+        uint32_t index; // 在格子数组中的下标
+    };
+    // 位置与对象存放在一起, 查询时不必再查表
+    struct Item
+    {
+        GameObject *obj;
+        Vector3f position;
+    };
+
+    int32_t CellCoord(float v) const;
+    static int64_t CellKey(int32_t x, int32_t y, int32_t z);
+    void RemoveFromCell(int64_t cell, uint32_t index);
+
+    float m_cellSize;
+    float m_invCellSize;
+    std::unordered_map<GameObject *, Entry> m_entries;
+    // 只保存非空格子
+    std::unordered_map<int64_t, std::vector<Item>> m_cells;
+    Stats m_stats;
+};
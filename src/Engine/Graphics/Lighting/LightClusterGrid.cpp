@@ -0,0 +1,140 @@
+#include "LightClusterGrid.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    int NdcToTile(float ndc, int dim)
+    {
+        int tile = (int)std::floor((ndc * 0.5f + 0.5f) * (float)dim);
+        return std::clamp(tile, 0, dim - 1);
+    }
+}
+
+int LightClusterGrid::SliceOf(float depth) const
+{
+    if (depth <= m_near)
+        return 0;
+    int slice = (int)std::floor(std::log(depth / m_near) * m_sliceScale);
+    return std::clamp(slice, 0, CLUSTER_DIM_Z - 1);
+}
+
+float LightClusterGrid::SliceDepth(int slice) const
+{
+    return m_near * std::exp((float)slice / m_sliceScale);
+}
+
+void LightClusterGrid::Build(const std::vector<ClusterLight> &lights, const Matrix4f &view, const Matrix4f &proj,
+                             float nearPlane, float farPlane)
+{
+    m_near = nearPlane > 0.0f ? nearPlane : 0.01f;
+    m_far = std::max(farPlane, m_near * 1.001f);
+    m_sliceScale = (float)CLUSTER_DIM_Z / std::log(m_far / m_near);
+
+    m_stats = Stats();
+    m_stats.lights = (uint32_t)lights.size();
+    m_spans.clear();
+    m_counts.assign(CLUSTER_COUNT, 0);
+
+    // 第一遍: 求每个光源在各切片覆盖的 tile 矩形, 统计每簇光源数
+    for (uint32_t i = 0; i < (uint32_t)lights.size(); i++)
+    {
+        const ClusterLight &light = lights[i];
+        const float r = light.range;
+        if (r <= 0.0f || light.intensity <= 0.001f)
+            continue;
+
+        const Vector3f &p = light.position;
+        const float vx = view(0, 0) * p.x() + view(0, 1) * p.y() + view(0, 2) * p.z() + view(0, 3);
+        const float vy = view(1, 0) * p.x() + view(1, 1) * p.y() + view(1, 2) * p.z() + view(1, 3);
+        const float vz = view(2, 0) * p.x() + view(2, 1) * p.y() + view(2, 2) * p.z() + view(2, 3);
+        const float depth = -vz;
+
+        float dMin = depth - r;
+        float dMax = depth + r;
+        if (dMax <= m_near || dMin >= m_far)
+            continue;
+        dMin = std::max(dMin, m_near);
+        dMax = std::min(dMax, m_far);
+
+        bool visible = false;
+        const int z1 = SliceOf(dMax);
+        for (int z = SliceOf(dMin); z <= z1; z++)
+        {
+            const float sliceNear = std::max(SliceDepth(z), dMin);
+            const float sliceFar = std::min(SliceDepth(z + 1), dMax);
+            // 球与该切片相交部分的截面半径, 取离球心最近的深度
+            const float dz = depth < sliceNear ? sliceNear - depth : (depth > sliceFar ? depth - sliceFar : 0.0f);
+            const float rs = std::sqrt(std::max(r * r - dz * dz, 0.0f));
+
+            // 投影是线性分式函数, 包围盒的 NDC 极值在角点上
+            float nx0 = 1e30f, nx1 = -1e30f, ny0 = 1e30f, ny1 = -1e30f;
+            for (float d : {sliceNear, sliceFar})
+            {
+                const float zv = -d;
+                const float w = proj(3, 2) * zv + proj(3, 3);
+                for (float s : {-rs, rs})
+                {
+                    const float nx = (proj(0, 0) * (vx + s) + proj(0, 2) * zv + proj(0, 3)) / w;
+                    const float ny = (proj(1, 1) * (vy + s) + proj(1, 2) * zv + proj(1, 3)) / w;
+                    nx0 = std::min(nx0, nx);
+                    nx1 = std::max(nx1, nx);
+                    ny0 = std::min(ny0, ny);
+                    ny1 = std::max(ny1, ny);
+                }
+            }
+            if (nx1 < -1.0f || nx0 > 1.0f || ny1 < -1.0f || ny0 > 1.0f)
+                continue;
+
+            Span span;
+            span.light = i;
+            span.z = (uint16_t)z;
+            span.x0 = (uint8_t)NdcToTile(nx0, CLUSTER_DIM_X);
+            span.x1 = (uint8_t)NdcToTile(nx1, CLUSTER_DIM_X);
+            span.y0 = (uint8_t)NdcToTile(ny0, CLUSTER_DIM_Y);
+            span.y1 = (uint8_t)NdcToTile(ny1, CLUSTER_DIM_Y);
+            m_spans.push_back(span);
+
+            for (int y = span.y0; y <= span.y1; y++)
+                for (int x = span.x0; x <= span.x1; x++)
+                    m_counts[ClusterIndex(x, y, z)]++;
+            visible = true;
+        }
+        if (visible)
+            m_stats.visibleLights++;
+    }
+
+    // 前缀和得到每簇偏移; 单簇与总下标数封顶, 多出的分配丢弃
+    m_offsets.resize(CLUSTER_COUNT);
+    uint32_t total = 0;
+    for (int c = 0; c < CLUSTER_COUNT; c++)
+    {
+        uint32_t count = std::min<uint32_t>(m_counts[c], MAX_LIGHTS_PER_CLUSTER);
+        count = std::min<uint32_t>(count, MAX_CLUSTER_INDICES - total);
+        m_stats.dropped += m_counts[c] - count;
+        m_offsets[c] = total;
+        m_counts[c] = count;
+        total += count;
+        if (count > 0)
+            m_stats.occupiedClusters++;
+        m_stats.maxPerCluster = std::max(m_stats.maxPerCluster, count);
+    }
+
+    // 第二遍: 按光源顺序填充下标
+    m_indices.resize(total);
+    m_cursor.assign(CLUSTER_COUNT, 0);
+    for (const Span &span : m_spans)
+    {
+        for (int y = span.y0; y <= span.y1; y++)
+        {
+            for (int x = span.x0; x <= span.x1; x++)
+            {
+                const int c = ClusterIndex(x, y, span.z);
+                if (m_cursor[c] < m_counts[c])
+                    m_indices[m_offsets[c] + m_cursor[c]++] = span.light;
+            }
+        }
+    }
+    m_stats.indices = total;
+}
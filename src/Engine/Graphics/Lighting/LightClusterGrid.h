@@ -0,0 +1,75 @@
+#pragma once
+#include "Engine/Math/Math.h"
+#include <cstdint>
+#include <vector>
+
+// 与 lighting.fs 中的定义保持一致
+#define CLUSTER_DIM_X 16
+#define CLUSTER_DIM_Y 9
+#define CLUSTER_DIM_Z 24
+#define CLUSTER_COUNT (CLUSTER_DIM_X * CLUSTER_DIM_Y * CLUSTER_DIM_Z)
+#define MAX_CLUSTERED_LIGHTS 512
+#define MAX_LIGHTS_PER_CLUSTER 64
+#define MAX_CLUSTER_INDICES 32768
+
+// 参与分簇的点光源 (世界空间)
+struct ClusterLight
+{
+    Vector3f position;
+    float range = 0.0f;
+    Vector3f color; // 0~1
+    float intensity = 0.0f;
+};
+
+// 视空间分簇 (froxel): x/y 按 NDC 均分, z 在 near~far 间按指数切片.
+// 每个视图在 CPU 上把点光源球分配到相交的簇, 结果为每簇 (offset, count) + 紧凑的光源下标列表
+// 不依赖 GL, 可以单独测试/计时
+class LightClusterGrid
+{
+public:
+    struct Stats
+    {
+        uint32_t lights = 0;           // 输入光源数
+        uint32_t visibleLights = 0;    // 至少落入一个簇
+        uint32_t occupiedClusters = 0; // 至少含一个光源的簇
+        uint32_t indices = 0;          // 下标列表长度
+        uint32_t maxPerCluster = 0;
+        uint32_t dropped = 0; // 超出单簇/总下标上限而丢弃的分配
+    };
+
+    // view/proj 为列向量约定 (clip = proj * view * p)
+    void Build(const std::vector<ClusterLight> &lights, const Matrix4f &view, const Matrix4f &proj,
+               float nearPlane, float farPlane);
+
+    static int ClusterIndex(int x, int y, int z) { return (z * CLUSTER_DIM_Y + y) * CLUSTER_DIM_X + x; }
+    // 深度 d 所在切片: floor(log(d / near) * sliceScale)
+    float GetSliceScale() const { return m_sliceScale; }
+    float GetNearPlane() const { return m_near; }
+
+    const std::vector<uint32_t> &GetOffsets() const { return m_offsets; }
+    const std::vector<uint32_t> &GetCounts() const { return m_counts; }
+    const std::vector<uint32_t> &GetIndices() const { return m_indices; }
+    const Stats &GetStats() const { return m_stats; }
+
+private:
+    // 单个光源在一个切片内覆盖的 tile 矩形
+    struct Span
+    {
+        uint32_t light;
+        uint16_t z;
+        uint8_t x0, x1, y0, y1;
+    };
+    int SliceOf(float depth) const;
+    float SliceDepth(int slice) const;
+
+    float m_near = 0.1f;
+    float m_far = 1000.0f;
+    float m_sliceScale = 1.0f;
+
+    std::vector<Span> m_spans;
+    std::vector<uint32_t> m_offsets;
+    std::vector<uint32_t> m_counts;
+    std::vector<uint32_t> m_cursor;
+    std::vector<uint32_t> m_indices;
+    Stats m_stats;
+};
@@ -2,6 +2,7 @@
 #include "Engine/Core/Components/Components.h"
 #include "Engine/Core/GameWorld.h"
 #include "Engine/Graphics/Renderer.h"
+#include "Engine/Graphics/RenderQueue/RenderQueue.h"
 
 #include "rlgl.h"
 
@@ -38,25 +39,48 @@ LightingManager::~LightingManager()
         }
     }
     m_pointShadowMaps.clear();
+
+    if (m_clusterTexture.id > 0)
+        rlUnloadTexture(m_clusterTexture.id);
 }
 void LightingManager::Update(GameWorld &world)
 {
     m_activeLights.clear();
     m_activeCasters.clear();
     m_activePointCasters.clear();
+    m_clusterLights.clear();
 
-    auto entities = world.GetEntitiesWith<LightComponent, TransformComponent>();
+    const auto &entities = world.GetEntitiesWith<LightComponent, TransformComponent>();
 
     int shadowCount = 0;
     int pointShadowCount = 0;
     for (auto *entity : entities)
     {
-        if (m_activeLights.size() >= MAX_LIGHTS)
-            break;
-
         auto &light = entity->GetComponent<LightComponent>();
         auto &tf = entity->GetComponent<TransformComponent>();
 
+        // 分簇模式: 不投影的点光源进入分簇列表, 不占 lights[] 名额
+        if (m_clustered && light.type == LightType::Point &&
+            !(light.castShadows && pointShadowCount < MAX_POINT_SHADOWS && m_activeLights.size() < MAX_LIGHTS))
+        {
+            light.shadowIndex = -1;
+            if (m_clusterLights.size() < MAX_CLUSTERED_LIGHTS)
+            {
+                ClusterLight &cl = m_clusterLights.emplace_back();
+                cl.position = tf.GetWorldPosition();
+                cl.range = light.range;
+                cl.color = light.color / 255.0f;
+                cl.intensity = light.intensity;
+            }
+            continue;
+        }
+        if (m_activeLights.size() >= MAX_LIGHTS)
+        {
+            if (m_clustered)
+                continue;
+            break;
+        }
+
         LightInfo info;
         info.data = &light;
         info.worldPosition = tf.GetWorldPosition();
@@ -101,48 +125,149 @@ void LightingManager::Update(GameWorld &world)
         m_activeLights.push_back(info);
     }
 }
-void LightingManager::UploadToShader(std::shared_ptr<ShaderWrapper> shader, const Vector3f &viewPos, int texUnit)
+void LightingManager::ResolveUniformIDs()
 {
-    if (!shader || !shader->IsValid())
+    m_lightIDs.resize(MAX_LIGHTS);
+    for (int i = 0; i < MAX_LIGHTS; ++i)
+    {
+        std::string base = "lights[" + std::to_string(i) + "]";
+        auto &ids = m_lightIDs[i];
+        ids.type = ShaderWrapper::Intern(base + ".type");
+        ids.position = ShaderWrapper::Intern(base + ".position");
+        ids.direction = ShaderWrapper::Intern(base + ".direction");
+        ids.color = ShaderWrapper::Intern(base + ".color");
+        ids.intensity = ShaderWrapper::Intern(base + ".intensity");
+        ids.range = ShaderWrapper::Intern(base + ".range");
+        ids.shadowIndex = ShaderWrapper::Intern(base + ".shadowIndex");
+        ids.shadowBias = ShaderWrapper::Intern(base + ".shadowBias");
+    }
+    m_lightVPIDs.resize(MAX_SHADOW_CASTERS);
+    m_shadowMapIDs.resize(MAX_SHADOW_CASTERS);
+    for (int i = 0; i < MAX_SHADOW_CASTERS; ++i)
+    {
+        m_lightVPIDs[i] = ShaderWrapper::Intern("lightVPs[" + std::to_string(i) + "]");
+        m_shadowMapIDs[i] = ShaderWrapper::Intern("shadowMaps[" + std::to_string(i) + "]");
+    }
+    m_pointShadowMapIDs.resize(MAX_POINT_SHADOWS);
+    for (int i = 0; i < MAX_POINT_SHADOWS; ++i)
+        m_pointShadowMapIDs[i] = ShaderWrapper::Intern("pointShadowMaps[" + std::to_string(i) + "]");
+    m_lightCountsID = ShaderWrapper::Intern("lightCounts");
+    m_viewPosID = ShaderWrapper::Intern("viewPos");
+    m_useClustersID = ShaderWrapper::Intern("useClusteredLights");
+    m_clusterParamsID = ShaderWrapper::Intern("clusterParams");
+    m_clusterDataID = ShaderWrapper::Intern("clusterData");
+}
+
+void LightingManager::UploadLights(ShaderWrapper &shader, const Vector3f &viewPos)
+{
+    if (!shader.IsValid())
         return;
-    shader->SetInt("lightCounts", (int)m_activeLights.size());
-    shader->SetVec3("viewPos", viewPos);
+    if (m_lightIDs.empty())
+        ResolveUniformIDs();
+    shader.SetInt(m_lightCountsID, (int)m_activeLights.size());
+    shader.SetVec3(m_viewPosID, viewPos);
 
-    for (int i = 0; i < m_activeLights.size(); ++i)
+    for (int i = 0; i < (int)m_activeLights.size(); ++i)
     {
-        std::string base = "lights[" + std::to_string(i) + "]";
+        const auto &ids = m_lightIDs[i];
         const auto &info = m_activeLights[i];
 
-        shader->SetInt(base + ".type", (int)info.data->type);
-        shader->SetVec3(base + ".position", info.worldPosition);
-        shader->SetVec3(base + ".direction", info.worldDirection);
-        shader->SetVec3(base + ".color", info.data->color / 255.0f);
-        shader->SetFloat(base + ".intensity", info.data->intensity);
-        shader->SetFloat(base + ".range", info.data->range);
-        shader->SetInt(base + ".shadowIndex", info.shadowIndex);
+        shader.SetInt(ids.type, (int)info.data->type);
+        shader.SetVec3(ids.position, info.worldPosition);
+        shader.SetVec3(ids.direction, info.worldDirection);
+        shader.SetVec3(ids.color, info.data->color / 255.0f);
+        shader.SetFloat(ids.intensity, info.data->intensity);
+        shader.SetFloat(ids.range, info.data->range);
+        shader.SetInt(ids.shadowIndex, info.shadowIndex);
         if (info.shadowIndex >= 0)
         {
-            shader->SetFloat(base + ".shadowBias", info.data->shadowBias);
+            shader.SetFloat(ids.shadowBias, info.data->shadowBias);
         }
     }
 
+    for (int i = 0; i < (int)m_activeCasters.size(); ++i)
+        shader.SetMat4(m_lightVPIDs[i], m_activeCasters[i].lightVP);
+
+    shader.SetInt(m_useClustersID, m_clustered ? 1 : 0);
+    if (m_clustered)
+        shader.SetVec2(m_clusterParamsID, Vector2f(m_clusterGrid.GetNearPlane(), m_clusterGrid.GetSliceScale()));
+}
+
+void LightingManager::BindShadowMaps(ShaderWrapper &shader, int texUnit)
+{
+    if (!shader.IsValid())
+        return;
+    if (m_lightIDs.empty())
+        ResolveUniformIDs();
+
     // 避开材质贴图
     int shadowUnitBase = texUnit + 1;
-    for (int i = 0; i < m_activeCasters.size(); ++i)
+    for (int i = 0; i < (int)m_activeCasters.size(); ++i)
     {
-        std::string baseVP = "lightVPs[" + std::to_string(i) + "]";
-        std::string baseMap = "shadowMaps[" + std::to_string(i) + "]";
-
-        shader->SetMat4(baseVP, m_activeCasters[i].lightVP);
-        shader->SetTexture(baseMap, m_shadowMaps[m_activeCasters[i].textureIndex].depth, shadowUnitBase + i);
+        shader.SetTexture(m_shadowMapIDs[i], m_shadowMaps[m_activeCasters[i].textureIndex].depth, shadowUnitBase + i);
     }
 
     int pointShadowUnitBase = shadowUnitBase + m_activeCasters.size();
-    for (int i = 0; i < m_pointShadowMaps.size(); ++i)
+    for (int i = 0; i < (int)m_pointShadowMaps.size(); ++i)
     {
-        std::string baseMap = "pointShadowMaps[" + std::to_string(i) + "]";
-        shader->SetCubeMap(baseMap, m_pointShadowMaps[i].cubemapId, pointShadowUnitBase + i);
+        shader.SetCubeMap(m_pointShadowMapIDs[i], m_pointShadowMaps[i].cubemapId, pointShadowUnitBase + i);
     }
+
+    if (m_clustered && m_clusterTexture.id > 0)
+        shader.SetTexture(m_clusterDataID, m_clusterTexture, pointShadowUnitBase + (int)m_pointShadowMaps.size());
+}
+
+void LightingManager::BuildClusters(const Matrix4f &view, const Matrix4f &proj, float nearPlane, float farPlane)
+{
+    if (!m_clustered)
+        return;
+    m_clusterGrid.Build(m_clusterLights, view, proj, nearPlane, farPlane);
+
+    if (m_clusterTexture.id == 0)
+    {
+        m_clusterTexture.id = rlLoadTexture(nullptr, CLUSTER_TEX_WIDTH, CLUSTER_TEX_HEIGHT, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, 1);
+        m_clusterTexture.width = CLUSTER_TEX_WIDTH;
+        m_clusterTexture.height = CLUSTER_TEX_HEIGHT;
+        m_clusterTexture.mipmaps = 1;
+        m_clusterTexture.format = PIXELFORMAT_UNCOMPRESSED_R32G32B32A32;
+        // 浮点纹理在 WebGL2 下不可线性过滤, 着色器只用 texelFetch
+        SetTextureFilter(m_clusterTexture, TEXTURE_FILTER_POINT);
+        m_clusterTexData.assign(CLUSTER_TEX_WIDTH * CLUSTER_TEX_HEIGHT * 4, 0.0f);
+    }
+
+    float *data = m_clusterTexData.data();
+    for (size_t i = 0; i < m_clusterLights.size(); i++)
+    {
+        const ClusterLight &light = m_clusterLights[i];
+        float *texel = data + i * 2 * 4;
+        texel[0] = light.position.x();
+        texel[1] = light.position.y();
+        texel[2] = light.position.z();
+        texel[3] = light.range;
+        texel[4] = light.color.x();
+        texel[5] = light.color.y();
+        texel[6] = light.color.z();
+        texel[7] = light.intensity;
+    }
+
+    const auto &offsets = m_clusterGrid.GetOffsets();
+    const auto &counts = m_clusterGrid.GetCounts();
+    for (int c = 0; c < CLUSTER_COUNT; c++)
+    {
+        float *texel = data + (CLUSTER_HEADER_BASE + c) * 4;
+        texel[0] = (float)offsets[c];
+        texel[1] = (float)counts[c];
+    }
+
+    const auto &indices = m_clusterGrid.GetIndices();
+    float *indexData = data + CLUSTER_INDEX_BASE * 4;
+    for (size_t i = 0; i < indices.size(); i++)
+        indexData[i] = (float)indices[i];
+
+    // 只上传用到的行
+    const int usedTexels = CLUSTER_INDEX_BASE + (int)(indices.size() + 3) / 4;
+    const int rows = (usedTexels + CLUSTER_TEX_WIDTH - 1) / CLUSTER_TEX_WIDTH;
+    rlUpdateTexture(m_clusterTexture.id, 0, 0, CLUSTER_TEX_WIDTH, rows, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, data);
 }
 
 void LightingManager::InitShadowMaps(int width, int height, ResourceManager &rm)
@@ -216,7 +341,7 @@ void LightingManager::InitShadowMaps(int width, int height, ResourceManager &rm)
     m_pointDepthShader = rm.GetShader("assets/shaders/lighting/point_depth.vs", "assets/shaders/lighting/point_depth.fs");
 }
 
-void LightingManager::RenderShadowMaps(GameWorld &world, const Vector3f &centerPos)
+void LightingManager::RenderShadowMaps(RenderQueue &queue, const Vector3f &centerPos)
 {
     if (!m_depthShader)
         return;
@@ -226,25 +351,21 @@ void LightingManager::RenderShadowMaps(GameWorld &world, const Vector3f &centerP
     rlEnableDepthTest();
     rlEnableDepthMask();
 
-    auto renderables = world.GetEntitiesWith<RenderComponent, TransformComponent>();
-
     for (auto &caster : m_activeCasters)
     {
         caster.lightVP = CalculateDirectionalLightVP(caster.lightDir, centerPos);
+        const auto &drawList = queue.CullView("dir" + std::to_string(caster.textureIndex), caster.lightVP, true);
 
         BeginTextureMode(m_shadowMaps[caster.textureIndex]);
         ClearBackground(WHITE);
 
         m_depthShader->Begin();
         m_depthShader->SetMat4("lightVP", caster.lightVP);
-        for (auto *obj : renderables)
+        for (uint32_t index : drawList)
         {
-
-            auto &render = obj->GetComponent<RenderComponent>();
-            auto &tf = obj->GetComponent<TransformComponent>();
-            if (!render.castShadows)
-                continue;
-            Matrix4f modelMat = tf.GetWorldMatrix();
+            const RenderItem &item = queue.GetItem(index);
+            const auto &render = *item.render;
+            const Matrix4f &modelMat = item.model;
             m_depthShader->SetMat4("model", modelMat);
 
             for (int i = 0; i < render.model.meshCount; i++)
@@ -271,6 +392,7 @@ void LightingManager::RenderShadowMaps(GameWorld &world, const Vector3f &centerP
 
         Vector3 dirs[6] = {{1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}};
         Vector3 ups[6] = {{0, -1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}, {0, -1, 0}, {0, -1, 0}};
+        const char *faceNames[6] = {"+X", "-X", "+Y", "-Y", "+Z", "-Z"};
         for (int i = 0; i < m_activePointCasters.size(); ++i)
         {
             auto &caster = m_activePointCasters[i];
@@ -308,13 +430,14 @@ void LightingManager::RenderShadowMaps(GameWorld &world, const Vector3f &centerP
 
                     m_pointDepthShader->SetMat4("lightVP", Matrix4f(matVP));
 
-                    for (auto *obj : renderables)
+                    // 每个面单独剔除, 光源自身不投影
+                    const auto &drawList = queue.CullView("point" + std::to_string(i) + faceNames[face],
+                                                          Matrix4f(matVP), true, caster.owner);
+                    for (uint32_t index : drawList)
                     {
-                        auto &render = obj->GetComponent<RenderComponent>();
-                        auto &tf = obj->GetComponent<TransformComponent>();
-                        if (!render.castShadows || obj == caster.owner)
-                            continue;
-                        Matrix4f modelMat = tf.GetWorldMatrix();
+                        const RenderItem &item = queue.GetItem(index);
+                        const auto &render = *item.render;
+                        const Matrix4f &modelMat = item.model;
 
                         m_pointDepthShader->SetMat4("model", modelMat);
 
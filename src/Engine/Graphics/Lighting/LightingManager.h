@@ -1,25 +1,47 @@
 #pragma once
 #include "Engine/Graphics/ShaderWrapper.h"
 #include "Engine/Core/Components/Components.h"
+#include "LightClusterGrid.h"
 #include <vector>
 
 #define MAX_LIGHTS 16
 #define MAX_SHADOW_CASTERS 6
 #define MAX_POINT_SHADOWS 6
 
+// 分簇数据纹理 (RGBA32F, 按下标线性排布, 与 lighting.fs 一致):
+// [光源记录: 每个 2 texel][簇头: 每簇 1 texel (offset, count)][下标: 每 texel 4 个]
+#define CLUSTER_TEX_WIDTH 1024
+#define CLUSTER_HEADER_BASE (2 * MAX_CLUSTERED_LIGHTS)
+#define CLUSTER_INDEX_BASE (CLUSTER_HEADER_BASE + CLUSTER_COUNT)
+#define CLUSTER_TEX_HEIGHT ((CLUSTER_INDEX_BASE + MAX_CLUSTER_INDICES / 4 + CLUSTER_TEX_WIDTH - 1) / CLUSTER_TEX_WIDTH)
+
 class GameWorld;
+class RenderQueue;
 class LightingManager
 {
 public:
     ~LightingManager();
     void Update(GameWorld &world);
-    void UploadToShader(std::shared_ptr<ShaderWrapper> shader, const Vector3f &viewPos, int texUnit);
+    // 光源参数与阴影矩阵属于 program 状态: 每个 shader 每视图上传一次即可
+    void UploadLights(ShaderWrapper &shader, const Vector3f &viewPos);
+    // 阴影贴图接在材质贴图之后的纹理单元, 每次绘制都要绑定
+    void BindShadowMaps(ShaderWrapper &shader, int texUnit);
 
     void InitShadowMaps(int width, int height, ResourceManager &rm);
-    void RenderShadowMaps(GameWorld &world, const Vector3f &centerPos);
+    // 只绘制落在各光源视锥内的投影对象
+    void RenderShadowMaps(RenderQueue &queue, const Vector3f &centerPos);
 
     RenderTexture2D *GetShadowMap(int index);
 
+    // 分簇前向光照: 平行光与投影光源仍走 lights[],
+    // 其余点光源 (最多 MAX_CLUSTERED_LIGHTS) 按视图分簇, 片元只遍历所在簇的光源
+    void SetClusteredLighting(bool enabled) { m_clustered = enabled; }
+    bool IsClusteredLighting() const { return m_clustered; }
+    // 每个视图绘制前调用, 重新分簇并上传数据纹理
+    void BuildClusters(const Matrix4f &view, const Matrix4f &proj, float nearPlane, float farPlane);
+    // 最近一次 BuildClusters 的统计
+    const LightClusterGrid::Stats &GetClusterStats() const { return m_clusterGrid.GetStats(); }
+
 private:
     struct ShadowCasterData
     {
@@ -51,8 +73,30 @@ private:
 
     std::vector<LightInfo> m_activeLights;
 
+    // uniform 名预先驻留为 UniformID, 上传时按下标设置
+    struct LightUniformIDs
+    {
+        UniformID type, position, direction, color, intensity, range, shadowIndex, shadowBias;
+    };
+    std::vector<LightUniformIDs> m_lightIDs;
+    std::vector<UniformID> m_lightVPIDs;
+    std::vector<UniformID> m_shadowMapIDs;
+    std::vector<UniformID> m_pointShadowMapIDs;
+    UniformID m_lightCountsID;
+    UniformID m_viewPosID;
+    UniformID m_useClustersID;
+    UniformID m_clusterParamsID;
+    UniformID m_clusterDataID;
+    void ResolveUniformIDs();
+
     std::vector<ShadowCasterData> m_activeCasters;
     std::vector<ShadowCasterData> m_activePointCasters;
 
+    bool m_clustered = false;
+    std::vector<ClusterLight> m_clusterLights;
+    LightClusterGrid m_clusterGrid;
+    Texture2D m_clusterTexture = {};
+    std::vector<float> m_clusterTexData;
+
     Matrix4f CalculateDirectionalLightVP(const Vector3f &lightDir, const Vector3f &centerPos);
 };
\ No newline at end of file
@@ -223,21 +223,13 @@ void ParticleEmitter::RenderSignlePass(size_t passIndex, const RenderMaterial &p
         pass.shader->SetTexture("dataTex", m_dataTexture, texUnit++);
         pass.shader->SetInt("maxParticles", m_maxParticles);
 
-        for (const auto &[name, texture] : pass.customTextures)
+        for (const auto &tex : pass.textureUniforms)
         {
-            if (texture.id > 0)
+            if (tex.texture.id > 0)
             {
-                pass.shader->SetTexture(name, texture, texUnit);
-                if (pass.isAnimated.at(name))
-                {
-                    pass.shader->SetInt(name + "_frameCount", pass.frameCount.at(name));
-                    pass.shader->SetFloat(name + "_animSpeed", pass.animSpeed.at(name));
-                }
-                else
-                {
-                    pass.shader->SetInt(name + "_frameCount", 1);
-                    pass.shader->SetFloat(name + "_animSpeed", 0.0f);
-                }
+                pass.shader->SetTexture(tex.sampler, tex.texture, texUnit);
+                pass.shader->SetInt(tex.frameCount, tex.frames);
+                pass.shader->SetFloat(tex.animSpeed, tex.speed);
 
                 texUnit++;
             }
@@ -108,7 +108,7 @@ void ParticleSystem::InternalSpawn(const std::string &effectName, const Particle
 
 void ParticleSystem::Update(GameWorld &gameWorld, float dt)
 {
-    auto entities = gameWorld.GetEntitiesWith<ParticleEmitterComponent, TransformComponent>();
+    const auto &entities = gameWorld.GetEntitiesWith<ParticleEmitterComponent, TransformComponent>();
     // 实体携带粒子
     for (auto *entity : entities)
     {
@@ -196,7 +196,7 @@ void ParticleSystem::Render(std::unordered_map<std::string, RenderTexture2D> &RT
 
     auto &sceneDepth = RTPool["inScreen"].depth;
 
-    auto entities = gameWorld.GetEntitiesWith<ParticleEmitterComponent, TransformComponent>();
+    const auto &entities = gameWorld.GetEntitiesWith<ParticleEmitterComponent, TransformComponent>();
     for (auto *entity : entities)
     {
         auto &ec = entity->GetComponent<ParticleEmitterComponent>();
@@ -7,6 +7,8 @@
 #include "Engine/Utils/JsonParser.h"
 #include <unordered_map>
 #include <string>
+#include <utility>
+#include <vector>
 #include <nlohmann/json.hpp>
 using json = nlohmann::json;
 
@@ -47,6 +49,55 @@ struct RenderMaterial
     std::unordered_map<std::string, Vector3f> customVector3;
     std::unordered_map<std::string, Vector4f> customVector4;
 
+    // 加载后解析好的 uniform 句柄, 绘制时不再拼接/查找字符串
+    struct TextureUniform
+    {
+        UniformID sampler;
+        UniformID frameCount; // <name>_frameCount
+        UniformID animSpeed;  // <name>_animSpeed
+        Texture2D texture = {0};
+        int frames = 1;
+        float speed = 0.0f;
+    };
+    std::vector<TextureUniform> textureUniforms;
+    std::vector<std::pair<UniformID, float>> floatUniforms;
+    std::vector<std::pair<UniformID, Vector2f>> vector2Uniforms;
+    std::vector<std::pair<UniformID, Vector3f>> vector3Uniforms;
+    std::vector<std::pair<UniformID, Vector4f>> vector4Uniforms;
+
+    // 修改 custom* 表之后需要重新调用
+    void ResolveUniformIDs()
+    {
+        textureUniforms.clear();
+        for (auto const &[name, tex] : customTextures)
+        {
+            TextureUniform &u = textureUniforms.emplace_back();
+            u.sampler = ShaderWrapper::Intern(name);
+            u.frameCount = ShaderWrapper::Intern(name + "_frameCount");
+            u.animSpeed = ShaderWrapper::Intern(name + "_animSpeed");
+            u.texture = tex;
+            auto animated = isAnimated.find(name);
+            if (animated != isAnimated.end() && animated->second)
+            {
+                u.frames = frameCount.at(name);
+                u.speed = animSpeed.at(name);
+            }
+        }
+
+        floatUniforms.clear();
+        for (auto const &[name, value] : customFloats)
+            floatUniforms.emplace_back(ShaderWrapper::Intern(name), value);
+        vector2Uniforms.clear();
+        for (auto const &[name, value] : customVector2)
+            vector2Uniforms.emplace_back(ShaderWrapper::Intern(name), value);
+        vector3Uniforms.clear();
+        for (auto const &[name, value] : customVector3)
+            vector3Uniforms.emplace_back(ShaderWrapper::Intern(name), value);
+        vector4Uniforms.clear();
+        for (auto const &[name, value] : customVector4)
+            vector4Uniforms.emplace_back(ShaderWrapper::Intern(name), value);
+    }
+
     void LoadFromConfig(const json &config, ResourceManager &rm)
     {
 
@@ -154,5 +205,6 @@ struct RenderMaterial
                     std::cerr << "[RenderMaterial]: Unknown uniform type: " << uName << std::endl;
             }
         }
+        ResolveUniformIDs();
     }
 };
@@ -0,0 +1,145 @@
+#include "RenderQueue.h"
+#include "Engine/Core/GameWorld.h"
+#include "Engine/Core/Components/Components.h"
+#include "raylib.h"
+
+#include <cmath>
+
+namespace
+{
+    // 各 mesh 包围盒的并集; 绘制时只用对象矩阵, 不含 model.transform
+    BoundingBox ComputeLocalBounds(const Model &model)
+    {
+        BoundingBox box = GetMeshBoundingBox(model.meshes[0]);
+        for (int i = 1; i < model.meshCount; i++)
+        {
+            BoundingBox meshBox = GetMeshBoundingBox(model.meshes[i]);
+            box.min = {std::fmin(box.min.x, meshBox.min.x), std::fmin(box.min.y, meshBox.min.y), std::fmin(box.min.z, meshBox.min.z)};
+            box.max = {std::fmax(box.max.x, meshBox.max.x), std::fmax(box.max.y, meshBox.max.y), std::fmax(box.max.z, meshBox.max.z)};
+        }
+        return box;
+    }
+
+    // 中心/半长变换, 比变换 8 个角点便宜
+    AABB TransformBounds(const BoundingBox &local, const Matrix4f &m)
+    {
+        float c[3], e[3];
+        c[0] = (local.min.x + local.max.x) * 0.5f;
+        c[1] = (local.min.y + local.max.y) * 0.5f;
+        c[2] = (local.min.z + local.max.z) * 0.5f;
+        e[0] = (local.max.x - local.min.x) * 0.5f;
+        e[1] = (local.max.y - local.min.y) * 0.5f;
+        e[2] = (local.max.z - local.min.z) * 0.5f;
+
+        float wc[3], we[3];
+        for (int i = 0; i < 3; i++)
+        {
+            wc[i] = m(i, 3);
+            we[i] = 0.0f;
+            for (int j = 0; j < 3; j++)
+            {
+                wc[i] += m(i, j) * c[j];
+                we[i] += std::fabs(m(i, j)) * e[j];
+            }
+        }
+        return AABB(Vector3f(wc[0] - we[0], wc[1] - we[1], wc[2] - we[2]),
+                    Vector3f(wc[0] + we[0], wc[1] + we[1], wc[2] + we[2]));
+    }
+}
+
+Frustum Frustum::FromViewProjection(const Matrix4f &viewProj)
+{
+    // Gribb-Hartmann: -w <= x,y,z <= w
+    const Vector4f r0 = viewProj.getRow(0);
+    const Vector4f r1 = viewProj.getRow(1);
+    const Vector4f r2 = viewProj.getRow(2);
+    const Vector4f r3 = viewProj.getRow(3);
+
+    Frustum f;
+    f.planes[0] = r3 + r0; // 左
+    f.planes[1] = r3 - r0; // 右
+    f.planes[2] = r3 + r1; // 下
+    f.planes[3] = r3 - r1; // 上
+    f.planes[4] = r3 + r2; // 近
+    f.planes[5] = r3 - r2; // 远
+    return f;
+}
+
+bool Frustum::Intersects(const AABB &box) const
+{
+    const float cx = (box.min.x() + box.max.x()) * 0.5f;
+    const float cy = (box.min.y() + box.max.y()) * 0.5f;
+    const float cz = (box.min.z() + box.max.z()) * 0.5f;
+    const float ex = (box.max.x() - box.min.x()) * 0.5f;
+    const float ey = (box.max.y() - box.min.y()) * 0.5f;
+    const float ez = (box.max.z() - box.min.z()) * 0.5f;
+
+    for (const Vector4f &p : planes)
+    {
+        const float dist = p.x() * cx + p.y() * cy + p.z() * cz + p.w();
+        const float radius = std::fabs(p.x()) * ex + std::fabs(p.y()) * ey + std::fabs(p.z()) * ez;
+        if (dist + radius < 0.0f)
+            return false;
+    }
+    return true;
+}
+
+void RenderQueue::Gather(GameWorld &world)
+{
+    m_items.clear();
+    m_viewStats.clear();
+    m_usedLists = 0;
+
+    for (GameObject *gameObject : world.GetActivateGameObjects())
+    {
+        if (!gameObject->HasComponent<TransformComponent>() || !gameObject->HasComponent<RenderComponent>())
+            continue;
+        auto &render = gameObject->GetComponent<RenderComponent>();
+        if (!render.isVisible || render.model.meshCount <= 0 || render.model.meshes == nullptr)
+            continue;
+        auto &tf = gameObject->GetComponent<TransformComponent>();
+
+        if (render.localBoundsSource != render.model.meshes)
+        {
+            render.localBounds = ComputeLocalBounds(render.model);
+            render.localBoundsSource = render.model.meshes;
+        }
+
+        RenderItem &item = m_items.emplace_back();
+        item.object = gameObject;
+        item.transform = &tf;
+        item.render = &render;
+        // 直接使用缓存的世界矩阵, 不再逐对象分解旋转/缩放
+        item.model = tf.GetWorldMatrix() * Matrix4f(Matrix3f(render.scale));
+        item.worldBounds = TransformBounds(render.localBounds, item.model);
+    }
+}
+
+const std::vector<uint32_t> &RenderQueue::CullView(const std::string &name, const Matrix4f &viewProj,
+                                                   bool shadowPass, const GameObject *exclude)
+{
+    if (m_usedLists == m_drawLists.size())
+        m_drawLists.emplace_back();
+    std::vector<uint32_t> &list = m_drawLists[m_usedLists++];
+    list.clear();
+
+    const Frustum frustum = Frustum::FromViewProjection(viewProj);
+    uint32_t culled = 0;
+    for (uint32_t i = 0; i < (uint32_t)m_items.size(); i++)
+    {
+        const RenderItem &item = m_items[i];
+        if (item.object == exclude || (shadowPass && !item.render->castShadows))
+            continue;
+        if (frustum.Intersects(item.worldBounds))
+            list.push_back(i);
+        else
+            culled++;
+    }
+
+    ViewStats &stats = m_viewStats.emplace_back();
+    stats.name = name;
+    stats.shadow = shadowPass;
+    stats.submitted = (uint32_t)list.size();
+    stats.culled = culled;
+    return list;
+}
@@ -0,0 +1,89 @@
+#pragma once
+#include "Engine/Math/Math.h"
+#include "Engine/Core/Components/Components.h"
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+class GameWorld;
+class GameObject;
+
+// 每帧收集一次的可渲染对象, 所有视图/阴影通道共用
+struct RenderItem
+{
+    GameObject *object = nullptr;
+    TransformComponent *transform = nullptr;
+    RenderComponent *render = nullptr;
+    Matrix4f model;   // 世界矩阵 * 渲染缩放
+    AABB worldBounds; // 世界空间包围盒
+};
+
+// 由 VP 矩阵提取的 6 个裁剪面 (列向量约定: clip = VP * p), 法线朝内
+struct Frustum
+{
+    Vector4f planes[6];
+
+    static Frustum FromViewProjection(const Matrix4f &viewProj);
+    // 包围盒完全在某个面外侧时返回 false
+    bool Intersects(const AABB &box) const;
+};
+
+// 一次 mesh-pass 绘制. key 决定排序:
+// 不透明: [0][pass 序号][shader][混合/深度/剔除状态][材质贴图][mesh], 按状态聚合
+// 混合或不写/不测深度的 pass 依赖绘制顺序: [1][提交序号], 保持原顺序
+struct DrawCommand
+{
+    uint64_t key = 0;
+    uint32_t item = 0; // RenderItem 下标
+    int mesh = 0;
+    const RenderMaterial *pass = nullptr;
+
+    static uint64_t MakeKey(const RenderMaterial &pass, int passIndex, const Mesh &mesh, uint32_t sequence)
+    {
+        const bool ordered = pass.blendMode != BLEND_OPIQUE || !pass.depthTest || !pass.depthWrite;
+        if (ordered)
+            return (1ull << 63) | ((uint64_t)sequence << 31);
+
+        // 同一 mesh 的多个 pass 仍按 pass 序号先后绘制
+        const uint64_t passBits = (uint64_t)(passIndex < 7 ? passIndex : 7);
+        const uint64_t shaderBits = pass.shader ? (pass.shader->GetShader().id & 0xFFFF) : 0;
+        const uint64_t stateBits = (uint64_t)((pass.cullFace + 1) & 0x3);
+        const uint64_t materialBits = pass.useDiffuseMap ? (pass.diffuseMap.id & 0xFFFF) : 0;
+        const uint64_t meshBits = mesh.vaoId & 0xFFFFF;
+        return (passBits << 60) | (shaderBits << 44) | (stateBits << 36) | (materialBits << 20) | meshBits;
+    }
+    bool operator<(const DrawCommand &other) const { return key < other.key; }
+};
+
+// CPU 渲染队列: Gather 收集本帧的可渲染对象并计算世界包围盒,
+// CullView 按相机/光源视锥剔除, 结果压缩为该视图的绘制列表 (RenderItem 下标)
+class RenderQueue
+{
+public:
+    struct ViewStats
+    {
+        std::string name;
+        bool shadow = false;
+        uint32_t submitted = 0; // 通过剔除, 实际提交绘制
+        uint32_t culled = 0;
+    };
+
+    void Gather(GameWorld &world);
+
+    // 返回的列表在下一次 Gather 前有效
+    const std::vector<uint32_t> &CullView(const std::string &name, const Matrix4f &viewProj,
+                                          bool shadowPass = false, const GameObject *exclude = nullptr);
+
+    const RenderItem &GetItem(uint32_t index) const { return m_items[index]; }
+    const std::vector<RenderItem> &GetItems() const { return m_items; }
+    // 本帧各视图的统计, 阴影通道的点光源每个面单独一项
+    const std::vector<ViewStats> &GetViewStats() const { return m_viewStats; }
+
+private:
+    std::vector<RenderItem> m_items;
+    // deque: 追加新列表时已返回的引用不失效; 列表逐帧复用, 不再分配
+    std::deque<std::vector<uint32_t>> m_drawLists;
+    size_t m_usedLists = 0;
+    std::vector<ViewStats> m_viewStats;
+};
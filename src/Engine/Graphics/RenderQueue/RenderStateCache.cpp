@@ -0,0 +1,130 @@
+#include "RenderStateCache.h"
+#include "rlgl.h"
+
+void RenderStateCache::Begin()
+{
+    // 从已知状态开始, 之后只做增量切换
+    rlEnableColorBlend();
+    rlSetBlendMode(BLEND_ALPHA);
+    rlEnableDepthTest();
+    rlEnableDepthMask();
+    rlDisableBackfaceCulling();
+    rlSetCullFace(RL_CULL_FACE_BACK);
+
+    m_shader = nullptr;
+    m_blendMode = BLEND_ALPHA;
+    m_depthTest = true;
+    m_depthWrite = true;
+    m_cullFace = -1;
+}
+
+void RenderStateCache::End()
+{
+    if (m_shader != nullptr)
+    {
+        m_shader->End();
+        m_shader = nullptr;
+    }
+    rlEnableColorBlend();
+    rlSetBlendMode(BLEND_ALPHA);
+    rlEnableDepthTest();
+    rlEnableDepthMask();
+    rlDisableBackfaceCulling();
+    rlSetCullFace(RL_CULL_FACE_BACK);
+}
+
+void RenderStateCache::ApplyShader(ShaderWrapper &shader)
+{
+    if (m_shader == &shader)
+        return;
+    shader.Begin();
+    m_shader = &shader;
+    m_stats.shaderBinds++;
+}
+
+void RenderStateCache::ApplyPassState(const RenderMaterial &pass)
+{
+    SetBlendMode(pass.blendMode);
+    SetCullFace(pass.cullFace);
+    SetDepthTest(pass.depthTest);
+    SetDepthWrite(pass.depthWrite);
+}
+
+void RenderStateCache::SetBlendMode(int blendMode)
+{
+    if (m_blendMode == blendMode)
+        return;
+    m_stats.stateChanges++;
+
+    if (blendMode == BLEND_OPIQUE)
+    {
+        rlDisableColorBlend();
+        m_blendMode = blendMode;
+        return;
+    }
+    if (m_blendMode == BLEND_OPIQUE)
+        rlEnableColorBlend();
+    m_blendMode = blendMode;
+
+    // 自定义混合: 先设因子再切换模式, rlgl 在切到 BLEND_CUSTOM 时才应用因子
+    switch (blendMode)
+    {
+    case BLEND_MULTIPLIED:
+        rlSetBlendFactors(RL_DST_COLOR, RL_ZERO, RL_FUNC_ADD);
+        rlSetBlendMode(BLEND_CUSTOM);
+        break;
+    case BLEND_SCREEN:
+        rlSetBlendFactors(RL_ONE, RL_ONE_MINUS_SRC_COLOR, RL_FUNC_ADD);
+        rlSetBlendMode(BLEND_CUSTOM);
+        break;
+    case BLEND_SUBTRACT:
+        rlSetBlendFactors(RL_ONE, RL_ONE, RL_FUNC_REVERSE_SUBTRACT);
+        rlSetBlendMode(BLEND_CUSTOM);
+        break;
+    default:
+        rlSetBlendMode(blendMode);
+        break;
+    }
+}
+
+void RenderStateCache::SetDepthTest(bool enabled)
+{
+    if (m_depthTest == enabled)
+        return;
+    m_stats.stateChanges++;
+    m_depthTest = enabled;
+    if (enabled)
+        rlEnableDepthTest();
+    else
+        rlDisableDepthTest();
+}
+
+void RenderStateCache::SetDepthWrite(bool enabled)
+{
+    if (m_depthWrite == enabled)
+        return;
+    m_stats.stateChanges++;
+    m_depthWrite = enabled;
+    if (enabled)
+        rlEnableDepthMask();
+    else
+        rlDisableDepthMask();
+}
+
+void RenderStateCache::SetCullFace(int cullFace)
+{
+    if (m_cullFace == cullFace)
+        return;
+    m_stats.stateChanges++;
+    if (cullFace < 0)
+    {
+        rlDisableBackfaceCulling();
+    }
+    else
+    {
+        if (m_cullFace < 0)
+            rlEnableBackfaceCulling();
+        rlSetCullFace(cullFace);
+    }
+    m_cullFace = cullFace;
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include "Engine/Graphics/RenderMaterial.h"
+#include <cstdint>
+
+// 记录当前的混合/深度/剔除状态与 shader, 只在与上一次绘制不同时才调用 rlgl
+// 在 Begin/End 之间使用; End 恢复场景其余部分依赖的默认状态
+class RenderStateCache
+{
+public:
+    struct Stats
+    {
+        uint32_t drawCalls = 0;       // 含实例化绘制
+        uint32_t instancedDraws = 0;
+        uint32_t instances = 0;       // 实例化绘制合并的对象数
+        uint32_t shaderBinds = 0;
+        uint32_t stateChanges = 0;    // 混合/深度/剔除状态的实际切换
+        uint32_t frameUploads = 0;    // 每视图 uniform 块上传次数
+        uint32_t materialUploads = 0; // 材质 uniform 上传次数
+    };
+
+    void Begin();
+    void End();
+
+    void ApplyShader(ShaderWrapper &shader);
+    void ApplyPassState(const RenderMaterial &pass);
+
+    // 每帧开头清零
+    void ResetStats() { m_stats = Stats(); }
+    Stats &GetStats() { return m_stats; }
+    const Stats &GetStats() const { return m_stats; }
+
+private:
+    void SetBlendMode(int blendMode);
+    void SetDepthTest(bool enabled);
+    void SetDepthWrite(bool enabled);
+    void SetCullFace(int cullFace);
+
+    const ShaderWrapper *m_shader = nullptr;
+    int m_blendMode = 0;
+    bool m_depthTest = true;
+    bool m_depthWrite = true;
+    int m_cullFace = -1;
+
+    Stats m_stats;
+};
@@ -10,11 +10,94 @@
 #include <nlohmann/json.hpp>
 #include <fstream>
 #include <iostream>
+#include <algorithm>
 #include <memory>
 using json = nlohmann::json;
 
 #define M_PI 3.14159265358979323846
 
+namespace
+{
+    // 少于这个数量的相同绘制不值得走实例化(上传实例缓冲 + 额外的 VAO 属性设置)
+    constexpr size_t MIN_INSTANCED_BATCH = 4;
+
+    // 绘制热路径用到的内置 uniform, 启动时驻留一次
+    const UniformID U_MAT_PROJ = ShaderWrapper::Intern("matProj");
+    const UniformID U_MAT_VIEW = ShaderWrapper::Intern("matView");
+    const UniformID U_REAL_TIME = ShaderWrapper::Intern("realTime");
+    const UniformID U_GAME_TIME = ShaderWrapper::Intern("gameTime");
+    const UniformID U_VP = ShaderWrapper::Intern("u_vp");
+    const UniformID U_MVP = ShaderWrapper::Intern("u_mvp");
+    const UniformID U_TRANSFORM = ShaderWrapper::Intern("transform");
+    const UniformID U_TOTAL_BASE_COLOR = ShaderWrapper::Intern("totalBaseColor");
+    const UniformID U_BASE_COLOR = ShaderWrapper::Intern("baseColor");
+    const UniformID U_EMISSIVE_COLOR = ShaderWrapper::Intern("emissiveColor");
+    const UniformID U_EMISSIVE_INTENSITY = ShaderWrapper::Intern("emissiveIntensity");
+    const UniformID U_DIFFUSE_MAP = ShaderWrapper::Intern("u_diffuseMap");
+    const UniformID U_DIFFUSE_FRAME_COUNT = ShaderWrapper::Intern("u_diffuseMap_frameCount");
+    const UniformID U_DIFFUSE_ANIM_SPEED = ShaderWrapper::Intern("u_diffuseMap_animSpeed");
+    const UniformID U_SKYBOX_MAP = ShaderWrapper::Intern("skyboxMap");
+
+    template <typename Map, typename Equal>
+    bool SameEntries(const Map &a, const Map &b, Equal equal)
+    {
+        if (a.size() != b.size())
+            return false;
+        for (const auto &[name, value] : a)
+        {
+            auto it = b.find(name);
+            if (it == b.end() || !equal(value, it->second))
+                return false;
+        }
+        return true;
+    }
+
+    // 同一预制体生成的对象各有一份材质拷贝, 按内容判断能否共用一次绘制
+    bool SameMaterial(const RenderMaterial &a, const RenderMaterial &b)
+    {
+        if (&a == &b)
+            return true;
+        auto sameFloat = [](float x, float y)
+        { return x == y; };
+        auto sameInt = [](int x, int y)
+        { return x == y; };
+        auto sameBool = [](bool x, bool y)
+        { return x == y; };
+        return a.shader == b.shader && a.blendMode == b.blendMode && a.depthTest == b.depthTest &&
+               a.depthWrite == b.depthWrite && a.cullFace == b.cullFace &&
+               a.useDiffuseMap == b.useDiffuseMap && a.diffuseMap.id == b.diffuseMap.id &&
+               a.diffuseIsAnimated == b.diffuseIsAnimated && a.diffuseframeCount == b.diffuseframeCount &&
+               a.diffuseanimSpeed == b.diffuseanimSpeed &&
+               a.baseColor == b.baseColor && a.emissiveColor == b.emissiveColor &&
+               a.emissiveIntensity == b.emissiveIntensity &&
+               SameEntries(a.customFloats, b.customFloats, sameFloat) &&
+               SameEntries(a.customVector2, b.customVector2, [](const Vector2f &x, const Vector2f &y)
+                           { return x.x() == y.x() && x.y() == y.y(); }) &&
+               SameEntries(a.customVector3, b.customVector3, [](const Vector3f &x, const Vector3f &y)
+                           { return x == y; }) &&
+               SameEntries(a.customVector4, b.customVector4, [](const Vector4f &x, const Vector4f &y)
+                           { return x == y; }) &&
+               SameEntries(a.customTextures, b.customTextures, [](const Texture2D &x, const Texture2D &y)
+                           { return x.id == y.id; }) &&
+               SameEntries(a.isAnimated, b.isAnimated, sameBool) &&
+               SameEntries(a.frameCount, b.frameCount, sameInt) &&
+               SameEntries(a.animSpeed, b.animSpeed, sameFloat);
+    }
+
+    // 只合并不透明命令: 混合命令需保持提交顺序
+    bool CanInstanceTogether(const RenderQueue &queue, const DrawCommand &a, const DrawCommand &b)
+    {
+        if (a.key != b.key || (a.key >> 63) != 0)
+            return false;
+        const Model &modelA = queue.GetItem(a.item).render->model;
+        const Model &modelB = queue.GetItem(b.item).render->model;
+        const Mesh *meshA = &modelA.meshes[a.mesh];
+        if (meshA != &modelB.meshes[b.mesh] || meshA->vaoId == 0)
+            return false;
+        return SameMaterial(*a.pass, *b.pass);
+    }
+}
+
 void Renderer::Init(const std::string &configViewPath, GameWorld &gameWorld)
 {
     m_postProcesser = std::make_unique<PostProcesser>();
@@ -46,6 +129,9 @@ bool Renderer::LoadViewConfig(const std::string &configPath, GameWorld &gameWorl
             m_renderViewer->ParseViewConfig(data["views"]);
         if (data.contains("postProcess"))
             m_postProcesser->ParsePostProcessPasses(data["postProcess"], gameWorld);
+        // 分簇光照默认关闭, 由视图配置 lighting.clustered 显式开启; 未配置的视图不沿用上一个视图的设置
+        bool clustered = data.contains("lighting") && data["lighting"].value("clustered", false);
+        m_lightingManager->SetClusteredLighting(clustered);
         return true;
     }
     catch (std::exception &e)
@@ -82,6 +168,8 @@ Renderer::Renderer()
 Renderer::~Renderer()
 {
     // rlUnloadTexture(m_dummyDepth.id);
+    if (m_instanceVbo != 0)
+        rlUnloadVertexBuffer(m_instanceVbo);
 }
 // void Renderer::CopyDepthBuffer(RenderTexture2D sourceRT, Texture2D targetDepth)
 // {
@@ -158,7 +246,7 @@ void Renderer::RawRenderScene(GameWorld &gameWorld, CameraManager &cameraManager
                     m_skybox->Draw(rawCamera, aspect);
                 }
 
-                DrawWorldObjects(gameWorld, rawCamera, *camera, aspect);
+                DrawWorldObjects(gameWorld, view.cameraName, rawCamera, *camera, aspect);
 
                 // debug
                 for (const auto &view1 : m_renderViewer->GetRenderViews())
@@ -248,10 +336,15 @@ void Renderer::RenderScene(GameWorld &gameWorld, CameraManager &cameraManager)
         return;
     }
 
+    // 每帧收集一次, 相机视图与阴影通道共用
+    m_renderQueue.Gather(gameWorld);
+    m_stateCache.ResetStats();
+    ShaderWrapper::GetUniformStats() = ShaderWrapper::UniformStats();
+
     if (m_lightingManager)
     {
         m_lightingManager->Update(gameWorld);
-        m_lightingManager->RenderShadowMaps(gameWorld, cameraManager.GetMainCamera()->Position());
+        m_lightingManager->RenderShadowMaps(m_renderQueue, cameraManager.GetMainCamera()->Position());
     }
 
     RawRenderScene(gameWorld, cameraManager);
@@ -274,7 +367,7 @@ void Renderer::RenderScene(GameWorld &gameWorld, CameraManager &cameraManager)
                    {0, 0}, 0, WHITE);
 }
 
-void Renderer::DrawWorldObjects(GameWorld &world, Camera3D &rawCamera, mCamera &camera, float aspect)
+void Renderer::DrawWorldObjects(GameWorld &world, const std::string &viewName, Camera3D &rawCamera, mCamera &camera, float aspect)
 {
     Matrix4f matView = GetCameraMatrix(rawCamera);
     Matrix4f matProj;
@@ -290,56 +383,92 @@ void Renderer::DrawWorldObjects(GameWorld &world, Camera3D &rawCamera, mCamera &
     }
     Matrix4f VP = matProj * matView;
 
-    for (const auto *gameObject : world.GetActivateGameObjects())
+    const auto &drawList = m_renderQueue.CullView(viewName, VP);
+    m_lightingManager->BuildClusters(matView, matProj, camera.getNearPlane(), camera.getFarPlane());
+
+    FrameUniforms frame;
+    frame.stamp = ++m_frameStamp;
+    frame.matProj = matProj;
+    frame.matView = matView;
+    frame.VP = VP;
+    frame.viewPos = camera.Position();
+    frame.realTime = world.GetTimeManager().GetRealTime();
+    frame.gameTime = world.GetTimeManager().GetGameTime();
+
+    // 展开为 mesh-pass 绘制命令, 按状态排序后再提交
+    m_drawCommands.clear();
+    uint32_t sequence = 0;
+    for (uint32_t index : drawList)
     {
-        if (gameObject->HasComponent<TransformComponent>() && gameObject->HasComponent<RenderComponent>())
-        {
-            const auto &tf = gameObject->GetComponent<TransformComponent>();
-            const auto &render = gameObject->GetComponent<RenderComponent>();
-
-            float angle = 0.0f;
-            Quat4f rotation = tf.GetWorldRotation();
-            Vector3f axis = rotation.getAxisAngle(&angle);
-            angle *= (float)180.0f / (float)M_PI;
+        const RenderComponent &render = *m_renderQueue.GetItem(index).render;
+        if (render.defaultMaterial.shader == nullptr || !render.defaultMaterial.shader->IsValid())
+            continue;
 
-            bool useShader = (render.defaultMaterial.shader != nullptr && render.defaultMaterial.shader->IsValid());
-            if (useShader)
+        // 同模型各个mesh的passes
+        for (int i = 0; i < render.model.meshCount; i++)
+        {
+            const Mesh &mesh = render.model.meshes[i];
+            auto it = render.meshPasses.find(i);
+            if (it != render.meshPasses.end() && !it->second.empty())
             {
-
-                Matrix4f S = Matrix4f(Matrix3f(tf.GetWorldScale() & render.scale));
-                Matrix4f R = Matrix4f(tf.GetWorldRotation().toMatrix());
-                Matrix4f T = Matrix4f::translation(tf.GetWorldPosition());
-                Matrix4f M = T * R * S;
-
-                Matrix4f MVP = VP * M;
-
-                // 同模型各个mesh的passes
-                for (int i = 0; i < render.model.meshCount; i++)
+                // 单mesh多pass
+                for (size_t p = 0; p < it->second.size(); p++)
                 {
-                    Mesh &mesh = render.model.meshes[i];
-                    const std::vector<RenderMaterial> *passes = nullptr;
-                    auto it = render.meshPasses.find(i);
-                    if (it != render.meshPasses.end())
-                    {
-                        passes = &it->second;
-                    }
-                    if (passes != nullptr && !passes->empty())
-                    {
-                        // 单mesh多pass
-                        for (size_t p = 0; p < passes->size(); p++)
-                        {
-                            const RenderMaterial &pass = (*passes)[p];
-
-                            RenderSinglePass(mesh, render.model, i, pass, matProj, matView, MVP, M, camera, world, render.totalBaseColor);
-                        }
-                    }
-                    else
-                    {
-                        RenderSinglePass(mesh, render.model, i, render.defaultMaterial, matProj, matView, MVP, M, camera, world, render.totalBaseColor);
-                    }
+                    const RenderMaterial &pass = it->second[p];
+                    if (pass.shader == nullptr || !pass.shader->IsValid())
+                        continue;
+                    m_drawCommands.push_back({DrawCommand::MakeKey(pass, (int)p, mesh, sequence++), index, i, &pass});
                 }
             }
             else
+            {
+                const RenderMaterial &pass = render.defaultMaterial;
+                m_drawCommands.push_back({DrawCommand::MakeKey(pass, 0, mesh, sequence++), index, i, &pass});
+            }
+        }
+    }
+    std::sort(m_drawCommands.begin(), m_drawCommands.end());
+
+    // DrawMesh 不经过 rlgl 的批次: 只需在开头提交一次之前的立即模式绘制(天空盒等)
+    rlDrawRenderBatchActive();
+    m_stateCache.Begin();
+    for (size_t i = 0; i < m_drawCommands.size();)
+    {
+        // 不透明命令中, 相邻且 mesh/材质相同的一段合并为实例化绘制
+        size_t runEnd = i + 1;
+        while (runEnd < m_drawCommands.size() && CanInstanceTogether(m_renderQueue, m_drawCommands[i], m_drawCommands[runEnd]))
+            runEnd++;
+        ShaderWrapper *instanced = runEnd - i >= MIN_INSTANCED_BATCH ? m_drawCommands[i].pass->shader->GetInstancedVariant() : nullptr;
+        if (instanced != nullptr)
+        {
+            RenderInstancedPass(&m_drawCommands[i], runEnd - i, *instanced, frame);
+        }
+        else
+        {
+            for (size_t j = i; j < runEnd; j++)
+                RenderSinglePass(m_drawCommands[j], frame);
+        }
+        i = runEnd;
+    }
+    m_stateCache.End();
+
+    for (uint32_t index : drawList)
+    {
+        const RenderItem &item = m_renderQueue.GetItem(index);
+        const GameObject *gameObject = item.object;
+        const auto &tf = *item.transform;
+        const auto &render = *item.render;
+
+        bool useShader = (render.defaultMaterial.shader != nullptr && render.defaultMaterial.shader->IsValid());
+
+        // raylib 的 DrawModelEx 系列需要轴角, 仅在这些路径上分解旋转
+        if (!useShader || render.showWires)
+        {
+            float angle = 0.0f;
+            Vector3f axis = tf.GetWorldRotation().getAxisAngle(&angle);
+            angle *= (float)180.0f / (float)M_PI;
+
+            if (!useShader)
             {
                 Color tint = {(unsigned char)render.defaultMaterial.baseColor.x(), (unsigned char)render.defaultMaterial.baseColor.y(), (unsigned char)render.defaultMaterial.baseColor.z(), (unsigned char)render.defaultMaterial.baseColor.w()};
                 DrawModelEx(
@@ -358,21 +487,21 @@ void Renderer::DrawWorldObjects(GameWorld &world, Camera3D &rawCamera, mCamera &
                     angle,
                     tf.GetWorldScale() & render.scale,
                     BLACK);
+        }
 
-            if (render.showAxes)
-                DrawCoordinateAxes(tf.GetWorldPosition(), tf.GetWorldRotation(), 2.0f, 0.05f);
-            if (render.showCenter)
-                DrawSphereEx(tf.GetWorldPosition(), 0.1f, 8, 8, RED);
-            if (render.showAngVol && gameObject->HasComponent<RigidbodyComponent>())
-            {
-                const auto &rb = gameObject->GetComponent<RigidbodyComponent>();
-                DrawVector(tf.GetWorldPosition(), rb.angularVelocity, 1.0f, 0.05f);
-            }
-            if (render.showVol && gameObject->HasComponent<RigidbodyComponent>())
-            {
-                const auto &rb = gameObject->GetComponent<RigidbodyComponent>();
-                DrawVector(tf.GetWorldPosition(), rb.velocity, 1.0f, 0.05f);
-            }
+        if (render.showAxes)
+            DrawCoordinateAxes(tf.GetWorldPosition(), tf.GetWorldRotation(), 2.0f, 0.05f);
+        if (render.showCenter)
+            DrawSphereEx(tf.GetWorldPosition(), 0.1f, 8, 8, RED);
+        if (render.showAngVol && gameObject->HasComponent<RigidbodyComponent>())
+        {
+            const auto &rb = gameObject->GetComponent<RigidbodyComponent>();
+            DrawVector(tf.GetWorldPosition(), rb.angularVelocity, 1.0f, 0.05f);
+        }
+        if (render.showVol && gameObject->HasComponent<RigidbodyComponent>())
+        {
+            const auto &rb = gameObject->GetComponent<RigidbodyComponent>();
+            DrawVector(tf.GetWorldPosition(), rb.velocity, 1.0f, 0.05f);
         }
     }
     // TODO: debug
@@ -381,117 +510,178 @@ void Renderer::DrawWorldObjects(GameWorld &world, Camera3D &rawCamera, mCamera &
     DrawCoordinateAxes(Vector3f(0.0f), Quat4f::IDENTITY, 2.0f, 0.05f);
 }
 
-void Renderer::RenderSinglePass(const Mesh &mesh, const Model &model, const int &meshIdx, const RenderMaterial &pass,
-                                const Matrix4f &matProj, const Matrix4f &matView, const Matrix4f &MVP, const Matrix4f &M, const mCamera &camera, GameWorld &gameWorld, const Vector4f &totalBaseColor)
+void Renderer::UploadMaterialUniforms(ShaderWrapper &shader, const RenderMaterial &pass)
 {
-    rlDrawRenderBatchActive();
+    // 与上次上传的材质相同则跳过: 颜色/自定义参数/动画贴图参数
+    if (!shader.NeedsMaterialUniforms(&pass))
+        return;
 
-    rlEnableDepthTest();
-    rlEnableDepthMask();
-    rlDisableBackfaceCulling();
-    rlSetCullFace(RL_CULL_FACE_BACK);
-    rlEnableColorBlend();
-    float gameTime = gameWorld.GetTimeManager().GetGameTime();
-    float realTime = gameWorld.GetTimeManager().GetRealTime();
+    shader.SetVec4(U_BASE_COLOR, pass.baseColor / 255.0f);
+    for (auto const &[id, value] : pass.floatUniforms)
+        shader.SetFloat(id, value);
+    for (auto const &[id, value] : pass.vector2Uniforms)
+        shader.SetVec2(id, value);
+    for (auto const &[id, value] : pass.vector3Uniforms)
+        shader.SetVec3(id, value);
+    for (auto const &[id, value] : pass.vector4Uniforms)
+        shader.SetVec4(id, value);
+
+    shader.SetVec3(U_EMISSIVE_COLOR, pass.emissiveColor / 255.0f);
+    shader.SetFloat(U_EMISSIVE_INTENSITY, pass.emissiveIntensity);
+    if (pass.useDiffuseMap)
+    {
+        shader.SetInt(U_DIFFUSE_FRAME_COUNT, pass.diffuseIsAnimated ? pass.diffuseframeCount : 1);
+        shader.SetFloat(U_DIFFUSE_ANIM_SPEED, pass.diffuseIsAnimated ? pass.diffuseanimSpeed : 0.0f);
+    }
+    for (auto const &tex : pass.textureUniforms)
+    {
+        shader.SetInt(tex.frameCount, tex.frames);
+        shader.SetFloat(tex.animSpeed, tex.speed);
+    }
+    m_stateCache.GetStats().materialUploads++;
+}
 
-    if (pass.shader != nullptr && pass.shader->IsValid())
+int Renderer::BindPassTextures(ShaderWrapper &shader, const RenderMaterial &pass, Material *raylibMaterial)
+{
+    // 纹理单元绑定是全局状态, DrawMesh 结束时会解绑材质贴图, 每次绘制都重新绑定
+    int texUnit = 1;
+    if (pass.useDiffuseMap)
     {
-        int matIdex = model.meshMaterial[meshIdx];
-        Material tempRaylibMaterial = model.materials[matIdex];
+        shader.SetTexture(U_DIFFUSE_MAP, pass.diffuseMap, texUnit);
+        if (raylibMaterial != nullptr)
+            raylibMaterial->maps[MATERIAL_MAP_DIFFUSE].texture = pass.diffuseMap;
+        texUnit++;
+    }
 
-        pass.shader->Begin();
+    shader.SetCubeMap(U_SKYBOX_MAP, m_skybox->GetTexture().id, texUnit);
+    texUnit++;
 
-        switch (pass.blendMode)
-        {
-        case BLEND_OPIQUE:
-            rlDisableColorBlend();
-            break;
-        case BLEND_MULTIPLIED:
-            rlSetBlendMode(BLEND_CUSTOM);
-            rlSetBlendFactors(RL_DST_COLOR, RL_ZERO, RL_FUNC_ADD);
-            break;
-        case BLEND_SCREEN:
-            rlSetBlendMode(BLEND_CUSTOM);
-            rlSetBlendFactors(RL_ONE, RL_ONE_MINUS_SRC_COLOR, RL_FUNC_ADD);
-            break;
-        case BLEND_SUBTRACT:
-            rlSetBlendMode(BLEND_CUSTOM);
-            rlSetBlendFactors(RL_ONE, RL_ONE, RL_FUNC_REVERSE_SUBTRACT);
-            break;
-        default:
-            BeginBlendMode(pass.blendMode);
-            break;
-        }
+    for (auto const &tex : pass.textureUniforms)
+    {
+        shader.SetTexture(tex.sampler, tex.texture, texUnit);
+        texUnit++;
+    }
 
-        pass.shader->SetAll(MVP, M, camera.Position(), realTime, gameTime, pass.baseColor, pass.customFloats, pass.customVector2, pass.customVector3, pass.customVector4);
-        pass.shader->SetVec4("totalBaseColor", totalBaseColor / 255.0f);
-        pass.shader->SetMat4("matProj", matProj);
-        pass.shader->SetMat4("matView", matView);
+    m_lightingManager->BindShadowMaps(shader, texUnit);
+    return texUnit;
+}
 
-        pass.shader->SetVec3("emissiveColor", pass.emissiveColor / 255.0f);
-        pass.shader->SetFloat("emissiveIntensity", pass.emissiveIntensity);
+void Renderer::RenderSinglePass(const DrawCommand &cmd, const FrameUniforms &frame)
+{
+    const RenderItem &item = m_renderQueue.GetItem(cmd.item);
+    const Model &model = item.render->model;
+    const RenderMaterial &pass = *cmd.pass;
+    ShaderWrapper &shader = *pass.shader;
 
-        int texUnit = 1;
-        if (pass.useDiffuseMap)
-        {
-            pass.shader->SetTexture("u_diffuseMap", pass.diffuseMap, texUnit);
-            if (pass.diffuseIsAnimated)
-            {
-                pass.shader->SetInt("u_diffuseMap_frameCount", pass.diffuseframeCount);
-                pass.shader->SetFloat("u_diffuseMap_animSpeed", pass.diffuseanimSpeed);
-            }
-            else
-            {
-                pass.shader->SetInt("u_diffuseMap_frameCount", 1);
-                pass.shader->SetFloat("u_diffuseMap_animSpeed", 0.0f);
-            }
-            tempRaylibMaterial.maps[MATERIAL_MAP_DIFFUSE].texture = pass.diffuseMap;
-            texUnit++;
-        }
+    m_stateCache.ApplyShader(shader);
+    m_stateCache.ApplyPassState(pass);
+    auto &stats = m_stateCache.GetStats();
 
-        pass.shader->SetCubeMap("skyboxMap", m_skybox->GetTexture(), texUnit);
-        texUnit++;
+    // 每视图: 矩阵/时间/光照
+    if (shader.NeedsFrameUniforms(frame.stamp))
+    {
+        shader.SetMat4(U_MAT_PROJ, frame.matProj);
+        shader.SetMat4(U_MAT_VIEW, frame.matView);
+        shader.SetFloat(U_REAL_TIME, frame.realTime);
+        shader.SetFloat(U_GAME_TIME, frame.gameTime);
+        m_lightingManager->UploadLights(shader, frame.viewPos); // 含 viewPos
+        stats.frameUploads++;
+    }
+    UploadMaterialUniforms(shader, pass);
 
-        for (auto const &[name, text] : pass.customTextures)
-        {
-            pass.shader->SetTexture(name, text, texUnit);
-            if (pass.isAnimated.at(name))
-            {
-                pass.shader->SetInt(name + "_frameCount", pass.frameCount.at(name));
-                pass.shader->SetFloat(name + "_animSpeed", pass.animSpeed.at(name));
-            }
-            else
-            {
-                pass.shader->SetInt(name + "_frameCount", 1);
-                pass.shader->SetFloat(name + "_animSpeed", 0.0f);
-            }
-            texUnit++;
-        }
+    // 每对象
+    shader.SetMat4(U_MVP, frame.VP * item.model);
+    shader.SetMat4(U_TRANSFORM, item.model);
+    shader.SetVec4(U_TOTAL_BASE_COLOR, item.render->totalBaseColor / 255.0f);
 
-        m_lightingManager->UploadToShader(pass.shader, camera.Position(), texUnit);
+    int matIdex = model.meshMaterial[cmd.mesh];
+    Material tempRaylibMaterial = model.materials[matIdex];
+    BindPassTextures(shader, pass, &tempRaylibMaterial);
+    tempRaylibMaterial.shader = shader.GetShader();
 
-        if (pass.cullFace >= 0)
-        {
-            rlEnableBackfaceCulling();
-            rlSetCullFace(pass.cullFace);
-        }
-        if (!pass.depthTest)
-            rlDisableDepthTest();
-        if (!pass.depthWrite)
-            rlDisableDepthMask();
-
-        tempRaylibMaterial.shader = pass.shader->GetShader();
-
-        DrawMesh(mesh, tempRaylibMaterial, M);
-        rlDrawRenderBatchActive();
-        pass.shader->End();
-        EndBlendMode();
-    }
-    rlEnableColorBlend();
-    rlEnableDepthTest();
-    rlEnableDepthMask();
-    rlDisableBackfaceCulling();
-    rlSetCullFace(RL_CULL_FACE_BACK);
+    DrawMesh(model.meshes[cmd.mesh], tempRaylibMaterial, item.model);
+    stats.drawCalls++;
+}
+
+void Renderer::RenderInstancedPass(const DrawCommand *cmds, size_t count, ShaderWrapper &shader, const FrameUniforms &frame)
+{
+    const RenderMaterial &pass = *cmds[0].pass;
+    const Mesh &mesh = m_renderQueue.GetItem(cmds[0].item).render->model.meshes[cmds[0].mesh];
+
+    // 每实例数据: 模型矩阵按列存放(与 glsl mat4 属性一致) + 整体颜色
+    m_instanceData.resize(count * 20);
+    float *dst = m_instanceData.data();
+    for (size_t i = 0; i < count; i++)
+    {
+        const RenderItem &item = m_renderQueue.GetItem(cmds[i].item);
+        for (int col = 0; col < 4; col++)
+            for (int row = 0; row < 4; row++)
+                *dst++ = item.model(row, col);
+        const Vector4f color = item.render->totalBaseColor / 255.0f;
+        *dst++ = color.x();
+        *dst++ = color.y();
+        *dst++ = color.z();
+        *dst++ = color.w();
+    }
+    const size_t bytes = m_instanceData.size() * sizeof(float);
+    if (bytes > m_instanceVboCapacity)
+    {
+        // 按 2 倍扩容, 之后只更新内容
+        if (m_instanceVbo != 0)
+            rlUnloadVertexBuffer(m_instanceVbo);
+        m_instanceVboCapacity = std::max(bytes, m_instanceVboCapacity * 2);
+        m_instanceVbo = rlLoadVertexBuffer(nullptr, (int)m_instanceVboCapacity, true);
+    }
+    rlUpdateVertexBuffer(m_instanceVbo, m_instanceData.data(), (int)bytes, 0);
+
+    m_stateCache.ApplyShader(shader);
+    m_stateCache.ApplyPassState(pass);
+    auto &stats = m_stateCache.GetStats();
+
+    if (shader.NeedsFrameUniforms(frame.stamp))
+    {
+        shader.SetMat4(U_VP, frame.VP);
+        shader.SetMat4(U_MAT_PROJ, frame.matProj);
+        shader.SetMat4(U_MAT_VIEW, frame.matView);
+        shader.SetFloat(U_REAL_TIME, frame.realTime);
+        shader.SetFloat(U_GAME_TIME, frame.gameTime);
+        m_lightingManager->UploadLights(shader, frame.viewPos);
+        stats.frameUploads++;
+    }
+    UploadMaterialUniforms(shader, pass);
+    BindPassTextures(shader, pass, nullptr);
+
+    // 实例属性挂在 mesh 的 VAO 上, 绘制后关闭, 不影响该 mesh 的普通绘制
+    const int stride = 20 * sizeof(float);
+    rlEnableShader(shader.GetShader().id);
+    rlEnableVertexArray(mesh.vaoId);
+    rlEnableVertexBuffer(m_instanceVbo);
+    for (int col = 0; col < 4; col++)
+    {
+        rlEnableVertexAttribute(INSTANCE_TRANSFORM_LOCATION + col);
+        rlSetVertexAttribute(INSTANCE_TRANSFORM_LOCATION + col, 4, RL_FLOAT, false, stride, col * 4 * sizeof(float));
+        rlSetVertexAttributeDivisor(INSTANCE_TRANSFORM_LOCATION + col, 1);
+    }
+    rlEnableVertexAttribute(INSTANCE_COLOR_LOCATION);
+    rlSetVertexAttribute(INSTANCE_COLOR_LOCATION, 4, RL_FLOAT, false, stride, 16 * sizeof(float));
+    rlSetVertexAttributeDivisor(INSTANCE_COLOR_LOCATION, 1);
+
+    if (mesh.indices != nullptr)
+        rlDrawVertexArrayElementsInstanced(0, mesh.triangleCount * 3, 0, (int)count);
+    else
+        rlDrawVertexArrayInstanced(0, mesh.vertexCount, (int)count);
+
+    for (int loc = INSTANCE_TRANSFORM_LOCATION; loc <= INSTANCE_COLOR_LOCATION; loc++)
+    {
+        rlSetVertexAttributeDivisor(loc, 0);
+        rlDisableVertexAttribute(loc);
+    }
+    rlDisableVertexBuffer();
+    rlDisableVertexArray();
+
+    stats.drawCalls++;
+    stats.instancedDraws++;
+    stats.instances += (uint32_t)count;
 }
 
 void Renderer::DrawParticle(GameWorld &gameWorld, mCamera &camera, float aspect)
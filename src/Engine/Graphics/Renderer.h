@@ -7,6 +7,8 @@
 #include "PostProcess/PostProcesser.h"
 #include "Skybox/Skybox.h"
 #include "Lighting/LightingManager.h"
+#include "RenderQueue/RenderQueue.h"
+#include "RenderQueue/RenderStateCache.h"
 
 #include <memory>
 #include <vector>
@@ -28,6 +30,11 @@ public:
     void RenderScene(GameWorld &world, CameraManager &cameraManager);
 
     Skybox *GetSkybox() { return m_skybox.get(); }
+    // 本帧的剔除统计
+    const RenderQueue &GetRenderQueue() const { return m_renderQueue; }
+    // 本帧的绘制/状态切换统计
+    const RenderStateCache::Stats &GetDrawStats() const { return m_stateCache.GetStats(); }
+    const LightingManager &GetLightingManager() const { return *m_lightingManager; }
 
     void Update(GameWorld &gameworld);
 
@@ -40,16 +47,37 @@ private:
     void RawRenderScene(GameWorld &gameWorld, CameraManager &cameraManager);
     void RawRenderParticle(GameWorld &gameWorld, CameraManager &cameraManager);
 
-    void RenderSinglePass(const Mesh &mesh, const Model &model, const int &meshIdx, const RenderMaterial &pass,
-                          const Matrix4f &matProj, const Matrix4f &matView, const Matrix4f &MVP, const Matrix4f &M,
-                          const mCamera &camera, GameWorld &gameWorld, const Vector4f &totalBaseColor);
-    void DrawWorldObjects(GameWorld &gameWorld, Camera3D &rawCamera, mCamera &camera, float aspect);
+    // 每视图 uniform 块: 同一视图内每个 shader 只上传一次
+    struct FrameUniforms
+    {
+        uint64_t stamp = 0;
+        Matrix4f matProj;
+        Matrix4f matView;
+        Matrix4f VP;
+        Vector3f viewPos;
+        float realTime = 0.0f;
+        float gameTime = 0.0f;
+    };
+    void RenderSinglePass(const DrawCommand &cmd, const FrameUniforms &frame);
+    // 同一 mesh + 同材质的连续命令合并为一次实例化绘制
+    void RenderInstancedPass(const DrawCommand *cmds, size_t count, ShaderWrapper &shader, const FrameUniforms &frame);
+    void UploadMaterialUniforms(ShaderWrapper &shader, const RenderMaterial &pass);
+    int BindPassTextures(ShaderWrapper &shader, const RenderMaterial &pass, Material *raylibMaterial);
+    void DrawWorldObjects(GameWorld &gameWorld, const std::string &viewName, Camera3D &rawCamera, mCamera &camera, float aspect);
     void DrawParticle(GameWorld &gameWorld, mCamera &camera, float aspect);
 
     bool LoadViewConfig(const std::string &configPath, GameWorld &gameWorld);
     std::unique_ptr<RenderViewer> m_renderViewer;
     std::unique_ptr<PostProcesser> m_postProcesser;
     std::unique_ptr<LightingManager> m_lightingManager;
+    RenderQueue m_renderQueue;
+    RenderStateCache m_stateCache;
+    std::vector<DrawCommand> m_drawCommands;
+    uint64_t m_frameStamp = 0;
+    // 每实例: 模型矩阵(16) + 颜色(4), 单个动态 VBO 逐帧复用
+    std::vector<float> m_instanceData;
+    unsigned int m_instanceVbo = 0;
+    size_t m_instanceVboCapacity = 0; // 字节
     // Texture2D m_dummyDepth;
     // void CopyDepthBuffer(RenderTexture2D sourceRT, Texture2D targetDepth);
     // Debug
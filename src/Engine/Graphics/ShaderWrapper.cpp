@@ -1,8 +1,10 @@
 #include "ShaderWrapper.h"
 
+#include <cstring>
 #include <iostream>
 
 ShaderWrapper::ShaderWrapper(const std::string &vsPath, const std::string &fsPath)
+    : m_vsPath(vsPath), m_fsPath(fsPath)
 {
     const char *vPath = vsPath.empty() ? nullptr : vsPath.c_str();
     const char *fPath = fsPath.empty() ? nullptr : fsPath.c_str();
@@ -124,6 +126,49 @@ ShaderWrapper::~ShaderWrapper()
 }
 void ShaderWrapper::Begin() const { BeginShaderMode(m_shader); }
 void ShaderWrapper::End() const { EndShaderMode(); }
+namespace
+{
+    constexpr int UNRESOLVED_LOCATION = -2;
+
+    struct UniformRegistry
+    {
+        std::unordered_map<std::string, uint32_t> ids;
+        std::vector<std::string> names;
+    };
+    UniformRegistry &GetRegistry()
+    {
+        static UniformRegistry registry;
+        return registry;
+    }
+
+    const UniformID U_MVP = ShaderWrapper::Intern("u_mvp");
+    const UniformID U_TRANSFORM = ShaderWrapper::Intern("transform");
+    const UniformID U_VIEW_POS = ShaderWrapper::Intern("viewPos");
+    const UniformID U_REAL_TIME = ShaderWrapper::Intern("realTime");
+    const UniformID U_GAME_TIME = ShaderWrapper::Intern("gameTime");
+    const UniformID U_BASE_COLOR = ShaderWrapper::Intern("baseColor");
+}
+
+UniformID ShaderWrapper::Intern(const std::string &name)
+{
+    UniformRegistry &registry = GetRegistry();
+    auto [it, inserted] = registry.ids.try_emplace(name, (uint32_t)registry.names.size());
+    if (inserted)
+        registry.names.push_back(name);
+    return UniformID{it->second};
+}
+
+const std::string &ShaderWrapper::GetUniformName(UniformID id)
+{
+    return GetRegistry().names.at(id.index);
+}
+
+ShaderWrapper::UniformStats &ShaderWrapper::GetUniformStats()
+{
+    static UniformStats stats;
+    return stats;
+}
+
 // TODO:使用模板实现自定义参数上传
 void ShaderWrapper::SetAll(const Matrix4f &MVP, const Matrix4f &M, const Vector3f &viewPos, float realTime, float gameTime, const Vector4f &baseColor,
 
@@ -132,13 +177,13 @@ void ShaderWrapper::SetAll(const Matrix4f &MVP, const Matrix4f &M, const Vector3
                            const std::unordered_map<std::string, Vector3f> &customVector3,
                            const std::unordered_map<std::string, Vector4f> &customVector4)
 {
-    SetMat4("u_mvp", MVP);
-    SetMat4("transform", M);
-    SetVec3("viewPos", viewPos);
-    SetFloat("realTime", realTime);
-    SetFloat("gameTime", gameTime);
+    SetMat4(U_MVP, MVP);
+    SetMat4(U_TRANSFORM, M);
+    SetVec3(U_VIEW_POS, viewPos);
+    SetFloat(U_REAL_TIME, realTime);
+    SetFloat(U_GAME_TIME, gameTime);
     Vector4f color = baseColor / 255.0f;
-    SetVec4("baseColor", color);
+    SetVec4(U_BASE_COLOR, color);
 
     for (auto const &[name, value] : customFloats)
         SetFloat(name, value);
@@ -151,104 +196,177 @@ void ShaderWrapper::SetAll(const Matrix4f &MVP, const Matrix4f &M, const Vector3
         SetVec4(name, value);
 }
 
-void ShaderWrapper::SetInt(const std::string &name, int value)
+int ShaderWrapper::GetLocation(UniformID id)
 {
-    int loc = GetLocation(name);
+    if (!id.IsValid())
+        return -1;
+    if (id.index >= m_slots.size())
+    {
+        UniformSlot unresolved;
+        unresolved.location = UNRESOLVED_LOCATION;
+        m_slots.resize(id.index + 1, unresolved);
+    }
+    UniformSlot &slot = m_slots[id.index];
+    if (slot.location == UNRESOLVED_LOCATION)
+        slot.location = GetShaderLocation(m_shader, GetUniformName(id).c_str());
+    return slot.location;
+}
+
+int ShaderWrapper::GetLocation(const std::string &name)
+{
+    return GetLocation(Intern(name));
+}
+
+int ShaderWrapper::PrepareUpload(UniformID id, const void *data, uint8_t size)
+{
+    int loc = GetLocation(id);
+    if (loc < 0)
+        return -1;
+    UniformSlot &slot = m_slots[id.index];
+    if (slot.size == size && std::memcmp(slot.value, data, size) == 0)
+    {
+        GetUniformStats().skipped++;
+        return -1;
+    }
+    std::memcpy(slot.value, data, size);
+    slot.size = size;
+    GetUniformStats().uploads++;
+    return loc;
+}
+
+void ShaderWrapper::SetInt(UniformID id, int value)
+{
+    int loc = PrepareUpload(id, &value, sizeof(value));
     if (loc >= 0)
         SetShaderValue(m_shader, loc, &value, SHADER_UNIFORM_INT);
 }
-void ShaderWrapper::SetFloat(const std::string &name, float value)
+void ShaderWrapper::SetFloat(UniformID id, float value)
 {
-    int loc = GetLocation(name);
+    int loc = PrepareUpload(id, &value, sizeof(value));
     if (loc >= 0)
         SetShaderValue(m_shader, loc, &value, SHADER_UNIFORM_FLOAT);
 }
-
-void ShaderWrapper::SetVec2(const std::string &name, const Vector2f &value)
+void ShaderWrapper::SetVec2(UniformID id, const Vector2f &value)
 {
-    int loc = GetLocation(name);
+    float valueArr[2] = {value.x(), value.y()};
+    int loc = PrepareUpload(id, valueArr, sizeof(valueArr));
     if (loc >= 0)
-    {
-        float valueArr[2] = {value.x(), value.y()};
         SetShaderValue(m_shader, loc, valueArr, SHADER_UNIFORM_VEC2);
-    }
 }
-void ShaderWrapper::SetVec3(const std::string &name, const Vector3f &value)
+void ShaderWrapper::SetVec3(UniformID id, const Vector3f &value)
 {
-    int loc = GetLocation(name);
+    float valueArr[3] = {value.x(), value.y(), value.z()};
+    int loc = PrepareUpload(id, valueArr, sizeof(valueArr));
     if (loc >= 0)
-    {
-        float valueArr[3] = {value.x(), value.y(), value.z()};
         SetShaderValue(m_shader, loc, valueArr, SHADER_UNIFORM_VEC3);
-    }
 }
-void ShaderWrapper::SetVec4(const std::string &name, const Vector4f &value)
+void ShaderWrapper::SetVec4(UniformID id, const Vector4f &value)
 {
-    int loc = GetLocation(name);
+    float valueArr[4] = {value.x(), value.y(), value.z(), value.w()};
+    int loc = PrepareUpload(id, valueArr, sizeof(valueArr));
     if (loc >= 0)
-    {
-        float valueArr[4] = {value.x(), value.y(), value.z(), value.w()};
         SetShaderValue(m_shader, loc, valueArr, SHADER_UNIFORM_VEC4);
-    }
 }
-
-void ShaderWrapper::SetMat4(const std::string &name, const Matrix4f &value)
+void ShaderWrapper::SetMat4(UniformID id, const Matrix4f &value)
 {
-    int loc = GetLocation(name);
+    Matrix valueArr = value;
+    int loc = PrepareUpload(id, &valueArr, sizeof(valueArr));
     if (loc >= 0)
-    {
-        Matrix valueArr = value;
         SetShaderValueMatrix(m_shader, loc, valueArr);
-    }
 }
-#include "rlgl.h"
-void ShaderWrapper::SetTexture(const std::string &name, Texture2D texture, int unit)
+// 纹理单元绑定是全局状态, 每次都绑定; 只有采样器的单元号走值缓存
+void ShaderWrapper::SetTexture(UniformID id, Texture2D texture, int unit)
 {
-    int loc = GetLocation(name);
-    if (loc >= 0)
-    {
-        rlActiveTextureSlot(unit);
-        rlEnableTexture(texture.id);
-        SetShaderValue(m_shader, loc, &unit, SHADER_UNIFORM_INT);
-        rlActiveTextureSlot(0);
-    }
+    if (GetLocation(id) < 0)
+        return;
+    rlActiveTextureSlot(unit);
+    rlEnableTexture(texture.id);
+    rlActiveTextureSlot(0);
+    SetInt(id, unit);
 }
-void ShaderWrapper::SetCubeMap(const std::string &name, TextureCubemap cubemap, int unit)
+void ShaderWrapper::SetCubeMap(UniformID id, unsigned int cubemapId, int unit)
 {
-    int loc = GetLocation(name);
-    if (loc >= 0)
-    {
-        rlActiveTextureSlot(unit);
-        rlEnableTextureCubemap(cubemap.id);
-        SetShaderValue(m_shader, loc, &unit, SHADER_UNIFORM_INT);
-    }
+    if (GetLocation(id) < 0)
+        return;
+    rlActiveTextureSlot(unit);
+    rlEnableTextureCubemap(cubemapId);
+    SetInt(id, unit);
 }
 
-void ShaderWrapper::SetCubeMap(const std::string &name, unsigned int cubemapId, int unit)
+void ShaderWrapper::SetInt(const std::string &name, int value) { SetInt(Intern(name), value); }
+void ShaderWrapper::SetFloat(const std::string &name, float value) { SetFloat(Intern(name), value); }
+void ShaderWrapper::SetVec2(const std::string &name, const Vector2f &value) { SetVec2(Intern(name), value); }
+void ShaderWrapper::SetVec3(const std::string &name, const Vector3f &value) { SetVec3(Intern(name), value); }
+void ShaderWrapper::SetVec4(const std::string &name, const Vector4f &value) { SetVec4(Intern(name), value); }
+void ShaderWrapper::SetMat4(const std::string &name, const Matrix4f &value) { SetMat4(Intern(name), value); }
+void ShaderWrapper::SetTexture(const std::string &name, Texture2D texture, int unit) { SetTexture(Intern(name), texture, unit); }
+void ShaderWrapper::SetCubeMap(const std::string &name, TextureCubemap cubemap, int unit) { SetCubeMap(Intern(name), cubemap.id, unit); }
+void ShaderWrapper::SetCubeMap(const std::string &name, unsigned int cubemapId, int unit) { SetCubeMap(Intern(name), cubemapId, unit); }
+
+#include <fstream>
+#include <sstream>
+namespace
 {
-    int loc = GetLocation(name);
-    if (loc >= 0)
+    // #version 必须在第一行, 宏定义插在其后
+    std::string InjectDefine(const std::string &source, const char *define)
     {
-        rlActiveTextureSlot(unit);
-        rlEnableTextureCubemap(cubemapId);
-        SetShaderValue(m_shader, loc, &unit, SHADER_UNIFORM_INT);
+        size_t insertAt = 0;
+        if (source.compare(0, 8, "#version") == 0)
+        {
+            size_t lineEnd = source.find('\n');
+            insertAt = lineEnd == std::string::npos ? source.size() : lineEnd + 1;
+        }
+        std::string result = source.substr(0, insertAt);
+        if (insertAt == source.size() && insertAt > 0)
+            result += '\n';
+        result += "#define ";
+        result += define;
+        result += '\n';
+        result += source.substr(insertAt);
+        return result;
     }
 }
 
-// private:
-int ShaderWrapper::GetLocation(const std::string &name)
+ShaderWrapper *ShaderWrapper::GetInstancedVariant()
 {
-    auto it = m_locationCache.find(name);
-    if (it != m_locationCache.end())
-        return it->second;
+    if (m_instancedTried)
+        return m_instanced.get();
+    m_instancedTried = true;
 
-    int loc = GetShaderLocation(m_shader, name.c_str());
-    m_locationCache[name] = loc;
-    return loc;
+    if (m_vsPath.empty() || !IsValid())
+        return nullptr;
+    std::string vsCode = LoadVSText(m_vsPath);
+    if (vsCode.find("INSTANCING") == std::string::npos)
+        return nullptr;
+    vsCode = InjectDefine(vsCode, "INSTANCING");
+
+    std::string fsCode;
+    if (!m_fsPath.empty())
+    {
+        fsCode = LoadVSText(m_fsPath);
+        if (fsCode.empty())
+            return nullptr;
+        fsCode = InjectDefine(fsCode, "INSTANCING");
+    }
+
+    std::unique_ptr<ShaderWrapper> variant(new ShaderWrapper());
+    variant->m_shader = LoadShaderFromMemory(vsCode.c_str(), fsCode.empty() ? nullptr : fsCode.c_str());
+    // 编译失败时 raylib 回退到默认 shader
+    if (variant->m_shader.id == 0 || variant->m_shader.id == rlGetShaderIdDefault())
+    {
+        std::cerr << "[ShaderWrapper] Failed to build instanced variant: " << m_vsPath << ", " << m_fsPath << std::endl;
+        return nullptr;
+    }
+    if (GetShaderLocationAttrib(variant->m_shader, "instanceTransform") != INSTANCE_TRANSFORM_LOCATION)
+    {
+        std::cerr << "[ShaderWrapper] Instanced variant must bind instanceTransform to location "
+                  << INSTANCE_TRANSFORM_LOCATION << ": " << m_vsPath << std::endl;
+        return nullptr;
+    }
+    m_instanced = std::move(variant);
+    return m_instanced.get();
 }
 
-#include <fstream>
-#include <sstream>
 std::string ShaderWrapper::LoadVSText(const std::string &path)
 {
     std::ifstream file(path);
@@ -1,8 +1,23 @@
 #pragma once
+#include <cstdint>
 #include <string>
 #include "raylib.h"
 #include "Engine/Math/Math.h"
+#include <memory>
 #include <unordered_map>
+#include <vector>
+
+// 实例化变体中实例属性的固定位置 (避开 raylib 默认的 0~7 顶点属性)
+#define INSTANCE_TRANSFORM_LOCATION 8 // mat4 占 8~11
+#define INSTANCE_COLOR_LOCATION 12
+
+// 驻留后的 uniform 名: 全局唯一下标. 调用方解析一次后按下标设置,
+// 各 shader 按下标缓存 location 与上次上传的值
+struct UniformID
+{
+    uint32_t index = UINT32_MAX;
+    bool IsValid() const { return index != UINT32_MAX; }
+};
 
 class ShaderWrapper
 {
@@ -20,7 +35,29 @@ public:
     void Begin() const;
     void End() const;
 
-    // Uniform 接口
+    // uniform 名驻留; 同名总是返回同一个 UniformID
+    static UniformID Intern(const std::string &name);
+    static const std::string &GetUniformName(UniformID id);
+
+    // 上传统计: 值未变化的设置直接跳过, 不调用 GL
+    struct UniformStats
+    {
+        uint64_t uploads = 0;
+        uint64_t skipped = 0;
+    };
+    static UniformStats &GetUniformStats();
+
+    // Uniform 接口 (按 UniformID)
+    void SetInt(UniformID id, int value);
+    void SetFloat(UniformID id, float value);
+    void SetVec2(UniformID id, const Vector2f &value);
+    void SetVec3(UniformID id, const Vector3f &value);
+    void SetVec4(UniformID id, const Vector4f &value);
+    void SetMat4(UniformID id, const Matrix4f &value);
+    void SetTexture(UniformID id, Texture2D texture, int unit);
+    void SetCubeMap(UniformID id, unsigned int cubemapId, int unit);
+
+    // Uniform 接口 (按名字, 每次调用都要驻留查找; 热路径请用 UniformID)
     void SetInt(const std::string &name, int value);
     void SetFloat(const std::string &name, float value);
 
@@ -42,9 +79,50 @@ public:
                 const std::unordered_map<std::string, Vector4f> &customVector4);
 
     int GetLocation(const std::string &name);
+    int GetLocation(UniformID id);
+
+    // 实例化变体: 以 #define INSTANCING 重新编译同一对 vs/fs, 首次调用时创建
+    // vs 不含 INSTANCING 分支或编译失败时返回 nullptr, 调用方逐对象绘制
+    ShaderWrapper *GetInstancedVariant();
+
+    // uniform 属于 program 状态, 切换 shader 后仍保留:
+    // 每视图的 uniform 块(矩阵/光照/时间)在同一 stamp 内只需上传一次
+    bool NeedsFrameUniforms(uint64_t frameStamp)
+    {
+        if (m_frameStamp == frameStamp)
+            return false;
+        m_frameStamp = frameStamp;
+        m_lastMaterial = nullptr;
+        return true;
+    }
+    // 与上次上传的材质相同则跳过材质 uniform; 新的 stamp 会让其失效
+    bool NeedsMaterialUniforms(const void *material)
+    {
+        if (m_lastMaterial == material)
+            return false;
+        m_lastMaterial = material;
+        return true;
+    }
 
 private:
+    ShaderWrapper() = default;
     std::string LoadVSText(const std::string &path);
     Shader m_shader;
-    std::unordered_map<std::string, int> m_locationCache;
+    std::string m_vsPath;
+    std::string m_fsPath;
+    std::unique_ptr<ShaderWrapper> m_instanced;
+    bool m_instancedTried = false;
+
+    // 按 UniformID 下标: location(未解析为 UNRESOLVED_LOCATION) 与上次上传的值
+    struct UniformSlot
+    {
+        int location;
+        uint8_t size = 0;
+        float value[16];
+    };
+    std::vector<UniformSlot> m_slots;
+    // 值与缓存相同返回 -1; 否则记录新值并返回 location
+    int PrepareUpload(UniformID id, const void *data, uint8_t size);
+    uint64_t m_frameStamp = 0;
+    const void *m_lastMaterial = nullptr;
 };
\ No newline at end of file
@@ -0,0 +1,118 @@
+#pragma once
+
+// 4 宽 SIMD 内核: x86 用 SSE, ARM 用 NEON, 其余平台退回标量
+// 逐通道的乘加顺序与原标量实现保持一致, 结果逐位相同(未开启 FMA 收缩时)
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define MATH_SIMD_SSE 1
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define MATH_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace MathSimd
+{
+    // 列主序 4x4: out = a * b, out 可与 a/b 相同
+    inline void Mat4Mul(const float *a, const float *b, float *out)
+    {
+#if defined(MATH_SIMD_SSE)
+        __m128 a0 = _mm_loadu_ps(a);
+        __m128 a1 = _mm_loadu_ps(a + 4);
+        __m128 a2 = _mm_loadu_ps(a + 8);
+        __m128 a3 = _mm_loadu_ps(a + 12);
+        __m128 cols[4];
+        for (int k = 0; k < 4; k++)
+        {
+            const float *bk = b + 4 * k;
+            __m128 r = _mm_mul_ps(a0, _mm_set1_ps(bk[0]));
+            r = _mm_add_ps(r, _mm_mul_ps(a1, _mm_set1_ps(bk[1])));
+            r = _mm_add_ps(r, _mm_mul_ps(a2, _mm_set1_ps(bk[2])));
+            r = _mm_add_ps(r, _mm_mul_ps(a3, _mm_set1_ps(bk[3])));
+            cols[k] = r;
+        }
+        for (int k = 0; k < 4; k++)
+            _mm_storeu_ps(out + 4 * k, cols[k]);
+#elif defined(MATH_SIMD_NEON)
+        float32x4_t a0 = vld1q_f32(a);
+        float32x4_t a1 = vld1q_f32(a + 4);
+        float32x4_t a2 = vld1q_f32(a + 8);
+        float32x4_t a3 = vld1q_f32(a + 12);
+        float32x4_t cols[4];
+        for (int k = 0; k < 4; k++)
+        {
+            const float *bk = b + 4 * k;
+            float32x4_t r = vmulq_n_f32(a0, bk[0]);
+            r = vaddq_f32(r, vmulq_n_f32(a1, bk[1]));
+            r = vaddq_f32(r, vmulq_n_f32(a2, bk[2]));
+            r = vaddq_f32(r, vmulq_n_f32(a3, bk[3]));
+            cols[k] = r;
+        }
+        for (int k = 0; k < 4; k++)
+            vst1q_f32(out + 4 * k, cols[k]);
+#else
+        float result[16];
+        for (int k = 0; k < 4; k++)
+        {
+            for (int i = 0; i < 4; i++)
+            {
+                result[4 * k + i] = a[i] * b[4 * k] + a[4 + i] * b[4 * k + 1] +
+                                    a[8 + i] * b[4 * k + 2] + a[12 + i] * b[4 * k + 3];
+            }
+        }
+        for (int i = 0; i < 16; i++)
+            out[i] = result[i];
+#endif
+    }
+
+    // 列主序 4x4 乘 4 维向量
+    inline void Mat4MulVec4(const float *m, const float *v, float *out)
+    {
+#if defined(MATH_SIMD_SSE)
+        __m128 r = _mm_mul_ps(_mm_loadu_ps(m), _mm_set1_ps(v[0]));
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(m + 4), _mm_set1_ps(v[1])));
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(m + 8), _mm_set1_ps(v[2])));
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(m + 12), _mm_set1_ps(v[3])));
+        _mm_storeu_ps(out, r);
+#elif defined(MATH_SIMD_NEON)
+        float32x4_t r = vmulq_n_f32(vld1q_f32(m), v[0]);
+        r = vaddq_f32(r, vmulq_n_f32(vld1q_f32(m + 4), v[1]));
+        r = vaddq_f32(r, vmulq_n_f32(vld1q_f32(m + 8), v[2]));
+        r = vaddq_f32(r, vmulq_n_f32(vld1q_f32(m + 12), v[3]));
+        vst1q_f32(out, r);
+#else
+        float result[4];
+        for (int i = 0; i < 4; i++)
+            result[i] = m[i] * v[0] + m[4 + i] * v[1] + m[8 + i] * v[2] + m[12 + i] * v[3];
+        for (int i = 0; i < 4; i++)
+            out[i] = result[i];
+#endif
+    }
+
+    // 四元数乘法, 分量顺序 (w, x, y, z)
+    inline void QuatMul(const float *q0, const float *q1, float *out)
+    {
+#if defined(MATH_SIMD_SSE)
+        __m128 b = _mm_loadu_ps(q1);                                // ( w,  x,  y,  z)
+        __m128 bx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 3, 0, 1)); // ( x,  w,  z,  y)
+        __m128 by = _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2)); // ( y,  z,  w,  x)
+        __m128 bz = _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 1, 2, 3)); // ( z,  y,  x,  w)
+        bx = _mm_mul_ps(bx, _mm_setr_ps(-1.0f, 1.0f, -1.0f, 1.0f));
+        by = _mm_mul_ps(by, _mm_setr_ps(-1.0f, 1.0f, 1.0f, -1.0f));
+        bz = _mm_mul_ps(bz, _mm_setr_ps(-1.0f, -1.0f, 1.0f, 1.0f));
+        __m128 r = _mm_mul_ps(_mm_set1_ps(q0[0]), b);
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(q0[1]), bx));
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(q0[2]), by));
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(q0[3]), bz));
+        _mm_storeu_ps(out, r);
+#else
+        float w = q0[0] * q1[0] - q0[1] * q1[1] - q0[2] * q1[2] - q0[3] * q1[3];
+        float x = q0[0] * q1[1] + q0[1] * q1[0] + q0[2] * q1[3] - q0[3] * q1[2];
+        float y = q0[0] * q1[2] - q0[1] * q1[3] + q0[2] * q1[0] + q0[3] * q1[1];
+        float z = q0[0] * q1[3] + q0[1] * q1[2] - q0[2] * q1[1] + q0[3] * q1[0];
+        out[0] = w;
+        out[1] = x;
+        out[2] = y;
+        out[3] = z;
+#endif
+    }
+}
@@ -11,40 +11,6 @@
 #include "Engine/Math/LinearAlgebra/Vector/Vector3f.h"
 #include "Engine/Math/LinearAlgebra/Vector/Vector4f.h"
 
-Matrix4f::Matrix4f(float fill)
-{
-    for (int i = 0; i < 16; ++i)
-    {
-        m_data[i] = fill;
-    }
-}
-
-Matrix4f::Matrix4f(float m00, float m01, float m02, float m03,
-                   float m10, float m11, float m12, float m13,
-                   float m20, float m21, float m22, float m23,
-                   float m30, float m31, float m32, float m33)
-{
-    m_data[0] = m00;
-    m_data[1] = m10;
-    m_data[2] = m20;
-    m_data[3] = m30;
-
-    m_data[4] = m01;
-    m_data[5] = m11;
-    m_data[6] = m21;
-    m_data[7] = m31;
-
-    m_data[8] = m02;
-    m_data[9] = m12;
-    m_data[10] = m22;
-    m_data[11] = m32;
-
-    m_data[12] = m03;
-    m_data[13] = m13;
-    m_data[14] = m23;
-    m_data[15] = m33;
-}
-
 Matrix4f &Matrix4f::operator/=(float d)
 {
     for (int ii = 0; ii < 16; ii++)
@@ -72,30 +38,6 @@ Matrix4f::Matrix4f(const Vector4f &v0, const Vector4f &v1, const Vector4f &v2, c
     }
 }
 
-Matrix4f::Matrix4f(const Matrix4f &rm)
-{
-    memcpy(m_data, rm.m_data, 16 * sizeof(float));
-}
-
-Matrix4f &Matrix4f::operator=(const Matrix4f &rm)
-{
-    if (this != &rm)
-    {
-        memcpy(m_data, rm.m_data, 16 * sizeof(float));
-    }
-    return *this;
-}
-
-const float &Matrix4f::operator()(int i, int j) const
-{
-    return m_data[j * 4 + i];
-}
-
-float &Matrix4f::operator()(int i, int j)
-{
-    return m_data[j * 4 + i];
-}
-
 Vector4f Matrix4f::getRow(int i) const
 {
     return Vector4f(
@@ -113,17 +55,6 @@ void Matrix4f::setRow(int i, const Vector4f &v)
     m_data[i + 12] = v.w();
 }
 
-Vector4f Matrix4f::getCol(int j) const
-{
-    int colStart = 4 * j;
-
-    return Vector4f(
-        m_data[colStart],
-        m_data[colStart + 1],
-        m_data[colStart + 2],
-        m_data[colStart + 3]);
-}
-
 void Matrix4f::setCol(int j, const Vector4f &v)
 {
     int colStart = 4 * j;
@@ -326,18 +257,6 @@ Matrix4f Matrix4f::ones()
     return m;
 }
 
-Matrix4f Matrix4f::identity()
-{
-    Matrix4f m;
-
-    m(0, 0) = 1;
-    m(1, 1) = 1;
-    m(2, 2) = 1;
-    m(3, 3) = 1;
-
-    return m;
-}
-
 Matrix4f Matrix4f::translation(float x, float y, float z)
 {
     return Matrix4f(
@@ -347,18 +266,6 @@ Matrix4f Matrix4f::translation(float x, float y, float z)
         0, 0, 0, 1);
 }
 
-Matrix4f Matrix4f::translation(const Vector3f &rTranslation)
-{
-    return Matrix4f(
-        1, 0, 0, rTranslation.x(),
-        0, 1, 0, rTranslation.y(),
-        0, 0, 1, rTranslation.z(),
-        0, 0, 0, 1);
-}
-Vector3f Matrix4f::getTranslation() const
-{
-    return Vector3f(m_data[12], m_data[13], m_data[14]);
-}
 Vector3f Matrix4f::getScale() const
 {
     float sx = Vector3f(m_data[0], m_data[1], m_data[2]).Length();
@@ -677,55 +584,3 @@ Matrix4f Matrix4f::infinitePerspectiveProjection(float fLeft, float fRight,
 
     return projection;
 }
-
-Matrix4f Matrix4f::scale(const Vector3f &scale)
-{
-    Matrix4f m = Matrix4f::identity();
-
-    m(0, 0) = scale.x();
-    m(1, 1) = scale.y();
-    m(2, 2) = scale.z();
-
-    return m;
-}
-Matrix4f Matrix4f::CreateTransform(const Vector3f &pos, const Quat4f &rot, const Vector3f &sc)
-{
-    return translation(pos) * rotation(rot) * scale(sc);
-}
-
-//////////////////////////////////////////////////////////////////////////
-// Operators
-//////////////////////////////////////////////////////////////////////////
-
-Vector4f operator*(const Matrix4f &m, const Vector4f &v)
-{
-    Vector4f output(0, 0, 0, 0);
-
-    for (int i = 0; i < 4; ++i)
-    {
-        for (int j = 0; j < 4; ++j)
-        {
-            output[i] += m(i, j) * v[j];
-        }
-    }
-
-    return output;
-}
-
-Matrix4f operator*(const Matrix4f &x, const Matrix4f &y)
-{
-    Matrix4f product; // zeroes
-
-    for (int i = 0; i < 4; ++i)
-    {
-        for (int j = 0; j < 4; ++j)
-        {
-            for (int k = 0; k < 4; ++k)
-            {
-                product(i, k) += x(i, j) * y(j, k);
-            }
-        }
-    }
-
-    return product;
-}
@@ -3,12 +3,13 @@
 #include "raylib.h"
 #include "raymath.h"
 #include <string.h>
+#include "Engine/Math/Core/Simd.h"
+#include "Engine/Math/LinearAlgebra/Vector/Vector3f.h"
+#include "Engine/Math/LinearAlgebra/Vector/Vector4f.h"
+#include "Quat4f.h"
 
 class Matrix2f;
 class Matrix3f;
-class Quat4f;
-class Vector3f;
-class Vector4f;
 
 class Matrix4f
 {
@@ -129,6 +130,149 @@ private:
 	float m_data[16];
 };
 
-Vector4f operator*(const Matrix4f &m, const Vector4f &v);
+inline Vector4f operator*(const Matrix4f &m, const Vector4f &v);
 
-Matrix4f operator*(const Matrix4f &x, const Matrix4f &y);
+inline Matrix4f operator*(const Matrix4f &x, const Matrix4f &y);
+
+// 热点运算内联实现
+inline Matrix4f::Matrix4f(float fill)
+{
+    for (int i = 0; i < 16; ++i)
+    {
+        m_data[i] = fill;
+    }
+}
+
+inline Matrix4f::Matrix4f(float m00, float m01, float m02, float m03,
+                   float m10, float m11, float m12, float m13,
+                   float m20, float m21, float m22, float m23,
+                   float m30, float m31, float m32, float m33)
+{
+    m_data[0] = m00;
+    m_data[1] = m10;
+    m_data[2] = m20;
+    m_data[3] = m30;
+
+    m_data[4] = m01;
+    m_data[5] = m11;
+    m_data[6] = m21;
+    m_data[7] = m31;
+
+    m_data[8] = m02;
+    m_data[9] = m12;
+    m_data[10] = m22;
+    m_data[11] = m32;
+
+    m_data[12] = m03;
+    m_data[13] = m13;
+    m_data[14] = m23;
+    m_data[15] = m33;
+}
+
+inline Matrix4f::Matrix4f(const Matrix4f &rm)
+{
+    memcpy(m_data, rm.m_data, 16 * sizeof(float));
+}
+
+inline Matrix4f &Matrix4f::operator=(const Matrix4f &rm)
+{
+    if (this != &rm)
+    {
+        memcpy(m_data, rm.m_data, 16 * sizeof(float));
+    }
+    return *this;
+}
+
+inline const float &Matrix4f::operator()(int i, int j) const
+{
+    return m_data[j * 4 + i];
+}
+
+inline float &Matrix4f::operator()(int i, int j)
+{
+    return m_data[j * 4 + i];
+}
+
+inline Vector4f Matrix4f::getCol(int j) const
+{
+    int colStart = 4 * j;
+
+    return Vector4f(
+        m_data[colStart],
+        m_data[colStart + 1],
+        m_data[colStart + 2],
+        m_data[colStart + 3]);
+}
+
+inline Vector3f Matrix4f::getTranslation() const
+{
+    return Vector3f(m_data[12], m_data[13], m_data[14]);
+}
+
+inline Matrix4f Matrix4f::identity()
+{
+    Matrix4f m;
+
+    m(0, 0) = 1;
+    m(1, 1) = 1;
+    m(2, 2) = 1;
+    m(3, 3) = 1;
+
+    return m;
+}
+
+inline Matrix4f Matrix4f::translation(const Vector3f &rTranslation)
+{
+    return Matrix4f(
+        1, 0, 0, rTranslation.x(),
+        0, 1, 0, rTranslation.y(),
+        0, 0, 1, rTranslation.z(),
+        0, 0, 0, 1);
+}
+
+inline Matrix4f Matrix4f::scale(const Vector3f &scale)
+{
+    Matrix4f m = Matrix4f::identity();
+
+    m(0, 0) = scale.x();
+    m(1, 1) = scale.y();
+    m(2, 2) = scale.z();
+
+    return m;
+}
+
+// T * R * S 直接展开: 旋转列乘缩放, 平移写入第 4 列, 省去两次 4x4 乘法
+inline Matrix4f Matrix4f::CreateTransform(const Vector3f &pos, const Quat4f &rot, const Vector3f &sc)
+{
+	Quat4f q = rot.normalized();
+
+	float xx = q.x() * q.x();
+	float yy = q.y() * q.y();
+	float zz = q.z() * q.z();
+	float xy = q.x() * q.y();
+	float zw = q.z() * q.w();
+	float xz = q.x() * q.z();
+	float yw = q.y() * q.w();
+	float yz = q.y() * q.z();
+	float xw = q.x() * q.w();
+
+	return Matrix4f(
+		(1.0f - 2.0f * (yy + zz)) * sc.x(), (2.0f * (xy - zw)) * sc.y(), (2.0f * (xz + yw)) * sc.z(), pos.x(),
+		(2.0f * (xy + zw)) * sc.x(), (1.0f - 2.0f * (xx + zz)) * sc.y(), (2.0f * (yz - xw)) * sc.z(), pos.y(),
+		(2.0f * (xz - yw)) * sc.x(), (2.0f * (yz + xw)) * sc.y(), (1.0f - 2.0f * (xx + yy)) * sc.z(), pos.z(),
+		0.0f, 0.0f, 0.0f, 1.0f);
+}
+
+inline Vector4f operator*(const Matrix4f &m, const Vector4f &v)
+{
+	Vector4f output;
+	MathSimd::Mat4MulVec4(&m(0, 0), &v[0], &output[0]);
+	return output;
+}
+
+inline Matrix4f operator*(const Matrix4f &x, const Matrix4f &y)
+{
+	Matrix4f product;
+	MathSimd::Mat4Mul(&x(0, 0), &y(0, 0), &product(0, 0));
+	return product;
+}
@@ -11,42 +11,6 @@ const Quat4f Quat4f::ZERO = Quat4f(0, 0, 0, 0);
 // static
 const Quat4f Quat4f::IDENTITY = Quat4f(1, 0, 0, 0);
 
-Quat4f::Quat4f()
-{
-	m_data[0] = 0;
-	m_data[1] = 0;
-	m_data[2] = 0;
-	m_data[3] = 0;
-}
-
-Quat4f::Quat4f(float w, float x, float y, float z)
-{
-	m_data[0] = w;
-	m_data[1] = x;
-	m_data[2] = y;
-	m_data[3] = z;
-}
-
-Quat4f::Quat4f(const Quat4f &rq)
-{
-	m_data[0] = rq.m_data[0];
-	m_data[1] = rq.m_data[1];
-	m_data[2] = rq.m_data[2];
-	m_data[3] = rq.m_data[3];
-}
-
-Quat4f &Quat4f::operator=(const Quat4f &rq)
-{
-	if (this != (&rq))
-	{
-		m_data[0] = rq.m_data[0];
-		m_data[1] = rq.m_data[1];
-		m_data[2] = rq.m_data[2];
-		m_data[3] = rq.m_data[3];
-	}
-	return (*this);
-}
-
 Quat4f::Quat4f(const Vector3f &v)
 {
 	float cx = cosf(v.x() * 0.5f);
@@ -69,44 +33,6 @@ Quat4f::Quat4f(const Vector4f &v)
 	m_data[3] = v[3];
 }
 
-const float &Quat4f::operator[](int i) const
-{
-	return m_data[i];
-}
-
-float &Quat4f::operator[](int i)
-{
-	return m_data[i];
-}
-
-float Quat4f::w() const
-{
-	return m_data[0];
-}
-
-float Quat4f::x() const
-{
-	return m_data[1];
-}
-
-float Quat4f::y() const
-{
-	return m_data[2];
-}
-
-float Quat4f::z() const
-{
-	return m_data[3];
-}
-
-Vector3f Quat4f::xyz() const
-{
-	return Vector3f(
-		m_data[1],
-		m_data[2],
-		m_data[3]);
-}
-
 Vector4f Quat4f::wxyz() const
 {
 	return Vector4f(
@@ -116,37 +42,6 @@ Vector4f Quat4f::wxyz() const
 		m_data[3]);
 }
 
-float Quat4f::abs() const
-{
-	return sqrt(absSquared());
-}
-
-float Quat4f::absSquared() const
-{
-	return (
-		m_data[0] * m_data[0] +
-		m_data[1] * m_data[1] +
-		m_data[2] * m_data[2] +
-		m_data[3] * m_data[3]);
-}
-
-void Quat4f::normalize()
-{
-	float reciprocalAbs = 1.f / abs();
-
-	m_data[0] *= reciprocalAbs;
-	m_data[1] *= reciprocalAbs;
-	m_data[2] *= reciprocalAbs;
-	m_data[3] *= reciprocalAbs;
-}
-
-Quat4f Quat4f::normalized() const
-{
-	Quat4f q(*this);
-	q.normalize();
-	return q;
-}
-
 void Quat4f::conjugate()
 {
 	m_data[1] = -m_data[1];
@@ -484,56 +379,3 @@ Quat4f Quat4f::XYZRotate(const Vector3f &v)
 // Operators
 //////////////////////////////////////////////////////////////////////////
 
-Quat4f operator+(const Quat4f &q0, const Quat4f &q1)
-{
-	return Quat4f(
-		q0.w() + q1.w(),
-		q0.x() + q1.x(),
-		q0.y() + q1.y(),
-		q0.z() + q1.z());
-}
-
-Quat4f operator-(const Quat4f &q0, const Quat4f &q1)
-{
-	return Quat4f(
-		q0.w() - q1.w(),
-		q0.x() - q1.x(),
-		q0.y() - q1.y(),
-		q0.z() - q1.z());
-}
-
-Quat4f operator*(const Quat4f &q0, const Quat4f &q1)
-{
-	return Quat4f(
-		q0.w() * q1.w() - q0.x() * q1.x() - q0.y() * q1.y() - q0.z() * q1.z(),
-		q0.w() * q1.x() + q0.x() * q1.w() + q0.y() * q1.z() - q0.z() * q1.y(),
-		q0.w() * q1.y() - q0.x() * q1.z() + q0.y() * q1.w() + q0.z() * q1.x(),
-		q0.w() * q1.z() + q0.x() * q1.y() - q0.y() * q1.x() + q0.z() * q1.w());
-}
-
-Quat4f operator*(float f, const Quat4f &q)
-{
-	return Quat4f(
-		f * q.w(),
-		f * q.x(),
-		f * q.y(),
-		f * q.z());
-}
-
-Quat4f operator*(const Quat4f &q, float f)
-{
-	return Quat4f(
-		f * q.w(),
-		f * q.x(),
-		f * q.y(),
-		f * q.z());
-}
-Vector3f operator*(const Quat4f &q, const Vector3f &v)
-{
-	Vector3f q_xyz(q.x(), q.y(), q.z());
-
-	// t = 2 * cross(q_xyz, v)
-	Vector3f t = q_xyz ^ v * 2.0f;
-	// result = v + (q.w * t) + cross(q_xyz, t)
-	return v + (t * q.w()) + (q_xyz ^ t);
-}
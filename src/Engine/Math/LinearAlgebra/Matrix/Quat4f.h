@@ -1,8 +1,9 @@
 #pragma once
-class Vector3f;
-class Vector4f;
-
+#include <cmath>
 #include "Matrix3f.h"
+#include "Engine/Math/Core/Simd.h"
+#include "Engine/Math/LinearAlgebra/Vector/Vector3f.h"
+#include "Engine/Math/LinearAlgebra/Vector/Vector4f.h"
 #include "raylib.h"
 #include "raymath.h"
 
@@ -102,3 +103,162 @@ Quat4f operator*(const Quat4f &q0, const Quat4f &q1);
 Quat4f operator*(float f, const Quat4f &q);
 Quat4f operator*(const Quat4f &q, float f);
 Vector3f operator*(const Quat4f &q, const Vector3f &v); // 旋转向量
+
+// 热点运算内联实现
+inline Quat4f::Quat4f()
+{
+	m_data[0] = 0;
+	m_data[1] = 0;
+	m_data[2] = 0;
+	m_data[3] = 0;
+}
+
+inline Quat4f::Quat4f(float w, float x, float y, float z)
+{
+	m_data[0] = w;
+	m_data[1] = x;
+	m_data[2] = y;
+	m_data[3] = z;
+}
+
+inline Quat4f::Quat4f(const Quat4f &rq)
+{
+	m_data[0] = rq.m_data[0];
+	m_data[1] = rq.m_data[1];
+	m_data[2] = rq.m_data[2];
+	m_data[3] = rq.m_data[3];
+}
+
+inline Quat4f &Quat4f::operator=(const Quat4f &rq)
+{
+	if (this != (&rq))
+	{
+		m_data[0] = rq.m_data[0];
+		m_data[1] = rq.m_data[1];
+		m_data[2] = rq.m_data[2];
+		m_data[3] = rq.m_data[3];
+	}
+	return (*this);
+}
+
+inline const float &Quat4f::operator[](int i) const
+{
+	return m_data[i];
+}
+
+inline float &Quat4f::operator[](int i)
+{
+	return m_data[i];
+}
+
+inline float Quat4f::w() const
+{
+	return m_data[0];
+}
+
+inline float Quat4f::x() const
+{
+	return m_data[1];
+}
+
+inline float Quat4f::y() const
+{
+	return m_data[2];
+}
+
+inline float Quat4f::z() const
+{
+	return m_data[3];
+}
+
+inline Vector3f Quat4f::xyz() const
+{
+	return Vector3f(
+		m_data[1],
+		m_data[2],
+		m_data[3]);
+}
+
+inline float Quat4f::abs() const
+{
+	return sqrt(absSquared());
+}
+
+inline float Quat4f::absSquared() const
+{
+	return (
+		m_data[0] * m_data[0] +
+		m_data[1] * m_data[1] +
+		m_data[2] * m_data[2] +
+		m_data[3] * m_data[3]);
+}
+
+inline void Quat4f::normalize()
+{
+	float reciprocalAbs = 1.f / abs();
+
+	m_data[0] *= reciprocalAbs;
+	m_data[1] *= reciprocalAbs;
+	m_data[2] *= reciprocalAbs;
+	m_data[3] *= reciprocalAbs;
+}
+
+inline Quat4f Quat4f::normalized() const
+{
+	Quat4f q(*this);
+	q.normalize();
+	return q;
+}
+
+inline Quat4f operator+(const Quat4f &q0, const Quat4f &q1)
+{
+	return Quat4f(
+		q0.w() + q1.w(),
+		q0.x() + q1.x(),
+		q0.y() + q1.y(),
+		q0.z() + q1.z());
+}
+
+inline Quat4f operator-(const Quat4f &q0, const Quat4f &q1)
+{
+	return Quat4f(
+		q0.w() - q1.w(),
+		q0.x() - q1.x(),
+		q0.y() - q1.y(),
+		q0.z() - q1.z());
+}
+
+inline Quat4f operator*(const Quat4f &q0, const Quat4f &q1)
+{
+	Quat4f result;
+	MathSimd::QuatMul(&q0[0], &q1[0], &result[0]);
+	return result;
+}
+
+inline Quat4f operator*(float f, const Quat4f &q)
+{
+	return Quat4f(
+		f * q.w(),
+		f * q.x(),
+		f * q.y(),
+		f * q.z());
+}
+
+inline Quat4f operator*(const Quat4f &q, float f)
+{
+	return Quat4f(
+		f * q.w(),
+		f * q.x(),
+		f * q.y(),
+		f * q.z());
+}
+
+inline Vector3f operator*(const Quat4f &q, const Vector3f &v)
+{
+	Vector3f q_xyz(q.x(), q.y(), q.z());
+
+	// t = 2 * cross(q_xyz, v)
+	Vector3f t = q_xyz ^ v * 2.0f;
+	// result = v + (q.w * t) + cross(q_xyz, t)
+	return v + (t * q.w()) + (q_xyz ^ t);
+}
@@ -15,72 +15,6 @@ std::ostream &operator<<(std::ostream &os, const Vector3f &v)
     return os;
 }
 
-Vector3f::Vector3f(const Vector3f &other)
-{
-    m_data[0] = other.m_data[0];
-    m_data[1] = other.m_data[1];
-    m_data[2] = other.m_data[2];
-}
-Vector3f::Vector3f(float val)
-{
-    m_data[0] = val;
-    m_data[1] = val;
-    m_data[2] = val;
-}
-Vector3f::Vector3f(float x, float y, float z)
-{
-    m_data[0] = x;
-    m_data[1] = y;
-    m_data[2] = z;
-}
-
-Vector3f &Vector3f::operator=(const Vector3f &other)
-{
-    if (this != &other)
-    {
-        m_data[0] = other[0];
-        m_data[1] = other[1];
-        m_data[2] = other[2];
-    }
-    return *this;
-}
-
-const float &Vector3f::operator[](int i) const
-{
-    return m_data[i];
-}
-
-float &Vector3f::operator[](int i)
-{
-    return m_data[i];
-}
-float &Vector3f::x()
-{
-    return m_data[0];
-}
-
-float &Vector3f::y()
-{
-    return m_data[1];
-}
-float &Vector3f::z()
-{
-    return m_data[2];
-}
-float Vector3f::x() const
-{
-    return m_data[0];
-}
-
-float Vector3f::y() const
-{
-    return m_data[1];
-}
-float Vector3f::z() const
-{
-    return m_data[2];
-}
-
 Vector2f Vector3f::xy() const
 {
     return Vector2f(m_data[0], m_data[1]);
@@ -96,61 +30,12 @@ Vector2f Vector3f::yz() const
     return Vector2f(m_data[1], m_data[2]);
 }
 
-Vector3f Vector3f::xyz() const
-{
-    return Vector3f(m_data[0], m_data[1], m_data[2]);
-}
-
-Vector3f Vector3f::yzx() const
-{
-    return Vector3f(m_data[1], m_data[2], m_data[0]);
-}
-
-Vector3f Vector3f::zxy() const
-{
-    return Vector3f(m_data[2], m_data[0], m_data[1]);
-}
-
-float Vector3f::Length() const
-{
-    return std::sqrt(LengthSquared());
-}
-
-float Vector3f::LengthSquared() const
-{
-    return m_data[0] * m_data[0] + m_data[1] * m_data[1] + m_data[2] * m_data[2];
-}
-
-void Vector3f::Normalize()
-{
-    float len = Length();
-    if (len > 0.0f)
-    {
-        m_data[0] /= len;
-        m_data[1] /= len;
-        m_data[2] /= len;
-    }
-}
-
-Vector3f Vector3f::Normalized() const
-{
-    Vector3f result(*this);
-    result.Normalize();
-    return result;
-}
 Vector2f Vector3f::Homogenized() const
 {
     return Vector2f(
         m_data[0] / m_data[2],
         m_data[1] / m_data[2]);
 }
-void Vector3f::Negate()
-{
-    m_data[0] = -m_data[0];
-    m_data[1] = -m_data[1];
-    m_data[2] = -m_data[2];
-}
-
 Vector3f Vector3f::RotateByAxixAngle(const Vector3f &axis, float angle)
 {
 
@@ -180,116 +65,7 @@ Vector3f Vector3f::RotateByAxixAngle(const Vector3f &axis, float angle)
     return result;
 }
 
-Vector3f &Vector3f::operator+=(const Vector3f &other)
-{
-    m_data[0] += other.m_data[0];
-    m_data[1] += other.m_data[1];
-    m_data[2] += other.m_data[2];
-    return *this;
-}
-
-Vector3f &Vector3f::operator-=(const Vector3f &other)
-{
-    m_data[0] -= other.m_data[0];
-    m_data[1] -= other.m_data[1];
-    m_data[2] -= other.m_data[2];
-    return *this;
-}
-
-Vector3f &Vector3f::operator*=(float scalar)
-{
-    m_data[0] *= scalar;
-    m_data[1] *= scalar;
-    m_data[2] *= scalar;
-    return *this;
-}
-
-Vector3f &Vector3f::operator/=(float scalar)
-{
-    m_data[0] /= scalar;
-    m_data[1] /= scalar;
-    m_data[2] /= scalar;
-    return *this;
-}
-
 // 逐分量
-Vector3f operator+(const Vector3f &v0, const Vector3f &v1)
-{
-    return Vector3f(v0.x() + v1.x(), v0.y() + v1.y(), v0.z() + v1.z());
-}
-Vector3f operator-(const Vector3f &v0, const Vector3f &v1)
-{
-    return Vector3f(v0.x() - v1.x(), v0.y() - v1.y(), v0.z() - v1.z());
-}
-Vector3f operator&(const Vector3f &v0, const Vector3f &v1)
-{
-    return Vector3f(v0.x() * v1.x(), v0.y() * v1.y(), v0.z() * v1.z());
-}
-Vector3f operator/(const Vector3f &v0, const Vector3f &v1)
-{
-    return Vector3f(v0.x() / v1.x(), v0.y() / v1.y(), v0.z() / v1.z());
-}
-
-float operator*(const Vector3f &v0, const Vector3f &v1)
-{
-    return v0.x() * v1.x() + v0.y() * v1.y() + v0.z() * v1.z();
-}
-Vector3f operator^(const Vector3f &v0, const Vector3f &v1)
-{
-    return Vector3f(v0.y() * v1.z() - v0.z() * v1.y(),
-                    v0.z() * v1.x() - v0.x() * v1.z(),
-                    v0.x() * v1.y() - v0.y() * v1.x());
-}
-
-Vector3f operator-(const Vector3f &v)
-{
-    return Vector3f(-v.x(), -v.y(), -v.z());
-}
-
-Vector3f operator*(float f, const Vector3f &v)
-{
-    return Vector3f(f * v.x(), f * v.y(), f * v.z());
-}
-Vector3f operator*(const Vector3f &v, float f)
-{
-    return Vector3f(v.x() * f, v.y() * f, v.z() * f);
-}
-Vector3f operator/(const Vector3f &v, float f)
-{
-    if (f == 0.0f)
-    {
-        throw std::runtime_error("Division by zero in Vector3f operator/");
-    }
-    return Vector3f(v.x() / f, v.y() / f, v.z() / f);
-}
-
-float Vector3f::Distance(const Vector3f &a, const Vector3f &b)
-{
-    return (a - b).Length();
-}
-
-Vector3f Vector3f::Lerp(const Vector3f &a, const Vector3f &b, float t)
-{
-    return t * b + (1 - t) * a;
-}
-
-bool operator==(const Vector3f &v0, const Vector3f &v1)
-{
-    return Vector3f::Distance(v0, v1) < 1e-5f;
-}
-
-bool operator!=(const Vector3f &v0, const Vector3f &v1)
-{
-    return !(v0 == v1);
-}
-Vector3f Vector3f::Min(const Vector3f &a, const Vector3f &b)
-{
-    return Vector3f(std::min(a.x(), b.x()), std::min(a.y(), b.y()), std::min(a.z(), b.z()));
-}
-Vector3f Vector3f::Max(const Vector3f &a, const Vector3f &b)
-{
-    return Vector3f(std::max(a.x(), b.x()), std::max(a.y(), b.y()), std::max(a.z(), b.z()));
-}
 #ifndef M_PI
 #define M_PI 3.14159265358979323846f
 #endif
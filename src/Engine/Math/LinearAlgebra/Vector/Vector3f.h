@@ -3,6 +3,9 @@
 #include "raymath.h"
 #include <nlohmann/json.hpp>
 #include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
 class Vector2f;
 
 using json = nlohmann::json;
@@ -104,3 +107,244 @@ Vector3f operator/(const Vector3f &v, float f);
 
 bool operator==(const Vector3f &v0, const Vector3f &v1);
 bool operator!=(const Vector3f &v0, const Vector3f &v1);
+
+// 热点运算内联实现, 物理/渲染内层循环中不再产生函数调用
+inline Vector3f::Vector3f(const Vector3f &other)
+{
+    m_data[0] = other.m_data[0];
+    m_data[1] = other.m_data[1];
+    m_data[2] = other.m_data[2];
+}
+
+inline Vector3f::Vector3f(float val)
+{
+    m_data[0] = val;
+    m_data[1] = val;
+    m_data[2] = val;
+}
+
+inline Vector3f::Vector3f(float x, float y, float z)
+{
+    m_data[0] = x;
+    m_data[1] = y;
+    m_data[2] = z;
+}
+
+inline Vector3f &Vector3f::operator=(const Vector3f &other)
+{
+    if (this != &other)
+    {
+        m_data[0] = other[0];
+        m_data[1] = other[1];
+        m_data[2] = other[2];
+    }
+    return *this;
+}
+
+inline const float &Vector3f::operator[](int i) const
+{
+    return m_data[i];
+}
+
+inline float &Vector3f::operator[](int i)
+{
+    return m_data[i];
+}
+
+inline float &Vector3f::x()
+{
+    return m_data[0];
+}
+
+inline float &Vector3f::y()
+{
+    return m_data[1];
+}
+
+inline float &Vector3f::z()
+{
+    return m_data[2];
+}
+
+inline float Vector3f::x() const
+{
+    return m_data[0];
+}
+
+inline float Vector3f::y() const
+{
+    return m_data[1];
+}
+
+inline float Vector3f::z() const
+{
+    return m_data[2];
+}
+
+inline Vector3f Vector3f::xyz() const
+{
+    return Vector3f(m_data[0], m_data[1], m_data[2]);
+}
+
+inline Vector3f Vector3f::yzx() const
+{
+    return Vector3f(m_data[1], m_data[2], m_data[0]);
+}
+
+inline Vector3f Vector3f::zxy() const
+{
+    return Vector3f(m_data[2], m_data[0], m_data[1]);
+}
+
+inline float Vector3f::Length() const
+{
+    return std::sqrt(LengthSquared());
+}
+
+inline float Vector3f::LengthSquared() const
+{
+    return m_data[0] * m_data[0] + m_data[1] * m_data[1] + m_data[2] * m_data[2];
+}
+
+inline void Vector3f::Normalize()
+{
+    float len = Length();
+    if (len > 0.0f)
+    {
+        m_data[0] /= len;
+        m_data[1] /= len;
+        m_data[2] /= len;
+    }
+}
+
+inline Vector3f Vector3f::Normalized() const
+{
+    Vector3f result(*this);
+    result.Normalize();
+    return result;
+}
+
+inline void Vector3f::Negate()
+{
+    m_data[0] = -m_data[0];
+    m_data[1] = -m_data[1];
+    m_data[2] = -m_data[2];
+}
+
+inline Vector3f &Vector3f::operator+=(const Vector3f &other)
+{
+    m_data[0] += other.m_data[0];
+    m_data[1] += other.m_data[1];
+    m_data[2] += other.m_data[2];
+    return *this;
+}
+
+inline Vector3f &Vector3f::operator-=(const Vector3f &other)
+{
+    m_data[0] -= other.m_data[0];
+    m_data[1] -= other.m_data[1];
+    m_data[2] -= other.m_data[2];
+    return *this;
+}
+
+inline Vector3f &Vector3f::operator*=(float scalar)
+{
+    m_data[0] *= scalar;
+    m_data[1] *= scalar;
+    m_data[2] *= scalar;
+    return *this;
+}
+
+inline Vector3f &Vector3f::operator/=(float scalar)
+{
+    m_data[0] /= scalar;
+    m_data[1] /= scalar;
+    m_data[2] /= scalar;
+    return *this;
+}
+
+inline Vector3f operator+(const Vector3f &v0, const Vector3f &v1)
+{
+    return Vector3f(v0.x() + v1.x(), v0.y() + v1.y(), v0.z() + v1.z());
+}
+
+inline Vector3f operator-(const Vector3f &v0, const Vector3f &v1)
+{
+    return Vector3f(v0.x() - v1.x(), v0.y() - v1.y(), v0.z() - v1.z());
+}
+
+inline Vector3f operator&(const Vector3f &v0, const Vector3f &v1)
+{
+    return Vector3f(v0.x() * v1.x(), v0.y() * v1.y(), v0.z() * v1.z());
+}
+
+inline Vector3f operator/(const Vector3f &v0, const Vector3f &v1)
+{
+    return Vector3f(v0.x() / v1.x(), v0.y() / v1.y(), v0.z() / v1.z());
+}
+
+inline float operator*(const Vector3f &v0, const Vector3f &v1)
+{
+    return v0.x() * v1.x() + v0.y() * v1.y() + v0.z() * v1.z();
+}
+
+inline Vector3f operator^(const Vector3f &v0, const Vector3f &v1)
+{
+    return Vector3f(v0.y() * v1.z() - v0.z() * v1.y(),
+                    v0.z() * v1.x() - v0.x() * v1.z(),
+                    v0.x() * v1.y() - v0.y() * v1.x());
+}
+
+inline Vector3f operator-(const Vector3f &v)
+{
+    return Vector3f(-v.x(), -v.y(), -v.z());
+}
+
+inline Vector3f operator*(float f, const Vector3f &v)
+{
+    return Vector3f(f * v.x(), f * v.y(), f * v.z());
+}
+
+inline Vector3f operator*(const Vector3f &v, float f)
+{
+    return Vector3f(v.x() * f, v.y() * f, v.z() * f);
+}
+
+inline Vector3f operator/(const Vector3f &v, float f)
+{
+    if (f == 0.0f)
+    {
+        throw std::runtime_error("Division by zero in Vector3f operator/");
+    }
+    return Vector3f(v.x() / f, v.y() / f, v.z() / f);
+}
+
+inline float Vector3f::Distance(const Vector3f &a, const Vector3f &b)
+{
+    return (a - b).Length();
+}
+
+inline Vector3f Vector3f::Lerp(const Vector3f &a, const Vector3f &b, float t)
+{
+    return t * b + (1 - t) * a;
+}
+
+inline bool operator==(const Vector3f &v0, const Vector3f &v1)
+{
+    return Vector3f::Distance(v0, v1) < 1e-5f;
+}
+
+inline bool operator!=(const Vector3f &v0, const Vector3f &v1)
+{
+    return !(v0 == v1);
+}
+
+inline Vector3f Vector3f::Min(const Vector3f &a, const Vector3f &b)
+{
+    return Vector3f(std::min(a.x(), b.x()), std::min(a.y(), b.y()), std::min(a.z(), b.z()));
+}
+
+inline Vector3f Vector3f::Max(const Vector3f &a, const Vector3f &b)
+{
+    return Vector3f(std::max(a.x(), b.x()), std::max(a.y(), b.y()), std::max(a.z(), b.z()));
+}
@@ -1,8 +1,9 @@
 #pragma once
 #include "raylib.h"
 #include "raymath.h"
+#include <cmath>
+#include "Vector3f.h"
 class Vector2f;
-class Vector3f;
 class Vector4f
 {
 public:
@@ -96,3 +97,148 @@ Vector4f operator/(const Vector4f &v, float f);
 
 bool operator==(const Vector4f &v0, const Vector4f &v1);
 bool operator!=(const Vector4f &v0, const Vector4f &v1);
+
+// 热点运算内联实现
+inline Vector4f::Vector4f(float f)
+{
+	m_data[0] = f;
+	m_data[1] = f;
+	m_data[2] = f;
+	m_data[3] = f;
+}
+
+inline Vector4f::Vector4f(float fx, float fy, float fz, float fw)
+{
+	m_data[0] = fx;
+	m_data[1] = fy;
+	m_data[2] = fz;
+	m_data[3] = fw;
+}
+
+inline Vector4f::Vector4f(const Vector3f &xyz, float w)
+{
+	m_data[0] = xyz.x();
+	m_data[1] = xyz.y();
+	m_data[2] = xyz.z();
+	m_data[3] = w;
+}
+
+inline Vector4f::Vector4f(const Vector4f &rv)
+{
+	m_data[0] = rv.m_data[0];
+	m_data[1] = rv.m_data[1];
+	m_data[2] = rv.m_data[2];
+	m_data[3] = rv.m_data[3];
+}
+
+inline Vector4f &Vector4f::operator=(const Vector4f &rv)
+{
+	if (this != &rv)
+	{
+		m_data[0] = rv.m_data[0];
+		m_data[1] = rv.m_data[1];
+		m_data[2] = rv.m_data[2];
+		m_data[3] = rv.m_data[3];
+	}
+	return *this;
+}
+
+inline const float &Vector4f::operator[](int i) const
+{
+	return m_data[i];
+}
+
+inline float &Vector4f::operator[](int i)
+{
+	return m_data[i];
+}
+
+inline float &Vector4f::x()
+{
+	return m_data[0];
+}
+
+inline float &Vector4f::y()
+{
+	return m_data[1];
+}
+
+inline float &Vector4f::z()
+{
+	return m_data[2];
+}
+
+inline float &Vector4f::w()
+{
+	return m_data[3];
+}
+
+inline float Vector4f::x() const
+{
+	return m_data[0];
+}
+
+inline float Vector4f::y() const
+{
+	return m_data[1];
+}
+
+inline float Vector4f::z() const
+{
+	return m_data[2];
+}
+
+inline float Vector4f::w() const
+{
+	return m_data[3];
+}
+
+inline Vector3f Vector4f::xyz() const
+{
+	return Vector3f(m_data[0], m_data[1], m_data[2]);
+}
+
+inline Vector4f operator+(const Vector4f &v0, const Vector4f &v1)
+{
+	return Vector4f(v0.x() + v1.x(), v0.y() + v1.y(), v0.z() + v1.z(), v0.w() + v1.w());
+}
+
+inline Vector4f operator-(const Vector4f &v0, const Vector4f &v1)
+{
+	return Vector4f(v0.x() - v1.x(), v0.y() - v1.y(), v0.z() - v1.z(), v0.w() - v1.w());
+}
+
+inline Vector4f operator&(const Vector4f &v0, const Vector4f &v1)
+{
+	return Vector4f(v0.x() * v1.x(), v0.y() * v1.y(), v0.z() * v1.z(), v0.w() * v1.w());
+}
+
+inline Vector4f operator/(const Vector4f &v0, const Vector4f &v1)
+{
+	return Vector4f(v0.x() / v1.x(), v0.y() / v1.y(), v0.z() / v1.z(), v0.w() / v1.w());
+}
+
+inline Vector4f operator-(const Vector4f &v)
+{
+	return Vector4f(-v.x(), -v.y(), -v.z(), -v.w());
+}
+
+inline float operator*(const Vector4f &v0, const Vector4f &v1)
+{
+	return v0.x() * v1.x() + v0.y() * v1.y() + v0.z() * v1.z() + v0.w() * v1.w();
+}
+
+inline Vector4f operator*(float f, const Vector4f &v)
+{
+	return Vector4f(f * v.x(), f * v.y(), f * v.z(), f * v.w());
+}
+
+inline Vector4f operator*(const Vector4f &v, float f)
+{
+	return Vector4f(f * v.x(), f * v.y(), f * v.z(), f * v.w());
+}
+
+inline Vector4f operator/(const Vector4f &v, float f)
+{
+	return Vector4f(v[0] / f, v[1] / f, v[2] / f, v[3] / f);
+}
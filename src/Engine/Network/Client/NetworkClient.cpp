@@ -1,12 +1,16 @@
 #include "NetworkClient.h"
 #include "Engine/Network/Transport/NBNetTransport.h"
+#include "Engine/Network/Transport/ThreadedTransport.h"
 #include <iostream>
 #include <utility>
 
 // ────────────────────────────────────────────────────────────────────
-NetworkClient::NetworkClient()
-    : m_transport(std::make_unique<NBNetTransport>())
+NetworkClient::NetworkClient(bool threadedIO)
 {
+    if (threadedIO)
+        m_transport = std::make_unique<ThreadedTransport>(std::make_unique<NBNetTransport>());
+    else
+        m_transport = std::make_unique<NBNetTransport>();
 }
 
 NetworkClient::~NetworkClient()
@@ -31,6 +35,7 @@ bool NetworkClient::Connect(const std::string &host, uint16_t port)
                                  {
         std::cout << "[NetworkClient] Disconnected from server\n";
         m_localClientID = INVALID_CLIENT_ID;
+        m_snapshotDecoder.Reset();
         if (!m_playerMeta.empty())
         {
             m_playerMeta.clear();
@@ -38,8 +43,8 @@ bool NetworkClient::Connect(const std::string &host, uint16_t port)
                 m_onPlayerMetaChanged();
         } });
 
-    m_transport->SetOnReceive([this](const uint8_t *data, size_t len, uint8_t ch)
-                              { OnRawReceive(data, len, ch); });
+    m_transport->SetOnReceive([this](const uint8_t *data, size_t len, uint8_t ch, double receiveTimeSec)
+                              { OnRawReceive(data, len, ch, receiveTimeSec); });
 
     return m_transport->Connect(host, port);
 }
@@ -55,6 +60,7 @@ void NetworkClient::Disconnect()
     }
     m_transport->Disconnect();
     m_localClientID = INVALID_CLIENT_ID;
+    m_snapshotDecoder.Reset();
     if (!m_playerMeta.empty())
     {
         m_playerMeta.clear();
@@ -85,17 +91,18 @@ void NetworkClient::SendPositionUpdate(NetObjectID objectID,
 {
     if (!IsConnected())
         return;
-    auto pkt = PacketSerializer::WritePositionUpdate(
-        m_localClientID, objectID, transform);
-    m_transport->Send(pkt, 1); // unreliable channel
+    PacketSerializer::BufferWriter out(m_sendBuffer);
+    PacketSerializer::WritePositionUpdate(out, m_localClientID, objectID, transform);
+    m_transport->Send(out.Data(), out.Size(), 1); // unreliable channel
 }
 
 void NetworkClient::SendObjectRelease(NetObjectID objectID)
 {
     if (!IsConnected())
         return;
-    auto pkt = PacketSerializer::WriteObjectRelease(m_localClientID, objectID);
-    m_transport->Send(pkt, 0); // reliable channel
+    PacketSerializer::BufferWriter out(m_sendBuffer);
+    PacketSerializer::WriteObjectRelease(out, m_localClientID, objectID);
+    m_transport->Send(out.Data(), out.Size(), 0); // reliable channel
     m_transport->FlushSend();  // ensure it goes out immediately
 }
 
@@ -103,8 +110,9 @@ void NetworkClient::SendHeartbeat()
 {
     if (!IsConnected())
         return;
-    auto pkt = PacketSerializer::WriteHeartbeat(m_localClientID);
-    m_transport->Send(pkt, 0); // reliable keep-alive
+    PacketSerializer::BufferWriter out(m_sendBuffer);
+    PacketSerializer::WriteHeartbeat(out, m_localClientID);
+    m_transport->Send(out.Data(), out.Size(), 0); // reliable keep-alive
 }
 
 bool NetworkClient::SendChatMessage(ChatMessageType chatType,
@@ -140,8 +148,9 @@ std::string NetworkClient::GetPlayerNickname(ClientID clientID) const
 
 // ── Incoming dispatch ──────────────────────────────────────────────
 void NetworkClient::OnRawReceive(const uint8_t *data, size_t len,
-                                 uint8_t /*channelID*/)
+                                 uint8_t /*channelID*/, double receiveTimeSec)
 {
+    m_receiveTimeSec = receiveTimeSec;
     if (len < sizeof(NetPacketHeader))
         return;
 
@@ -161,11 +170,26 @@ void NetworkClient::OnRawReceive(const uint8_t *data, size_t len,
     }
     case NetMessageType::PositionBroadcast:
     {
-        auto packet = PacketSerializer::ReadPositionBroadcast(data, len);
+        auto packet = PacketSerializer::ReadPositionBroadcastView(data, len);
         if (m_onPositionBroadcast)
             m_onPositionBroadcast(packet.serverTick, packet.entries);
         break;
     }
+    case NetMessageType::PositionSnapshot:
+    {
+        uint32_t serverTick = 0;
+        if (!m_snapshotDecoder.Decode(data, len, serverTick, m_snapshotEntries))
+            break; // unacked → server keeps the older baseline or falls back to full
+        if (IsConnected())
+        {
+            PacketSerializer::BufferWriter out(m_sendBuffer);
+            PacketSerializer::WriteSnapshotAck(out, m_localClientID, serverTick);
+            m_transport->Send(out.Data(), out.Size(), 1); // unreliable; a newer ack supersedes a lost one
+        }
+        if (m_onPositionBroadcast)
+            m_onPositionBroadcast(serverTick, PacketSerializer::BroadcastEntryView(m_snapshotEntries));
+        break;
+    }
     case NetMessageType::ObjectDespawn:
     {
         auto msg = PacketSerializer::Read<MsgObjectDespawn>(data, len);
@@ -173,6 +197,16 @@ void NetworkClient::OnRawReceive(const uint8_t *data, size_t len,
             m_onObjectDespawn(msg.ownerClientID, msg.objectID);
         break;
     }
+    case NetMessageType::RelevanceExit:
+    {
+        uint32_t serverTick = PacketSerializer::ReadRelevanceExit(data, len, m_relevanceExits);
+        if (m_onRelevanceExit)
+        {
+            for (const auto &ref : m_relevanceExits)
+                m_onRelevanceExit(serverTick, ref.ownerClientID, ref.objectID);
+        }
+        break;
+    }
     case NetMessageType::ChatBroadcast:
     {
         auto chat = PacketSerializer::ReadChatBroadcast(data, len);
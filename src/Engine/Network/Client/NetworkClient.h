@@ -1,6 +1,7 @@
 #pragma once
 #include "Engine/Network/NetTypes.h"
 #include "Engine/Network/Protocol/PacketSerializer.h"
+#include "Engine/Network/Protocol/SnapshotCodec.h"
 #include <vector>
 #include <functional>
 #include <string>
@@ -22,9 +23,12 @@ public:
 
     using OnPositionBroadcastFn =
         std::function<void(uint32_t serverTick,
-                           const std::vector<NetBroadcastEntry> &entries)>;
+                           PacketSerializer::BroadcastEntryView entries)>;
     using OnObjectDespawnFn =
         std::function<void(ClientID ownerClientID, NetObjectID objectID)>;
+    /// The object still exists but is outside this client's area of interest.
+    using OnRelevanceExitFn =
+        std::function<void(uint32_t serverTick, ClientID ownerClientID, NetObjectID objectID)>;
     using OnChatMessageFn =
         std::function<void(ChatMessageType chatType, ClientID senderID,
                            const std::string &senderName, const std::string &text)>;
@@ -33,7 +37,9 @@ public:
                            const std::string &authoritativeNickname)>;
     using OnPlayerMetaChangedFn = std::function<void()>;
 
-    NetworkClient();
+    /// `threadedIO`: poll/flush nbnet on a dedicated I/O thread (ThreadedTransport).
+    /// Callbacks still fire on the thread that calls Poll(). Desktop only.
+    explicit NetworkClient(bool threadedIO = false);
     ~NetworkClient();
 
     NetworkClient(const NetworkClient &) = delete;
@@ -49,6 +55,9 @@ public:
     bool IsConnected() const;
     ConnectionState GetConnectionState() const;
     ClientID GetLocalClientID() const { return m_localClientID; }
+    /// Socket-read time (NetClockSeconds) of the packet being dispatched;
+    /// valid inside the receive callbacks.
+    double GetReceiveTimeSec() const { return m_receiveTimeSec; }
 
     // ── Identity ───────────────────────────────────────────────────
     void SetUUID(const NetUUID &uuid) { m_uuid = uuid; }
@@ -73,6 +82,9 @@ public:
     const std::unordered_map<ClientID, PlayerMeta> &GetPlayerMetaMap() const { return m_playerMeta; }
     std::string GetPlayerNickname(ClientID clientID) const;
 
+    /// Size / decode-time counters for PositionSnapshot packets.
+    const SnapshotCodecStats &GetSnapshotStats() const { return m_snapshotDecoder.GetStats(); }
+
     // ── Callbacks ──────────────────────────────────────────────────
     void SetOnPositionBroadcast(OnPositionBroadcastFn fn)
     {
@@ -82,6 +94,10 @@ public:
     {
         m_onObjectDespawn = std::move(fn);
     }
+    void SetOnRelevanceExit(OnRelevanceExitFn fn)
+    {
+        m_onRelevanceExit = std::move(fn);
+    }
     void SetOnChatMessage(OnChatMessageFn fn)
     {
         m_onChatMessage = std::move(fn);
@@ -96,16 +112,22 @@ public:
     }
 
 private:
-    void OnRawReceive(const uint8_t *data, size_t len, uint8_t channelID);
+    void OnRawReceive(const uint8_t *data, size_t len, uint8_t channelID, double receiveTimeSec);
 
     std::unique_ptr<INetworkTransport> m_transport;
     ClientID m_localClientID = INVALID_CLIENT_ID;
+    double m_receiveTimeSec = 0.0;
     NetUUID m_uuid{};
     OnPositionBroadcastFn m_onPositionBroadcast;
     OnObjectDespawnFn m_onObjectDespawn;
+    OnRelevanceExitFn m_onRelevanceExit;
     OnChatMessageFn m_onChatMessage;
     OnNicknameUpdateResultFn m_onNicknameUpdateResult;
     OnPlayerMetaChangedFn m_onPlayerMetaChanged;
+    SnapshotDecoder m_snapshotDecoder;
+    std::vector<NetBroadcastEntry> m_snapshotEntries; // reused across packets
+    std::vector<NetObjectRef> m_relevanceExits;       // reused across packets
+    std::vector<uint8_t> m_sendBuffer;                // reused by per-tick sends
     std::string m_desiredNickname;
     std::string m_authoritativeNickname;
     std::unordered_map<ClientID, PlayerMeta> m_playerMeta;
@@ -1,4 +1,5 @@
 #pragma once
+#include <chrono>
 #include <cstdint>
 #include <cstring>
 
@@ -12,6 +13,13 @@ using NetObjectID = uint32_t;
 constexpr ClientID INVALID_CLIENT_ID = 0;
 constexpr NetObjectID INVALID_NET_OBJECT_ID = 0;
 
+/// Monotonic clock (seconds) shared by receive timestamps and interpolation.
+inline double NetClockSeconds()
+{
+    using clock = std::chrono::steady_clock;
+    return std::chrono::duration<double>(clock::now().time_since_epoch()).count();
+}
+
 /// Default network settings.
 constexpr uint16_t DEFAULT_SERVER_PORT = 7777;
 constexpr const char *DEFAULT_SERVER_HOST = "127.0.0.1";
@@ -15,6 +15,9 @@ enum class NetMessageType : uint8_t
     PositionBroadcast = 0x11, // S→C  server broadcasts all flight states
     ObjectDespawn = 0x12,     // S→C  server tells clients to remove an object
     ObjectRelease = 0x13,     // C→S  client releases object (stay connected)
+    PositionSnapshot = 0x14,  // S→C  quantized, delta-compressed flight states
+    SnapshotAck = 0x15,       // C→S  client acknowledges a PositionSnapshot tick
+    RelevanceExit = 0x16,     // S→C  objects left the client's area of interest
 
     // ── Chat ─────────────────────────────────
     ChatRequest = 0x40,           // C→S  client sends a chat message
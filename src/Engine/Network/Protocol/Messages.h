@@ -84,6 +84,27 @@ struct MsgPositionBroadcast
     // Followed by `entryCount` NetBroadcastEntry structs in the buffer.
 };
 
+/// S→C : quantized flight states, delta-encoded against `baseTick`
+/// (the newest tick this client has acknowledged).
+/// Variable-length: header + bit-packed entries (see SnapshotCodec.h).
+struct MsgPositionSnapshot
+{
+    NetPacketHeader header{NetMessageType::PositionSnapshot};
+    uint32_t serverTick = 0;
+    uint32_t baseTick = 0;
+    uint8_t hasBaseline = 0; // 0 → every entry is encoded in full
+    uint16_t entryCount = 0;
+    // Followed by the bit stream, padded to a whole byte.
+};
+
+/// C→S : "I have decoded the snapshot of `ackTick`" — the server may delta against it.
+struct MsgSnapshotAck
+{
+    NetPacketHeader header{NetMessageType::SnapshotAck};
+    ClientID clientID = INVALID_CLIENT_ID;
+    uint32_t ackTick = 0;
+};
+
 /// S→C : server notifies that a network object should be removed.
 struct MsgObjectDespawn
 {
@@ -92,6 +113,25 @@ struct MsgObjectDespawn
     NetObjectID objectID = INVALID_NET_OBJECT_ID;
 };
 
+/// One replicated object, identified by its owner.
+struct NetObjectRef
+{
+    ClientID ownerClientID = INVALID_CLIENT_ID;
+    NetObjectID objectID = INVALID_NET_OBJECT_ID;
+};
+
+/// S→C : objects that dropped out of this client's area of interest at
+/// `serverTick`. Unlike ObjectDespawn they still exist on the server — the
+/// client hides them and resumes once they show up in a newer broadcast.
+/// Variable-length: header + count*NetObjectRef.
+struct MsgRelevanceExit
+{
+    NetPacketHeader header{NetMessageType::RelevanceExit};
+    uint32_t serverTick = 0;
+    uint16_t count = 0;
+    // Followed by `count` NetObjectRef structs in the buffer.
+};
+
 /// C→S : client releases an object but stays connected.
 /// Server will broadcast ObjectDespawn to other clients and clear the object state.
 struct MsgObjectRelease
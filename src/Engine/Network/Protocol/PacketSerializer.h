@@ -5,7 +5,9 @@
 #include <cstdint>
 #include <cstring>
 #include <cassert>
+#include <cmath>
 #include <algorithm>
+#include <type_traits>
 #include <utility>
 
 /// Header-only helpers for packing / unpacking network messages.
@@ -13,35 +15,150 @@
 namespace PacketSerializer
 {
 
+    // ────────────────────── Buffer writer ──────────────────────
+
+    /// Serializes into a caller-owned buffer. The buffer is cleared, not freed,
+    /// so a long-lived buffer stops allocating once it has reached its peak size.
+    class BufferWriter
+    {
+    public:
+        explicit BufferWriter(std::vector<uint8_t> &buf) : m_buf(buf) { m_buf.clear(); }
+
+        BufferWriter(const BufferWriter &) = delete;
+        BufferWriter &operator=(const BufferWriter &) = delete;
+
+        template <typename T>
+        void Write(const T &value)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "BufferWriter writes POD only");
+            WriteBytes(&value, sizeof(T));
+        }
+
+        void WriteBytes(const void *data, size_t len)
+        {
+            if (len == 0)
+                return;
+            size_t offset = m_buf.size();
+            m_buf.resize(offset + len);
+            std::memcpy(m_buf.data() + offset, data, len);
+        }
+
+        const uint8_t *Data() const { return m_buf.data(); }
+        size_t Size() const { return m_buf.size(); }
+
+    private:
+        std::vector<uint8_t> &m_buf;
+    };
+
     // ────────────────────── Writers ──────────────────────
+    // Hot-path messages write into a BufferWriter; the vector-returning
+    // overloads remain for one-off packets.
 
-    inline std::vector<uint8_t> WriteClientHello(const NetUUID &uuid)
+    inline void WriteClientHello(BufferWriter &out, const NetUUID &uuid)
     {
         MsgClientHello msg;
         msg.uuid = uuid;
-        std::vector<uint8_t> buf(sizeof(msg));
-        std::memcpy(buf.data(), &msg, sizeof(msg));
-        return buf;
+        out.Write(msg);
     }
 
-    inline std::vector<uint8_t> WriteServerWelcome(ClientID id)
+    inline void WriteServerWelcome(BufferWriter &out, ClientID id)
     {
         MsgServerWelcome msg;
         msg.assignedClientID = id;
-        std::vector<uint8_t> buf(sizeof(msg));
-        std::memcpy(buf.data(), &msg, sizeof(msg));
-        return buf;
+        out.Write(msg);
     }
 
-    inline std::vector<uint8_t> WritePositionUpdate(ClientID cid, NetObjectID oid,
-                                                    const NetTransformState &ts)
+    inline void WritePositionUpdate(BufferWriter &out, ClientID cid, NetObjectID oid,
+                                    const NetTransformState &ts)
     {
         MsgPositionUpdate msg;
         msg.clientID = cid;
         msg.objectID = oid;
         msg.transform = ts;
-        std::vector<uint8_t> buf(sizeof(msg));
-        std::memcpy(buf.data(), &msg, sizeof(msg));
+        out.Write(msg);
+    }
+
+    inline void WritePositionBroadcast(BufferWriter &out,
+                                       const NetBroadcastEntry *entries, size_t count,
+                                       uint32_t serverTick)
+    {
+        MsgPositionBroadcast hdr;
+        hdr.serverTick = serverTick;
+        hdr.entryCount = static_cast<uint16_t>(std::min(count, static_cast<size_t>(UINT16_MAX)));
+        out.Write(hdr);
+        out.WriteBytes(entries, hdr.entryCount * sizeof(NetBroadcastEntry));
+    }
+
+    inline void WriteObjectDespawn(BufferWriter &out, ClientID ownerID, NetObjectID oid)
+    {
+        MsgObjectDespawn msg;
+        msg.ownerClientID = ownerID;
+        msg.objectID = oid;
+        out.Write(msg);
+    }
+
+    inline void WriteRelevanceExit(BufferWriter &out, const NetObjectRef *refs, size_t count,
+                                   uint32_t serverTick)
+    {
+        MsgRelevanceExit hdr;
+        hdr.serverTick = serverTick;
+        hdr.count = static_cast<uint16_t>(std::min(count, static_cast<size_t>(UINT16_MAX)));
+        out.Write(hdr);
+        out.WriteBytes(refs, hdr.count * sizeof(NetObjectRef));
+    }
+
+    inline void WriteClientDisconnect(BufferWriter &out, ClientID cid)
+    {
+        MsgClientDisconnect msg;
+        msg.clientID = cid;
+        out.Write(msg);
+    }
+
+    inline void WriteHeartbeat(BufferWriter &out, ClientID cid)
+    {
+        MsgHeartbeat msg;
+        msg.clientID = cid;
+        out.Write(msg);
+    }
+
+    inline void WriteObjectRelease(BufferWriter &out, ClientID cid, NetObjectID oid)
+    {
+        MsgObjectRelease msg;
+        msg.clientID = cid;
+        msg.objectID = oid;
+        out.Write(msg);
+    }
+
+    inline void WriteSnapshotAck(BufferWriter &out, ClientID cid, uint32_t ackTick)
+    {
+        MsgSnapshotAck msg;
+        msg.clientID = cid;
+        msg.ackTick = ackTick;
+        out.Write(msg);
+    }
+
+    inline std::vector<uint8_t> WriteClientHello(const NetUUID &uuid)
+    {
+        std::vector<uint8_t> buf;
+        BufferWriter out(buf);
+        WriteClientHello(out, uuid);
+        return buf;
+    }
+
+    inline std::vector<uint8_t> WriteServerWelcome(ClientID id)
+    {
+        std::vector<uint8_t> buf;
+        BufferWriter out(buf);
+        WriteServerWelcome(out, id);
+        return buf;
+    }
+
+    inline std::vector<uint8_t> WritePositionUpdate(ClientID cid, NetObjectID oid,
+                                                    const NetTransformState &ts)
+    {
+        std::vector<uint8_t> buf;
+        BufferWriter out(buf);
+        WritePositionUpdate(out, cid, oid, ts);
         return buf;
     }
 
@@ -49,49 +166,318 @@ namespace PacketSerializer
         const std::vector<NetBroadcastEntry> &entries,
         uint32_t serverTick)
     {
-        MsgPositionBroadcast hdr;
-        hdr.serverTick = serverTick;
-        hdr.entryCount = static_cast<uint16_t>(entries.size());
-        size_t totalSize = sizeof(hdr) + entries.size() * sizeof(NetBroadcastEntry);
-        std::vector<uint8_t> buf(totalSize);
-        std::memcpy(buf.data(), &hdr, sizeof(hdr));
-        if (!entries.empty())
-        {
-            std::memcpy(buf.data() + sizeof(hdr),
-                        entries.data(),
-                        entries.size() * sizeof(NetBroadcastEntry));
-        }
+        std::vector<uint8_t> buf;
+        BufferWriter out(buf);
+        WritePositionBroadcast(out, entries.data(), entries.size(), serverTick);
         return buf;
     }
 
     inline std::vector<uint8_t> WriteClientDisconnect(ClientID cid)
     {
-        MsgClientDisconnect msg;
-        msg.clientID = cid;
-        std::vector<uint8_t> buf(sizeof(msg));
-        std::memcpy(buf.data(), &msg, sizeof(msg));
+        std::vector<uint8_t> buf;
+        BufferWriter out(buf);
+        WriteClientDisconnect(out, cid);
         return buf;
     }
 
     inline std::vector<uint8_t> WriteHeartbeat(ClientID cid)
     {
-        MsgHeartbeat msg;
-        msg.clientID = cid;
-        std::vector<uint8_t> buf(sizeof(msg));
-        std::memcpy(buf.data(), &msg, sizeof(msg));
+        std::vector<uint8_t> buf;
+        BufferWriter out(buf);
+        WriteHeartbeat(out, cid);
         return buf;
     }
 
     inline std::vector<uint8_t> WriteObjectRelease(ClientID cid, NetObjectID oid)
     {
-        MsgObjectRelease msg;
-        msg.clientID = cid;
-        msg.objectID = oid;
-        std::vector<uint8_t> buf(sizeof(msg));
-        std::memcpy(buf.data(), &msg, sizeof(msg));
+        std::vector<uint8_t> buf;
+        BufferWriter out(buf);
+        WriteObjectRelease(out, cid, oid);
+        return buf;
+    }
+
+    inline std::vector<uint8_t> WriteSnapshotAck(ClientID cid, uint32_t ackTick)
+    {
+        std::vector<uint8_t> buf;
+        BufferWriter out(buf);
+        WriteSnapshotAck(out, cid, ackTick);
         return buf;
     }
 
+    // ────────────────────── Bit packing ──────────────────────
+
+    /// Appends bits LSB-first to a caller-owned buffer.
+    /// Reusing the same buffer across ticks avoids reallocation once it has grown.
+    class BitWriter
+    {
+    public:
+        explicit BitWriter(std::vector<uint8_t> &buf) : m_buf(buf) {}
+        ~BitWriter() { Flush(); }
+
+        BitWriter(const BitWriter &) = delete;
+        BitWriter &operator=(const BitWriter &) = delete;
+
+        /// Write the low `bits` bits of `value` (1..32).
+        void WriteBits(uint32_t value, int bits)
+        {
+            assert(bits > 0 && bits <= 32);
+            uint64_t mask = (uint64_t(1) << bits) - 1;
+            m_scratch |= (uint64_t(value) & mask) << m_scratchBits;
+            m_scratchBits += bits;
+            while (m_scratchBits >= 8)
+            {
+                m_buf.push_back(static_cast<uint8_t>(m_scratch));
+                m_scratch >>= 8;
+                m_scratchBits -= 8;
+            }
+        }
+
+        void WriteBool(bool value) { WriteBits(value ? 1u : 0u, 1); }
+
+        /// Prefix-coded unsigned: 0+4, 10+8, 110+16 or 111+32 bits.
+        void WriteVarBits(uint32_t value)
+        {
+            if (value < (1u << 4))
+            {
+                WriteBits(0b0, 1);
+                WriteBits(value, 4);
+            }
+            else if (value < (1u << 8))
+            {
+                WriteBits(0b01, 2);
+                WriteBits(value, 8);
+            }
+            else if (value < (1u << 16))
+            {
+                WriteBits(0b011, 3);
+                WriteBits(value, 16);
+            }
+            else
+            {
+                WriteBits(0b111, 3);
+                WriteBits(value, 32);
+            }
+        }
+
+        /// Zig-zag mapped so small negative deltas stay short.
+        void WriteSigned(int32_t value)
+        {
+            WriteVarBits((static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31));
+        }
+
+        /// Pad the pending bits to a whole byte.
+        void Flush()
+        {
+            if (m_scratchBits > 0)
+            {
+                m_buf.push_back(static_cast<uint8_t>(m_scratch));
+                m_scratch = 0;
+                m_scratchBits = 0;
+            }
+        }
+
+    private:
+        std::vector<uint8_t> &m_buf;
+        uint64_t m_scratch = 0;
+        int m_scratchBits = 0;
+    };
+
+    /// Reads what BitWriter wrote. Running past the end yields zeros and
+    /// marks the reader invalid instead of touching out-of-range memory.
+    class BitReader
+    {
+    public:
+        BitReader(const uint8_t *data, size_t len) : m_data(data), m_len(len) {}
+
+        uint32_t ReadBits(int bits)
+        {
+            assert(bits > 0 && bits <= 32);
+            while (m_scratchBits < bits)
+            {
+                uint64_t byte = 0;
+                if (m_pos < m_len)
+                    byte = m_data[m_pos++];
+                else
+                    m_overflow = true;
+                m_scratch |= byte << m_scratchBits;
+                m_scratchBits += 8;
+            }
+            uint64_t mask = (uint64_t(1) << bits) - 1;
+            uint32_t value = static_cast<uint32_t>(m_scratch & mask);
+            m_scratch >>= bits;
+            m_scratchBits -= bits;
+            return value;
+        }
+
+        bool ReadBool() { return ReadBits(1) != 0; }
+
+        uint32_t ReadVarBits()
+        {
+            if (!ReadBool())
+                return ReadBits(4);
+            if (!ReadBool())
+                return ReadBits(8);
+            if (!ReadBool())
+                return ReadBits(16);
+            return ReadBits(32);
+        }
+
+        int32_t ReadSigned()
+        {
+            uint32_t zz = ReadVarBits();
+            return static_cast<int32_t>((zz >> 1) ^ (0u - (zz & 1u)));
+        }
+
+        bool IsValid() const { return !m_overflow; }
+
+    private:
+        const uint8_t *m_data;
+        size_t m_len;
+        size_t m_pos = 0;
+        uint64_t m_scratch = 0;
+        int m_scratchBits = 0;
+        bool m_overflow = false;
+    };
+
+    // ────────────────────── Quantization ──────────────────────
+
+    /// Positions are split into an integer sector and a fixed-point offset
+    /// inside it, so precision does not degrade far from the world origin.
+    constexpr float SNAPSHOT_SECTOR_SIZE = 1024.0f;
+    constexpr int SNAPSHOT_OFFSET_BITS = 19; // ≈ 2 mm steps inside a 1024 m sector
+    constexpr float SNAPSHOT_OFFSET_SCALE = float(1u << SNAPSHOT_OFFSET_BITS) / SNAPSHOT_SECTOR_SIZE;
+    constexpr int SNAPSHOT_ROTATION_BITS = 10; // per smallest-three component
+    constexpr float SNAPSHOT_LINEAR_VELOCITY_SCALE = 64.0f; // 1/64 m/s
+    constexpr float SNAPSHOT_LINEAR_VELOCITY_LIMIT = 8192.0f;
+    constexpr float SNAPSHOT_ANGULAR_VELOCITY_SCALE = 1024.0f; // 1/1024 rad/s
+    constexpr float SNAPSHOT_ANGULAR_VELOCITY_LIMIT = 128.0f;
+
+    /// Integer form of NetTransformState; equal values mean "unchanged" on the wire.
+    struct QuantizedTransform
+    {
+        int32_t sector[3] = {};
+        uint32_t offset[3] = {};
+        uint32_t rotation = 0; // 2-bit largest index + 3 × 10-bit components
+        int32_t linVel[3] = {};
+        int32_t angVel[3] = {};
+    };
+
+    /// Smallest-three: drop the largest component (recoverable from unit length)
+    /// and store the other three in [-1/√2, 1/√2].
+    inline uint32_t PackQuaternion(float w, float x, float y, float z)
+    {
+        float q[4] = {w, x, y, z};
+        float lenSq = w * w + x * x + y * y + z * z;
+        if (lenSq < 1e-12f)
+        {
+            q[0] = 1.0f;
+            q[1] = q[2] = q[3] = 0.0f;
+            lenSq = 1.0f;
+        }
+        int largest = 0;
+        for (int i = 1; i < 4; ++i)
+            if (std::fabs(q[i]) > std::fabs(q[largest]))
+                largest = i;
+        // q and -q are the same rotation; flip so the dropped component is positive.
+        float scale = (q[largest] < 0.0f ? -1.0f : 1.0f) / std::sqrt(lenSq);
+
+        constexpr float RANGE = 0.70710678f;
+        constexpr uint32_t MAX_VALUE = (1u << SNAPSHOT_ROTATION_BITS) - 1;
+        uint32_t packed = static_cast<uint32_t>(largest) << (3 * SNAPSHOT_ROTATION_BITS);
+        int shift = 2 * SNAPSHOT_ROTATION_BITS;
+        for (int i = 0; i < 4; ++i)
+        {
+            if (i == largest)
+                continue;
+            float t = (q[i] * scale + RANGE) / (2.0f * RANGE);
+            t = std::min(std::max(t, 0.0f), 1.0f);
+            packed |= static_cast<uint32_t>(std::lround(t * MAX_VALUE)) << shift;
+            shift -= SNAPSHOT_ROTATION_BITS;
+        }
+        return packed;
+    }
+
+    inline void UnpackQuaternion(uint32_t packed, float &w, float &x, float &y, float &z)
+    {
+        constexpr float RANGE = 0.70710678f;
+        constexpr uint32_t MAX_VALUE = (1u << SNAPSHOT_ROTATION_BITS) - 1;
+        int largest = static_cast<int>(packed >> (3 * SNAPSHOT_ROTATION_BITS)) & 3;
+        float q[4];
+        float sumSq = 0.0f;
+        int shift = 2 * SNAPSHOT_ROTATION_BITS;
+        for (int i = 0; i < 4; ++i)
+        {
+            if (i == largest)
+                continue;
+            float t = static_cast<float>((packed >> shift) & MAX_VALUE) / MAX_VALUE;
+            q[i] = t * 2.0f * RANGE - RANGE;
+            sumSq += q[i] * q[i];
+            shift -= SNAPSHOT_ROTATION_BITS;
+        }
+        q[largest] = std::sqrt(std::max(0.0f, 1.0f - sumSq));
+        w = q[0];
+        x = q[1];
+        y = q[2];
+        z = q[3];
+    }
+
+    inline int32_t QuantizeScalar(float value, float scale, float limit)
+    {
+        value = std::min(std::max(value, -limit), limit);
+        return static_cast<int32_t>(std::lround(value * scale));
+    }
+
+    inline QuantizedTransform QuantizeTransform(const NetTransformState &ts)
+    {
+        QuantizedTransform q;
+        const float pos[3] = {ts.posX, ts.posY, ts.posZ};
+        for (int i = 0; i < 3; ++i)
+        {
+            float sector = std::floor(pos[i] / SNAPSHOT_SECTOR_SIZE);
+            float local = pos[i] - sector * SNAPSHOT_SECTOR_SIZE;
+            int64_t offset = std::llround(local * SNAPSHOT_OFFSET_SCALE);
+            int32_t sectorIndex = static_cast<int32_t>(sector);
+            // Rounding up at the far edge rolls over into the next sector.
+            if (offset >= (int64_t(1) << SNAPSHOT_OFFSET_BITS))
+            {
+                offset -= int64_t(1) << SNAPSHOT_OFFSET_BITS;
+                sectorIndex++;
+            }
+            q.sector[i] = sectorIndex;
+            q.offset[i] = static_cast<uint32_t>(std::max<int64_t>(offset, 0));
+        }
+        q.rotation = PackQuaternion(ts.rotW, ts.rotX, ts.rotY, ts.rotZ);
+
+        const float lin[3] = {ts.linVelX, ts.linVelY, ts.linVelZ};
+        const float ang[3] = {ts.angVelX, ts.angVelY, ts.angVelZ};
+        for (int i = 0; i < 3; ++i)
+        {
+            q.linVel[i] = QuantizeScalar(lin[i], SNAPSHOT_LINEAR_VELOCITY_SCALE, SNAPSHOT_LINEAR_VELOCITY_LIMIT);
+            q.angVel[i] = QuantizeScalar(ang[i], SNAPSHOT_ANGULAR_VELOCITY_SCALE, SNAPSHOT_ANGULAR_VELOCITY_LIMIT);
+        }
+        return q;
+    }
+
+    inline NetTransformState DequantizeTransform(const QuantizedTransform &q)
+    {
+        NetTransformState ts{};
+        float pos[3];
+        for (int i = 0; i < 3; ++i)
+            pos[i] = static_cast<float>(q.sector[i]) * SNAPSHOT_SECTOR_SIZE +
+                     static_cast<float>(q.offset[i]) / SNAPSHOT_OFFSET_SCALE;
+        ts.posX = pos[0];
+        ts.posY = pos[1];
+        ts.posZ = pos[2];
+        UnpackQuaternion(q.rotation, ts.rotW, ts.rotX, ts.rotY, ts.rotZ);
+        ts.linVelX = q.linVel[0] / SNAPSHOT_LINEAR_VELOCITY_SCALE;
+        ts.linVelY = q.linVel[1] / SNAPSHOT_LINEAR_VELOCITY_SCALE;
+        ts.linVelZ = q.linVel[2] / SNAPSHOT_LINEAR_VELOCITY_SCALE;
+        ts.angVelX = q.angVel[0] / SNAPSHOT_ANGULAR_VELOCITY_SCALE;
+        ts.angVelY = q.angVel[1] / SNAPSHOT_ANGULAR_VELOCITY_SCALE;
+        ts.angVelZ = q.angVel[2] / SNAPSHOT_ANGULAR_VELOCITY_SCALE;
+        return ts;
+    }
+
     // ────────────────────── Readers ──────────────────────
 
     /// Peek at the message type (first byte).
@@ -112,6 +498,85 @@ namespace PacketSerializer
         return msg;
     }
 
+    /// Read-only view over a contiguous NetBroadcastEntry array — either the
+    /// payload of a received PositionBroadcast or a decoded entry vector.
+    /// Entries are copied out on access, so the bytes need no alignment.
+    class BroadcastEntryView
+    {
+    public:
+        class Iterator
+        {
+        public:
+            explicit Iterator(const uint8_t *p) : m_p(p) {}
+            NetBroadcastEntry operator*() const
+            {
+                NetBroadcastEntry e;
+                std::memcpy(&e, m_p, sizeof(e));
+                return e;
+            }
+            Iterator &operator++()
+            {
+                m_p += sizeof(NetBroadcastEntry);
+                return *this;
+            }
+            bool operator!=(const Iterator &o) const { return m_p != o.m_p; }
+
+        private:
+            const uint8_t *m_p;
+        };
+
+        BroadcastEntryView() = default;
+        BroadcastEntryView(const uint8_t *bytes, size_t count) : m_bytes(bytes), m_count(count) {}
+        explicit BroadcastEntryView(const std::vector<NetBroadcastEntry> &entries)
+            : m_bytes(reinterpret_cast<const uint8_t *>(entries.data())), m_count(entries.size()) {}
+
+        size_t size() const { return m_count; }
+        bool empty() const { return m_count == 0; }
+        NetBroadcastEntry operator[](size_t i) const { return *Iterator(m_bytes + i * sizeof(NetBroadcastEntry)); }
+        Iterator begin() const { return Iterator(m_bytes); }
+        Iterator end() const { return Iterator(m_bytes + m_count * sizeof(NetBroadcastEntry)); }
+
+    private:
+        const uint8_t *m_bytes = nullptr;
+        size_t m_count = 0;
+    };
+
+    struct PositionBroadcastView
+    {
+        uint32_t serverTick = 0;
+        BroadcastEntryView entries;
+    };
+
+    /// Zero-copy read: the view points into `data` and is valid only as long as it.
+    /// A truncated packet yields only the entries that are fully present.
+    inline PositionBroadcastView ReadPositionBroadcastView(const uint8_t *data, size_t len)
+    {
+        PositionBroadcastView out;
+        if (len < sizeof(MsgPositionBroadcast))
+            return out;
+        auto hdr = Read<MsgPositionBroadcast>(data, len);
+        size_t available = (len - sizeof(MsgPositionBroadcast)) / sizeof(NetBroadcastEntry);
+        out.serverTick = hdr.serverTick;
+        out.entries = BroadcastEntryView(data + sizeof(MsgPositionBroadcast),
+                                         std::min(static_cast<size_t>(hdr.entryCount), available));
+        return out;
+    }
+
+    /// Fills `out` (cleared first) with the refs that follow MsgRelevanceExit.
+    inline uint32_t ReadRelevanceExit(const uint8_t *data, size_t len, std::vector<NetObjectRef> &out)
+    {
+        out.clear();
+        if (len < sizeof(MsgRelevanceExit))
+            return 0;
+        auto hdr = Read<MsgRelevanceExit>(data, len);
+        size_t available = (len - sizeof(MsgRelevanceExit)) / sizeof(NetObjectRef);
+        size_t count = std::min(static_cast<size_t>(hdr.count), available);
+        out.resize(count);
+        if (count > 0)
+            std::memcpy(out.data(), data + sizeof(MsgRelevanceExit), count * sizeof(NetObjectRef));
+        return hdr.serverTick;
+    }
+
     struct PositionBroadcastData
     {
         uint32_t serverTick = 0;
@@ -121,16 +586,12 @@ namespace PacketSerializer
     inline PositionBroadcastData ReadPositionBroadcast(
         const uint8_t *data, size_t len)
     {
-        auto hdr = Read<MsgPositionBroadcast>(data, len);
+        auto view = ReadPositionBroadcastView(data, len);
         PositionBroadcastData out{};
-        out.serverTick = hdr.serverTick;
-        out.entries.resize(hdr.entryCount);
-        if (hdr.entryCount > 0)
-        {
-            size_t offset = sizeof(MsgPositionBroadcast);
-            std::memcpy(out.entries.data(), data + offset,
-                        hdr.entryCount * sizeof(NetBroadcastEntry));
-        }
+        out.serverTick = view.serverTick;
+        out.entries.reserve(view.entries.size());
+        for (const auto &e : view.entries)
+            out.entries.push_back(e);
         return out;
     }
 
@@ -0,0 +1,432 @@
+#pragma once
+#include "Engine/Network/Protocol/PacketSerializer.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+/// Quantized, delta-compressed replacement for PositionBroadcast.
+///
+/// The server keeps one SnapshotEncoder per client and encodes every tick
+/// against the newest tick that client has acknowledged (MsgSnapshotAck).
+/// Both sides keep the same ring of quantized snapshots, so an entity whose
+/// quantized state did not change costs only its key plus one bit.
+
+/// One quantized entity inside a snapshot. Snapshots are sorted by Key()
+/// so baseline lookup is a linear merge on both sides.
+struct SnapshotEntity
+{
+    ClientID clientID = INVALID_CLIENT_ID;
+    NetObjectID objectID = INVALID_NET_OBJECT_ID;
+    PacketSerializer::QuantizedTransform state;
+
+    uint64_t Key() const { return (uint64_t(clientID) << 32) | objectID; }
+};
+
+/// Timing / size counters shared by encoder and decoder.
+struct SnapshotCodecStats
+{
+    uint64_t packets = 0;
+    uint64_t fullPackets = 0; // packets sent/received without a baseline
+    uint64_t entities = 0;
+    uint64_t bytes = 0;
+    uint64_t nanoseconds = 0;
+
+    double BytesPerEntity() const { return entities ? double(bytes) / entities : 0.0; }
+    double NsPerEntity() const { return entities ? double(nanoseconds) / entities : 0.0; }
+};
+
+/// Fixed ring of recent snapshots indexed by tick. Storage is reused.
+class SnapshotHistory
+{
+public:
+    static constexpr uint32_t CAPACITY = 32;
+
+    const std::vector<SnapshotEntity> *Find(uint32_t tick) const
+    {
+        const Slot &slot = m_slots[tick % CAPACITY];
+        return (slot.valid && slot.tick == tick) ? &slot.entities : nullptr;
+    }
+
+    std::vector<SnapshotEntity> &Store(uint32_t tick)
+    {
+        Slot &slot = m_slots[tick % CAPACITY];
+        slot.tick = tick;
+        slot.valid = true;
+        slot.entities.clear();
+        return slot.entities;
+    }
+
+    void Invalidate(uint32_t tick)
+    {
+        Slot &slot = m_slots[tick % CAPACITY];
+        if (slot.tick == tick)
+            slot.valid = false;
+    }
+
+    void Clear()
+    {
+        for (auto &slot : m_slots)
+            slot.valid = false;
+    }
+
+private:
+    struct Slot
+    {
+        uint32_t tick = 0;
+        bool valid = false;
+        std::vector<SnapshotEntity> entities;
+    };
+    std::array<Slot, CAPACITY> m_slots;
+};
+
+namespace SnapshotCodec
+{
+    using PacketSerializer::BitReader;
+    using PacketSerializer::BitWriter;
+    using PacketSerializer::QuantizedTransform;
+
+    inline int32_t Delta(int32_t value, int32_t base)
+    {
+        return static_cast<int32_t>(static_cast<uint32_t>(value) - static_cast<uint32_t>(base));
+    }
+    inline int32_t Apply(int32_t base, int32_t delta)
+    {
+        return static_cast<int32_t>(static_cast<uint32_t>(base) + static_cast<uint32_t>(delta));
+    }
+
+    inline bool SameVec(const int32_t *a, const int32_t *b)
+    {
+        return a[0] == b[0] && a[1] == b[1] && a[2] == b[2];
+    }
+    inline bool SameVec(const uint32_t *a, const uint32_t *b)
+    {
+        return a[0] == b[0] && a[1] == b[1] && a[2] == b[2];
+    }
+
+    /// Keys are written relative to the previous entity: consecutive objects of
+    /// one client cost a single bit plus a small ID gap.
+    inline void WriteKey(BitWriter &w, const SnapshotEntity &e, const SnapshotEntity *prev)
+    {
+        bool sameClient = prev && prev->clientID == e.clientID;
+        w.WriteBool(sameClient);
+        if (sameClient)
+        {
+            w.WriteVarBits(e.objectID - prev->objectID);
+            return;
+        }
+        w.WriteVarBits(e.clientID);
+        w.WriteVarBits(e.objectID);
+    }
+
+    inline void ReadKey(BitReader &r, SnapshotEntity &e, const SnapshotEntity *prev)
+    {
+        if (r.ReadBool() && prev)
+        {
+            e.clientID = prev->clientID;
+            e.objectID = prev->objectID + r.ReadVarBits();
+            return;
+        }
+        e.clientID = r.ReadVarBits();
+        e.objectID = r.ReadVarBits();
+    }
+
+    inline void WriteFull(BitWriter &w, const QuantizedTransform &q)
+    {
+        for (int i = 0; i < 3; ++i)
+            w.WriteSigned(q.sector[i]);
+        for (int i = 0; i < 3; ++i)
+            w.WriteBits(q.offset[i], PacketSerializer::SNAPSHOT_OFFSET_BITS);
+        w.WriteBits(q.rotation, 32);
+        for (int i = 0; i < 3; ++i)
+            w.WriteSigned(q.linVel[i]);
+        for (int i = 0; i < 3; ++i)
+            w.WriteSigned(q.angVel[i]);
+    }
+
+    inline void ReadFull(BitReader &r, QuantizedTransform &q)
+    {
+        for (int i = 0; i < 3; ++i)
+            q.sector[i] = r.ReadSigned();
+        for (int i = 0; i < 3; ++i)
+            q.offset[i] = r.ReadBits(PacketSerializer::SNAPSHOT_OFFSET_BITS);
+        q.rotation = r.ReadBits(32);
+        for (int i = 0; i < 3; ++i)
+            q.linVel[i] = r.ReadSigned();
+        for (int i = 0; i < 3; ++i)
+            q.angVel[i] = r.ReadSigned();
+    }
+
+    /// Layout: changed? then per group (position / rotation / linVel / angVel)
+    /// a changed bit followed by zig-zag deltas. A sector change resends offsets raw.
+    inline void WriteDelta(BitWriter &w, const QuantizedTransform &q, const QuantizedTransform &base)
+    {
+        bool sectorChanged = !SameVec(q.sector, base.sector);
+        bool posChanged = sectorChanged || !SameVec(q.offset, base.offset);
+        bool rotChanged = q.rotation != base.rotation;
+        bool linChanged = !SameVec(q.linVel, base.linVel);
+        bool angChanged = !SameVec(q.angVel, base.angVel);
+
+        bool changed = posChanged || rotChanged || linChanged || angChanged;
+        w.WriteBool(changed);
+        if (!changed)
+            return;
+
+        w.WriteBool(posChanged);
+        if (posChanged)
+        {
+            w.WriteBool(sectorChanged);
+            if (sectorChanged)
+            {
+                for (int i = 0; i < 3; ++i)
+                    w.WriteSigned(Delta(q.sector[i], base.sector[i]));
+                for (int i = 0; i < 3; ++i)
+                    w.WriteBits(q.offset[i], PacketSerializer::SNAPSHOT_OFFSET_BITS);
+            }
+            else
+            {
+                for (int i = 0; i < 3; ++i)
+                    w.WriteSigned(Delta(static_cast<int32_t>(q.offset[i]), static_cast<int32_t>(base.offset[i])));
+            }
+        }
+        w.WriteBool(rotChanged);
+        if (rotChanged)
+            w.WriteBits(q.rotation, 32);
+        w.WriteBool(linChanged);
+        if (linChanged)
+            for (int i = 0; i < 3; ++i)
+                w.WriteSigned(Delta(q.linVel[i], base.linVel[i]));
+        w.WriteBool(angChanged);
+        if (angChanged)
+            for (int i = 0; i < 3; ++i)
+                w.WriteSigned(Delta(q.angVel[i], base.angVel[i]));
+    }
+
+    inline void ReadDelta(BitReader &r, QuantizedTransform &q, const QuantizedTransform &base)
+    {
+        q = base;
+        if (!r.ReadBool())
+            return;
+
+        if (r.ReadBool())
+        {
+            if (r.ReadBool())
+            {
+                for (int i = 0; i < 3; ++i)
+                    q.sector[i] = Apply(base.sector[i], r.ReadSigned());
+                for (int i = 0; i < 3; ++i)
+                    q.offset[i] = r.ReadBits(PacketSerializer::SNAPSHOT_OFFSET_BITS);
+            }
+            else
+            {
+                for (int i = 0; i < 3; ++i)
+                    q.offset[i] = static_cast<uint32_t>(Apply(static_cast<int32_t>(base.offset[i]), r.ReadSigned()));
+            }
+        }
+        if (r.ReadBool())
+            q.rotation = r.ReadBits(32);
+        if (r.ReadBool())
+            for (int i = 0; i < 3; ++i)
+                q.linVel[i] = Apply(base.linVel[i], r.ReadSigned());
+        if (r.ReadBool())
+            for (int i = 0; i < 3; ++i)
+                q.angVel[i] = Apply(base.angVel[i], r.ReadSigned());
+    }
+
+    /// Advance `cursor` through a sorted baseline; returns the matching entity or nullptr.
+    inline const SnapshotEntity *FindBase(const std::vector<SnapshotEntity> *baseline,
+                                          size_t &cursor, uint64_t key)
+    {
+        if (!baseline)
+            return nullptr;
+        while (cursor < baseline->size() && (*baseline)[cursor].Key() < key)
+            cursor++;
+        if (cursor < baseline->size() && (*baseline)[cursor].Key() == key)
+            return &(*baseline)[cursor];
+        return nullptr;
+    }
+
+    inline uint64_t ElapsedNs(std::chrono::steady_clock::time_point since)
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         std::chrono::steady_clock::now() - since)
+                                         .count());
+    }
+
+    /// Quantize and sort one server tick. Done once per tick; the result is
+    /// shared by every client's encoder.
+    inline void BuildSnapshot(const std::vector<NetBroadcastEntry> &entries,
+                              std::vector<SnapshotEntity> &out)
+    {
+        out.resize(entries.size());
+        for (size_t i = 0; i < entries.size(); ++i)
+        {
+            out[i].clientID = entries[i].clientID;
+            out[i].objectID = entries[i].objectID;
+            out[i].state = PacketSerializer::QuantizeTransform(entries[i].transform);
+        }
+        std::sort(out.begin(), out.end(), [](const SnapshotEntity &a, const SnapshotEntity &b)
+                  { return a.Key() < b.Key(); });
+    }
+
+} // namespace SnapshotCodec
+
+/// Server side, one per connected client.
+class SnapshotEncoder
+{
+public:
+    /// Encode a sorted snapshot (SnapshotCodec::BuildSnapshot) into `out`.
+    /// `out` is overwritten; keep it alive across ticks to avoid reallocation.
+    void Encode(const std::vector<SnapshotEntity> &snapshot, uint32_t serverTick,
+                std::vector<uint8_t> &out)
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        // Only delta against a tick still in both rings (the client keeps the same window).
+        const std::vector<SnapshotEntity> *baseline = nullptr;
+        if (m_hasAck && serverTick != m_ackTick && serverTick - m_ackTick < SnapshotHistory::CAPACITY)
+            baseline = m_history.Find(m_ackTick);
+
+        MsgPositionSnapshot hdr;
+        hdr.serverTick = serverTick;
+        hdr.baseTick = baseline ? m_ackTick : 0;
+        hdr.hasBaseline = baseline ? 1 : 0;
+        hdr.entryCount = static_cast<uint16_t>(std::min(snapshot.size(), static_cast<size_t>(UINT16_MAX)));
+
+        out.resize(sizeof(hdr));
+        std::memcpy(out.data(), &hdr, sizeof(hdr));
+        {
+            PacketSerializer::BitWriter writer(out);
+            size_t cursor = 0;
+            for (size_t i = 0; i < hdr.entryCount; ++i)
+            {
+                const SnapshotEntity &e = snapshot[i];
+                SnapshotCodec::WriteKey(writer, e, i > 0 ? &snapshot[i - 1] : nullptr);
+                const SnapshotEntity *base = SnapshotCodec::FindBase(baseline, cursor, e.Key());
+                if (base)
+                    SnapshotCodec::WriteDelta(writer, e.state, base->state);
+                else
+                    SnapshotCodec::WriteFull(writer, e.state);
+            }
+        }
+
+        std::vector<SnapshotEntity> &stored = m_history.Store(serverTick);
+        stored.assign(snapshot.begin(), snapshot.begin() + hdr.entryCount);
+
+        m_stats.packets++;
+        m_stats.fullPackets += baseline ? 0 : 1;
+        m_stats.entities += hdr.entryCount;
+        m_stats.bytes += out.size();
+        m_stats.nanoseconds += SnapshotCodec::ElapsedNs(start);
+    }
+
+    /// Called when MsgSnapshotAck arrives; stale or reordered acks are ignored.
+    void OnAck(uint32_t ackTick)
+    {
+        if (!m_hasAck || ackTick > m_ackTick)
+        {
+            m_ackTick = ackTick;
+            m_hasAck = true;
+        }
+    }
+
+    void Reset()
+    {
+        m_history.Clear();
+        m_hasAck = false;
+        m_ackTick = 0;
+    }
+
+    const SnapshotCodecStats &GetStats() const { return m_stats; }
+
+private:
+    SnapshotHistory m_history;
+    uint32_t m_ackTick = 0;
+    bool m_hasAck = false;
+    SnapshotCodecStats m_stats;
+};
+
+/// Client side: rebuilds full NetBroadcastEntry lists from PositionSnapshot packets.
+class SnapshotDecoder
+{
+public:
+    /// Returns false for malformed packets, packets older than the newest decoded
+    /// tick, or deltas whose baseline has already left the ring. Only successfully
+    /// decoded ticks should be acknowledged.
+    bool Decode(const uint8_t *data, size_t len, uint32_t &outServerTick,
+                std::vector<NetBroadcastEntry> &outEntries)
+    {
+        if (len < sizeof(MsgPositionSnapshot))
+            return false;
+        auto start = std::chrono::steady_clock::now();
+        auto hdr = PacketSerializer::Read<MsgPositionSnapshot>(data, len);
+        if (m_hasLatest && hdr.serverTick <= m_latestTick)
+            return false;
+
+        const std::vector<SnapshotEntity> *baseline = nullptr;
+        if (hdr.hasBaseline)
+        {
+            if (hdr.serverTick - hdr.baseTick >= SnapshotHistory::CAPACITY)
+                return false;
+            baseline = m_history.Find(hdr.baseTick);
+            if (!baseline)
+                return false;
+        }
+
+        // Baseline and current tick map to different slots (checked above).
+        std::vector<SnapshotEntity> &current = m_history.Store(hdr.serverTick);
+        current.resize(hdr.entryCount);
+        PacketSerializer::BitReader reader(data + sizeof(hdr), len - sizeof(hdr));
+        size_t cursor = 0;
+        for (size_t i = 0; i < hdr.entryCount; ++i)
+        {
+            SnapshotEntity &e = current[i];
+            SnapshotCodec::ReadKey(reader, e, i > 0 ? &current[i - 1] : nullptr);
+            const SnapshotEntity *base = SnapshotCodec::FindBase(baseline, cursor, e.Key());
+            if (base)
+                SnapshotCodec::ReadDelta(reader, e.state, base->state);
+            else
+                SnapshotCodec::ReadFull(reader, e.state);
+        }
+        if (!reader.IsValid())
+        {
+            m_history.Invalidate(hdr.serverTick);
+            return false;
+        }
+
+        outEntries.resize(current.size());
+        for (size_t i = 0; i < current.size(); ++i)
+        {
+            outEntries[i].clientID = current[i].clientID;
+            outEntries[i].objectID = current[i].objectID;
+            outEntries[i].transform = PacketSerializer::DequantizeTransform(current[i].state);
+        }
+        outServerTick = hdr.serverTick;
+        m_latestTick = hdr.serverTick;
+        m_hasLatest = true;
+
+        m_stats.packets++;
+        m_stats.fullPackets += baseline ? 0 : 1;
+        m_stats.entities += hdr.entryCount;
+        m_stats.bytes += len;
+        m_stats.nanoseconds += SnapshotCodec::ElapsedNs(start);
+        return true;
+    }
+
+    void Reset()
+    {
+        m_history.Clear();
+        m_hasLatest = false;
+        m_latestTick = 0;
+    }
+
+    const SnapshotCodecStats &GetStats() const { return m_stats; }
+
+private:
+    SnapshotHistory m_history;
+    uint32_t m_latestTick = 0;
+    bool m_hasLatest = false;
+    SnapshotCodecStats m_stats;
+};
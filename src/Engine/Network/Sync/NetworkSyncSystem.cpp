@@ -4,7 +4,7 @@
 #include "Engine/Core/GameWorld.h"
 #include "Engine/Core/Components/TransformComponent.h"
 #include "Engine/Core/Components/RigidBodyComponent.h"
-#include "Engine/Core/GameObject/GameObjectFactory.h"
+#include "Engine/Core/GameObject/GameObjectPool.h"
 #include <iostream>
 #include <string>
 #include <algorithm>
@@ -15,8 +15,7 @@ namespace
 {
     double NowSeconds()
     {
-        using clock = std::chrono::steady_clock;
-        return std::chrono::duration<double>(clock::now().time_since_epoch()).count();
+        return NetClockSeconds();
     }
 
     /// Hermite interpolation between two positions using velocities.
@@ -33,29 +32,6 @@ namespace
         float h11 = t3 - t2;
         return p0 * h00 + v0 * (h10 * dt) + p1 * h01 + v1 * (h11 * dt);
     }
-
-    GameObject *FindLiveRemoteObject(GameWorld &world,
-                                     ClientID ownerClientID,
-                                     NetObjectID objectID)
-    {
-        for (const auto &objPtr : world.GetGameObjects())
-        {
-            GameObject *obj = objPtr.get();
-            if (obj == nullptr || obj->IsWaitingDestroy())
-                continue;
-            if (!obj->HasComponent<NetworkSyncComponent>() ||
-                !obj->HasComponent<TransformComponent>())
-                continue;
-
-            auto &sync = obj->GetComponent<NetworkSyncComponent>();
-            if (sync.ownerClientID == ownerClientID &&
-                sync.netObjectID == objectID)
-            {
-                return obj;
-            }
-        }
-        return nullptr;
-    }
 } // namespace
 
 // ── Cleanup ────────────────────────────────────────────────────────
@@ -63,6 +39,7 @@ void NetworkSyncSystem::Cleanup()
 {
     m_pendingRemote.clear();
     m_pendingDespawn.clear();
+    m_pendingExit.clear();
     m_remoteTracks.clear();
     m_remoteRespawnSuppressions.clear();
     m_callbackBound = false;
@@ -109,9 +86,10 @@ void NetworkSyncSystem::Init(NetworkClient &client)
         return;
 
     client.SetOnPositionBroadcast(
-        [this](uint32_t serverTick, const std::vector<NetBroadcastEntry> &entries)
+        [this, &client](uint32_t serverTick, PacketSerializer::BroadcastEntryView entries)
         {
-            const double receiveTimeSec = NowSeconds();
+            // Stamped at socket read, not at dispatch, so a long frame does not skew it.
+            const double receiveTimeSec = client.GetReceiveTimeSec();
             for (const auto &e : entries)
             {
                 m_pendingRemote.push_back({serverTick, e.clientID, e.objectID, e.transform, receiveTimeSec});
@@ -125,6 +103,11 @@ void NetworkSyncSystem::Init(NetworkClient &client)
         {
             m_pendingDespawn.push_back({ownerClientID, objectID});
         });
+    client.SetOnRelevanceExit(
+        [this](uint32_t serverTick, ClientID ownerClientID, NetObjectID objectID)
+        {
+            m_pendingExit.push_back({serverTick, ownerClientID, objectID});
+        });
 
     m_callbackBound = true;
 }
@@ -141,6 +124,7 @@ void NetworkSyncSystem::Update(GameWorld &world, NetworkClient &client, float de
         RemoveRemoteObjects(world, INVALID_CLIENT_ID, true);
         m_pendingRemote.clear();
         m_pendingDespawn.clear();
+        m_pendingExit.clear();
         m_remoteTracks.clear();
         m_sendAccumulator = 0.0f;
         return;
@@ -154,7 +138,7 @@ void NetworkSyncSystem::Update(GameWorld &world, NetworkClient &client, float de
     if (shouldSend)
         m_sendAccumulator -= sendInterval;
 
-    auto syncedEntities = world.GetEntitiesWith<NetworkSyncComponent, TransformComponent>();
+    const auto &syncedEntities = world.GetEntitiesWith<NetworkSyncComponent, TransformComponent>();
     static bool s_loggedNoLocalSync = false;
     static bool s_loggedLocalSync = false;
     bool hasLocalSync = false;
@@ -218,8 +202,9 @@ void NetworkSyncSystem::Update(GameWorld &world, NetworkClient &client, float de
 
     // 2. Apply remote flight states ──────────────────────────────────
     ApplyRemoteBroadcast(world, client);
+    ApplyRemoteRelevanceExit(client);
     ApplyRemoteDespawn(world, client);
-    ApplyRemoteInterpolation(world, client, deltaTime);
+    ApplyRemoteInterpolation(deltaTime);
 }
 
 // ── Apply remote ───────────────────────────────────────────────────
@@ -245,13 +230,23 @@ void NetworkSyncSystem::ApplyRemoteBroadcast(GameWorld &world,
         if (IsRemoteRespawnSuppressed(key, nowSec))
             continue;
 
+        auto &track = m_remoteTracks[key];
+        // A broadcast sent before the relevance exit may arrive after it (unreliable channel).
+        if (track.outOfInterest && remote.serverTick <= track.exitTick)
+            continue;
+
         // Ensure the corresponding remote object exists in world.
-        GameObject *target = FindOrSpawnRemoteObject(world, remote.clientID, remote.objectID);
+        GameObject *target = AcquireRemoteObject(world, track, remote.clientID, remote.objectID);
 
         if (target == nullptr)
             continue;
 
-        auto &track = m_remoteTracks[key];
+        if (track.outOfInterest)
+        {
+            // Back in interest: reuse the hidden object, snap to the new state.
+            track.outOfInterest = false;
+            target->SetActive(true);
+        }
 
         RemoteSnapshot snap{};
         snap.serverTick = remote.serverTick;
@@ -294,35 +289,18 @@ void NetworkSyncSystem::ApplyRemoteBroadcast(GameWorld &world,
     m_pendingRemote.clear();
 }
 
-void NetworkSyncSystem::ApplyRemoteInterpolation(GameWorld &world, NetworkClient &client, float deltaTime)
+void NetworkSyncSystem::ApplyRemoteInterpolation(float deltaTime)
 {
     if (m_remoteTracks.empty())
         return;
 
     const double nowSec = NowSeconds();
     const double renderTimeSec = nowSec - interpolationBackTimeSec;
-    ClientID localID = client.GetLocalClientID();
-
-    auto syncedEntities = world.GetEntitiesWith<NetworkSyncComponent, TransformComponent>();
-    std::unordered_map<uint64_t, GameObject *> remoteObjects;
-    remoteObjects.reserve(syncedEntities.size());
-
-    for (auto *obj : syncedEntities)
-    {
-        if (obj == nullptr || !obj->HasComponent<NetworkSyncComponent>() || !obj->HasComponent<TransformComponent>())
-            continue;
-        auto &sync = obj->GetComponent<NetworkSyncComponent>();
-        if (sync.isLocalPlayer || sync.ownerClientID == localID)
-            continue;
-        remoteObjects[MakeRemoteKey(sync.ownerClientID, sync.netObjectID)] = obj;
-    }
 
     for (auto &[key, track] : m_remoteTracks)
     {
-        auto itObj = remoteObjects.find(key);
-        if (itObj == remoteObjects.end())
-            continue;
-        if (track.snapshots.empty())
+        // Hidden (out of interest) tracks have no snapshots.
+        if (track.object == nullptr || track.snapshots.empty())
             continue;
 
         Vector3f targetPos = track.snapshots.back().position;
@@ -381,7 +359,7 @@ void NetworkSyncSystem::ApplyRemoteInterpolation(GameWorld &world, NetworkClient
         }
 
         // ── Error convergence ───────────────────────────────────────
-        auto &tf = itObj->second->GetComponent<TransformComponent>();
+        auto &tf = track.object->GetComponent<TransformComponent>();
 
         if (!track.hasDisplayState)
         {
@@ -412,9 +390,7 @@ void NetworkSyncSystem::ApplyRemoteInterpolation(GameWorld &world, NetworkClient
             }
         }
 
-        tf.SetWorldMatrix(Matrix4f::CreateTransform(track.displayPosition,
-                                                    track.displayRotation,
-                                                    Vector3f::ONE));
+        tf.SetWorldTRS(track.displayPosition, track.displayRotation, Vector3f::ONE);
 
         // Prune old snapshots
         while (track.snapshots.size() > 2 &&
@@ -425,30 +401,42 @@ void NetworkSyncSystem::ApplyRemoteInterpolation(GameWorld &world, NetworkClient
     }
 }
 
-GameObject *NetworkSyncSystem::FindOrSpawnRemoteObject(GameWorld &world, ClientID ownerClientID, NetObjectID objectID)
+GameObject *NetworkSyncSystem::AcquireRemoteObject(GameWorld &world, RemoteTrack &track,
+                                                ClientID ownerClientID, NetObjectID objectID)
 {
-    if (GameObject *existing = FindLiveRemoteObject(world, ownerClientID, objectID))
-        return existing;
+    if (track.object != nullptr)
+        return track.object;
 
     const std::string remoteName = "remote_plane_" + std::to_string(ownerClientID) + "_" + std::to_string(objectID);
-    GameObject &newObj = GameObjectFactory::CreateFromPrefab(remoteName, "RemotePlayer", m_remotePlayerPrefabPath, world);
-    newObj.SetOwnerWorld(&world);
-
-    if (!newObj.HasComponent<TransformComponent>())
-        newObj.AddComponent<TransformComponent>();
-    auto &tf = newObj.GetComponent<TransformComponent>();
-    tf.SetOwner(&newObj);
+    GameObjectPool &pool = world.GetOrCreatePool(m_remotePlayerPoolName, "RemotePlayer", m_remotePlayerPrefabPath);
+    GameObject *obj = pool.Spawn(remoteName, "RemotePlayer", Vector3f::ZERO, Quat4f::IDENTITY);
+    if (obj == nullptr)
+        return nullptr;
 
-    auto &sync = newObj.AddComponent<NetworkSyncComponent>(objectID, false);
+    obj->GetComponent<TransformComponent>().SetOwner(obj);
+    // Pooled objects keep the component from their previous life.
+    auto &sync = obj->HasComponent<NetworkSyncComponent>()
+                     ? obj->GetComponent<NetworkSyncComponent>()
+                     : obj->AddComponent<NetworkSyncComponent>(objectID, false);
     sync.ownerClientID = ownerClientID;
     sync.netObjectID = objectID;
     sync.isLocalPlayer = false;
 
-    newObj.SetActive(true);
-
+    track.object = obj;
     std::cout << "[NetworkSyncSystem] Spawned remote plane client="
               << ownerClientID << " obj=" << objectID << "\n";
-    return &newObj;
+    return obj;
+}
+
+void NetworkSyncSystem::ReleaseRemoteObject(GameWorld &world, RemoteTrack &track)
+{
+    if (track.object == nullptr)
+        return;
+    auto &sync = track.object->GetComponent<NetworkSyncComponent>();
+    sync.ownerClientID = INVALID_CLIENT_ID;
+    sync.netObjectID = INVALID_NET_OBJECT_ID;
+    world.GetOrCreatePool(m_remotePlayerPoolName, "RemotePlayer", m_remotePlayerPrefabPath).Recycle(track.object);
+    track.object = nullptr;
 }
 
 void NetworkSyncSystem::ApplyRemoteDespawn(GameWorld &world, NetworkClient &client)
@@ -457,8 +445,6 @@ void NetworkSyncSystem::ApplyRemoteDespawn(GameWorld &world, NetworkClient &clie
         return;
 
     ClientID localID = client.GetLocalClientID();
-    auto syncedEntities = world.GetEntitiesWith<NetworkSyncComponent, TransformComponent>();
-
     for (const auto &despawn : m_pendingDespawn)
     {
         if (despawn.ownerClientID == INVALID_CLIENT_ID || despawn.objectID == INVALID_NET_OBJECT_ID)
@@ -468,51 +454,70 @@ void NetworkSyncSystem::ApplyRemoteDespawn(GameWorld &world, NetworkClient &clie
             continue;
         const uint64_t key = MakeRemoteKey(despawn.ownerClientID, despawn.objectID);
         MarkRemoteDespawned(despawn.ownerClientID, despawn.objectID, NowSeconds());
-        m_remoteTracks.erase(key);
 
-        for (auto *obj : syncedEntities)
+        auto it = m_remoteTracks.find(key);
+        if (it == m_remoteTracks.end())
+            continue;
+        // Also covers hidden (out of interest) objects.
+        if (it->second.object != nullptr)
         {
-            if (obj == nullptr || !obj->HasComponent<NetworkSyncComponent>() || !obj->HasComponent<TransformComponent>())
-                continue;
-            auto &sync = obj->GetComponent<NetworkSyncComponent>();
-            if (sync.isLocalPlayer)
-                continue;
-            if (sync.ownerClientID != despawn.ownerClientID || sync.netObjectID != despawn.objectID)
-                continue;
-
-            obj->SetActive(false);
-            obj->SetIsWaitingDestroy(true);
+            ReleaseRemoteObject(world, it->second);
             std::cout << "[NetworkSyncSystem] Despawn remote plane client="
                       << despawn.ownerClientID << " obj=" << despawn.objectID << "\n";
-            break;
         }
+        m_remoteTracks.erase(it);
     }
 
     m_pendingDespawn.clear();
 }
 
-void NetworkSyncSystem::RemoveRemoteObjects(GameWorld &world, ClientID localClientID, bool removeAllRemotes)
+void NetworkSyncSystem::ApplyRemoteRelevanceExit(NetworkClient &client)
 {
-    const double nowSec = NowSeconds();
-    auto syncedEntities = world.GetEntitiesWith<NetworkSyncComponent, TransformComponent>();
-    for (auto *obj : syncedEntities)
+    if (m_pendingExit.empty())
+        return;
+
+    ClientID localID = client.GetLocalClientID();
+    for (const auto &exit : m_pendingExit)
     {
-        if (obj == nullptr || !obj->HasComponent<NetworkSyncComponent>() || !obj->HasComponent<TransformComponent>())
+        if (exit.ownerClientID == INVALID_CLIENT_ID || exit.objectID == INVALID_NET_OBJECT_ID)
+            continue;
+        if (exit.ownerClientID == localID)
             continue;
 
-        auto &sync = obj->GetComponent<NetworkSyncComponent>();
-        if (sync.isLocalPlayer)
+        const uint64_t key = MakeRemoteKey(exit.ownerClientID, exit.objectID);
+        auto &track = m_remoteTracks[key];
+        // Already re-entered with a newer state (exit delivered late).
+        if (!track.snapshots.empty() && track.snapshots.back().serverTick > exit.serverTick)
             continue;
 
+        track.snapshots.clear();
+        track.hasDisplayState = false;
+        track.outOfInterest = true;
+        track.exitTick = std::max(track.exitTick, exit.serverTick);
+        if (track.object != nullptr)
+            track.object->SetActive(false);
+    }
+
+    m_pendingExit.clear();
+}
+
+void NetworkSyncSystem::RemoveRemoteObjects(GameWorld &world, ClientID localClientID, bool removeAllRemotes)
+{
+    const double nowSec = NowSeconds();
+    for (auto it = m_remoteTracks.begin(); it != m_remoteTracks.end();)
+    {
+        const ClientID ownerClientID = static_cast<ClientID>(it->first >> 32);
         const bool shouldRemove = removeAllRemotes ||
-                                  (localClientID != INVALID_CLIENT_ID && sync.ownerClientID == localClientID);
+                                  (localClientID != INVALID_CLIENT_ID && ownerClientID == localClientID);
         if (!shouldRemove)
+        {
+            ++it;
             continue;
+        }
 
-        MarkRemoteDespawned(sync.ownerClientID, sync.netObjectID, nowSec);
-        m_remoteTracks.erase(MakeRemoteKey(sync.ownerClientID, sync.netObjectID));
-        obj->SetActive(false);
-        obj->SetIsWaitingDestroy(true);
+        MarkRemoteDespawned(ownerClientID, static_cast<NetObjectID>(it->first & 0xFFFFFFFFu), nowSec);
+        ReleaseRemoteObject(world, it->second);
+        it = m_remoteTracks.erase(it);
     }
 }
 
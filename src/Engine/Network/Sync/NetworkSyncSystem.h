@@ -47,8 +47,10 @@ private:
     // ── Receive / apply pipeline ───────────────────────────────────
     /// Internal: apply a remote broadcast to the world.
     void ApplyRemoteBroadcast(GameWorld &world, NetworkClient &client);
-    void ApplyRemoteInterpolation(GameWorld &world, NetworkClient &client, float deltaTime);
+    void ApplyRemoteInterpolation(float deltaTime);
     void ApplyRemoteDespawn(GameWorld &world, NetworkClient &client);
+    /// Hide (not destroy) objects that left our area of interest.
+    void ApplyRemoteRelevanceExit(NetworkClient &client);
 
     // ── Remote entity lifecycle guards ─────────────────────────────
     void RemoveRemoteObjects(GameWorld &world, ClientID localClientID, bool removeAllRemotes);
@@ -56,7 +58,6 @@ private:
     void MarkRemoteDespawned(ClientID ownerClientID, NetObjectID objectID, double nowSec);
     void PruneRemoteRespawnSuppressions(double nowSec);
 
-    GameObject *FindOrSpawnRemoteObject(GameWorld &world, ClientID ownerClientID, NetObjectID objectID);
     static uint64_t MakeRemoteKey(ClientID ownerClientID, NetObjectID objectID);
 
     // Buffer filled by the broadcast callback, consumed in Update().
@@ -73,6 +74,12 @@ private:
         ClientID ownerClientID;
         NetObjectID objectID;
     };
+    struct RelevanceExitEntry
+    {
+        uint32_t serverTick = 0;
+        ClientID ownerClientID;
+        NetObjectID objectID;
+    };
     struct RemoteSnapshot
     {
         uint32_t serverTick = 0;
@@ -89,18 +96,31 @@ private:
         Vector3f displayPosition = Vector3f::ZERO;
         Quat4f displayRotation = Quat4f::IDENTITY;
         bool hasDisplayState = false;
+        // Out of interest: object kept inactive until a broadcast newer than exitTick.
+        bool outOfInterest = false;
+        uint32_t exitTick = 0;
+        // Registry entry: the pooled GameObject for this (owner, object), or null.
+        GameObject *object = nullptr;
     };
     struct RemoteRespawnSuppression
     {
         double expireTimeSec = 0.0;
     };
 
+    /// Registry lookup; spawns from the remote-player pool on first use.
+    GameObject *AcquireRemoteObject(GameWorld &world, RemoteTrack &track, ClientID ownerClientID, NetObjectID objectID);
+    /// Back to the pool (the track keeps no object afterwards).
+    void ReleaseRemoteObject(GameWorld &world, RemoteTrack &track);
+
     std::vector<RemoteEntry> m_pendingRemote;
     std::vector<DespawnEntry> m_pendingDespawn;
+    std::vector<RelevanceExitEntry> m_pendingExit;
+    /// Keyed by MakeRemoteKey; also the (ClientID, NetObjectID) → GameObject registry.
     std::unordered_map<uint64_t, RemoteTrack> m_remoteTracks;
     std::unordered_map<uint64_t, RemoteRespawnSuppression> m_remoteRespawnSuppressions;
     bool m_callbackBound = false;
     std::string m_remotePlayerPrefabPath = "assets/prefabs/remote_player.json";
+    std::string m_remotePlayerPoolName = "remote_player";
 
     size_t m_maxSnapshotsPerTrack = 32;
 
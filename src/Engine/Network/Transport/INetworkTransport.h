@@ -14,7 +14,9 @@ public:
     // ── Callback signatures (no platform types leak out) ───────────
     using OnConnectFn = std::function<void()>;
     using OnDisconnectFn = std::function<void()>;
-    using OnReceiveFn = std::function<void(const uint8_t *data, size_t len, uint8_t channelID)>;
+    /// `receiveTimeSec` (NetClockSeconds) is taken when the message is read off the socket.
+    using OnReceiveFn = std::function<void(const uint8_t *data, size_t len, uint8_t channelID,
+                                           double receiveTimeSec)>;
 
     virtual ~INetworkTransport() = default;
 
@@ -177,7 +177,7 @@ void NBNetTransport::Poll(uint32_t /*timeoutMs*/)
                     // Translate nbnet channel back to our convention
                     uint8_t ourChannel =
                         (info.channel_id == NBN_CHANNEL_RESERVED_RELIABLE) ? 0 : 1;
-                    m_onReceive(msg->bytes, msg->length, ourChannel);
+                    m_onReceive(msg->bytes, msg->length, ourChannel, NetClockSeconds());
                 }
             }
             break;
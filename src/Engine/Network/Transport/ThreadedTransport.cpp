@@ -0,0 +1,200 @@
+#include "ThreadedTransport.h"
+#include <chrono>
+
+namespace
+{
+    /// Upper bound between two I/O cycles; FlushSend() wakes the thread earlier.
+    constexpr std::chrono::milliseconds IO_POLL_INTERVAL{1};
+}
+
+// ────────────────────────────────────────────────────────────────────
+ThreadedTransport::ThreadedTransport(std::unique_ptr<INetworkTransport> inner, size_t queueCapacity)
+    : m_inner(std::move(inner)), m_inbound(queueCapacity), m_outbound(queueCapacity)
+{
+    // Inner callbacks fire on the I/O thread (inside m_inner->Poll) — only queue them.
+    m_inner->SetOnConnect([this]()
+                          { PushInbound(EventType::Connected, nullptr, 0, 0, NetClockSeconds()); });
+    m_inner->SetOnDisconnect([this]()
+                             { PushInbound(EventType::Disconnected, nullptr, 0, 0, NetClockSeconds()); });
+    m_inner->SetOnReceive([this](const uint8_t *data, size_t len, uint8_t ch, double receiveTimeSec)
+                          { PushInbound(EventType::Receive, data, len, ch, receiveTimeSec); });
+}
+
+ThreadedTransport::~ThreadedTransport()
+{
+    Disconnect();
+}
+
+// ── Lifecycle ──────────────────────────────────────────────────────
+bool ThreadedTransport::Connect(const std::string &host, uint16_t port)
+{
+    Disconnect();
+
+    // No I/O thread yet: safe to drive the inner transport from here.
+    if (!m_inner->Connect(host, port))
+        return false;
+    m_state = m_inner->GetState();
+    StartThread();
+    return true;
+}
+
+void ThreadedTransport::Disconnect()
+{
+    // Joins after the last queued sends (e.g. ClientDisconnect) are flushed.
+    StopThread();
+    m_inner->Disconnect();
+    m_state = ConnectionState::Disconnected;
+
+    // Events of the old connection must not leak into the next one.
+    while (m_inbound.Front() != nullptr)
+        m_inbound.Pop();
+    while (m_outbound.Front() != nullptr)
+        m_outbound.Pop();
+    m_overflow.clear();
+    m_generation++;
+}
+
+void ThreadedTransport::StartThread()
+{
+    m_stopThread = false;
+    m_thread = std::thread(&ThreadedTransport::IOLoop, this);
+}
+
+void ThreadedTransport::StopThread()
+{
+    if (!m_thread.joinable())
+        return;
+    m_stopThread = true;
+    m_wakeCondition.notify_one();
+    m_thread.join();
+    m_stopThread = false;
+}
+
+// ── Game thread ────────────────────────────────────────────────────
+void ThreadedTransport::Poll(uint32_t /*timeoutMs*/)
+{
+    const uint64_t generation = m_generation;
+    while (InboundEvent *ev = m_inbound.Front())
+    {
+        switch (ev->type)
+        {
+        case EventType::Connected:
+            m_state = ConnectionState::Connected;
+            if (m_onConnect)
+                m_onConnect();
+            break;
+        case EventType::Disconnected:
+            m_state = ConnectionState::Disconnected;
+            if (m_onDisconnect)
+                m_onDisconnect();
+            break;
+        case EventType::Receive:
+            if (m_onReceive)
+                m_onReceive(ev->bytes.data(), ev->bytes.size(), ev->channel, ev->receiveTimeSec);
+            break;
+        }
+        // A callback reconnected / disconnected: the ring was already cleared.
+        if (generation != m_generation)
+            return;
+        m_inbound.Pop();
+    }
+}
+
+bool ThreadedTransport::Send(const uint8_t *data, size_t len, uint8_t channel)
+{
+    if (m_state != ConnectionState::Connected || !data || len == 0)
+        return false;
+
+    OutboundMessage *msg = m_outbound.BeginPush();
+    if (msg == nullptr)
+    {
+        m_stats.sendDrops++;
+        return false;
+    }
+    msg->channel = channel;
+    msg->bytes.assign(data, data + len);
+    m_outbound.CommitPush();
+    return true;
+}
+
+void ThreadedTransport::FlushSend()
+{
+    m_wakeRequested = true;
+    m_wakeCondition.notify_one();
+}
+
+// ── I/O thread ─────────────────────────────────────────────────────
+void ThreadedTransport::IOLoop()
+{
+    while (!m_stopThread)
+    {
+        DrainOutbound();
+        // While the game thread is behind, leave new packets in the socket / nbnet
+        // queues instead of growing the overflow list; still flush our sends.
+        if (FlushOverflow())
+            m_inner->Poll(0); // receives, then sends everything queued
+        else
+            m_inner->FlushSend();
+
+        std::unique_lock<std::mutex> lock(m_wakeMutex);
+        m_wakeCondition.wait_for(lock, IO_POLL_INTERVAL, [this]()
+                                 { return m_stopThread || m_wakeRequested; });
+        m_wakeRequested = false;
+    }
+
+    DrainOutbound();
+    m_inner->FlushSend();
+}
+
+void ThreadedTransport::DrainOutbound()
+{
+    while (OutboundMessage *msg = m_outbound.Front())
+    {
+        if (m_inner->Send(msg->bytes.data(), msg->bytes.size(), msg->channel))
+            m_stats.sent++;
+        m_outbound.Pop();
+    }
+}
+
+void ThreadedTransport::PushInbound(EventType type, const uint8_t *data, size_t len,
+                                    uint8_t channel, double receiveTimeSec)
+{
+    if (type == EventType::Receive)
+        m_stats.received++;
+
+    InboundEvent *ev = m_overflow.empty() ? m_inbound.BeginPush() : nullptr;
+    const bool toRing = ev != nullptr;
+    if (!toRing)
+    {
+        m_stats.inboundStalls++;
+        ev = &m_overflow.emplace_back();
+    }
+    ev->type = type;
+    ev->channel = channel;
+    ev->receiveTimeSec = receiveTimeSec;
+    if (data != nullptr)
+        ev->bytes.assign(data, data + len);
+    else
+        ev->bytes.clear();
+    if (toRing)
+        m_inbound.CommitPush();
+}
+
+bool ThreadedTransport::FlushOverflow()
+{
+    size_t moved = 0;
+    while (moved < m_overflow.size())
+    {
+        InboundEvent *slot = m_inbound.BeginPush();
+        if (slot == nullptr)
+            break;
+        InboundEvent &ev = m_overflow[moved++];
+        slot->type = ev.type;
+        slot->channel = ev.channel;
+        slot->receiveTimeSec = ev.receiveTimeSec;
+        slot->bytes.swap(ev.bytes);
+        m_inbound.CommitPush();
+    }
+    m_overflow.erase(m_overflow.begin(), m_overflow.begin() + moved);
+    return m_overflow.empty();
+}
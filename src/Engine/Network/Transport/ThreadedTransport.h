@@ -0,0 +1,110 @@
+#pragma once
+#include "Engine/Network/Transport/INetworkTransport.h"
+#include "Engine/Core/Jobs/SpscRing.h"
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// Runs another transport on a dedicated I/O thread.
+///
+/// The inner transport (nbnet is not thread-safe) is only touched by the I/O
+/// thread while it runs: it polls, reassembles packets and flushes sends on
+/// its own clock. Received messages (with their socket-read timestamp) and
+/// connection events reach the game thread through one SPSC ring, outgoing
+/// messages go the other way through another. Poll() on the game thread just
+/// drains the inbound ring and fires the callbacks, so they still run on the
+/// game thread as with the plain transport.
+///
+/// Not used on the web build (no threads) — NBNetTransport is used directly.
+class ThreadedTransport : public INetworkTransport
+{
+public:
+    struct Stats
+    {
+        std::atomic<uint64_t> received{0};
+        std::atomic<uint64_t> sent{0};
+        std::atomic<uint64_t> inboundStalls{0}; // inbound ring full: I/O thread held events back
+        std::atomic<uint64_t> sendDrops{0};     // outbound ring full: Send() failed
+    };
+
+    explicit ThreadedTransport(std::unique_ptr<INetworkTransport> inner, size_t queueCapacity = 1024);
+    ~ThreadedTransport() override;
+
+    ThreadedTransport(const ThreadedTransport &) = delete;
+    ThreadedTransport &operator=(const ThreadedTransport &) = delete;
+
+    // ── INetworkTransport ──────────────────────────────────────────
+    bool Connect(const std::string &host, uint16_t port) override;
+    void Disconnect() override;
+    /// Game thread: dispatch everything the I/O thread has queued.
+    void Poll(uint32_t timeoutMs = 0) override;
+    /// Game thread: queue for the I/O thread (copied, caller keeps its buffer).
+    bool Send(const uint8_t *data, size_t len, uint8_t channel = 0) override;
+    /// Wake the I/O thread so queued sends go out now instead of next cycle.
+    void FlushSend() override;
+
+    bool IsConnected() const override { return m_state == ConnectionState::Connected; }
+    ConnectionState GetState() const override { return m_state; }
+
+    void SetOnConnect(OnConnectFn fn) override { m_onConnect = std::move(fn); }
+    void SetOnDisconnect(OnDisconnectFn fn) override { m_onDisconnect = std::move(fn); }
+    void SetOnReceive(OnReceiveFn fn) override { m_onReceive = std::move(fn); }
+
+    const Stats &GetStats() const { return m_stats; }
+
+private:
+    enum class EventType : uint8_t
+    {
+        Connected,
+        Disconnected,
+        Receive,
+    };
+
+    struct InboundEvent
+    {
+        EventType type = EventType::Receive;
+        uint8_t channel = 0;
+        double receiveTimeSec = 0.0;
+        std::vector<uint8_t> bytes;
+    };
+
+    struct OutboundMessage
+    {
+        uint8_t channel = 0;
+        std::vector<uint8_t> bytes;
+    };
+
+    void StartThread();
+    void StopThread();
+    void IOLoop();
+    void DrainOutbound();
+    /// I/O thread: push to the inbound ring, or to the overflow list while it is full.
+    void PushInbound(EventType type, const uint8_t *data, size_t len, uint8_t channel, double receiveTimeSec);
+    bool FlushOverflow();
+
+    std::unique_ptr<INetworkTransport> m_inner;
+
+    // Game-thread view of the connection, updated as events are dispatched.
+    ConnectionState m_state = ConnectionState::Disconnected;
+    OnConnectFn m_onConnect;
+    OnDisconnectFn m_onDisconnect;
+    OnReceiveFn m_onReceive;
+
+    SpscRing<InboundEvent> m_inbound;    // I/O thread → game thread
+    SpscRing<OutboundMessage> m_outbound; // game thread → I/O thread
+    // Owned by the I/O thread: keeps order when the game thread falls behind.
+    std::vector<InboundEvent> m_overflow;
+    /// Bumped by Disconnect(), so Poll() notices a callback tore the connection down.
+    uint64_t m_generation = 0;
+
+    std::thread m_thread;
+    std::atomic<bool> m_stopThread{false};
+    std::atomic<bool> m_wakeRequested{false};
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wakeCondition;
+
+    Stats m_stats;
+};
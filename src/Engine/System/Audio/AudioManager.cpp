@@ -10,7 +10,7 @@ AudioManager::~AudioManager()
 }
 void AudioManager::Update(GameWorld &world, const mCamera &camera)
 {
-    auto entities = world.GetEntitiesWith<AudioComponent, TransformComponent>();
+    const auto &entities = world.GetEntitiesWith<AudioComponent, TransformComponent>();
     for (auto *entity : entities)
     {
         auto &audioComp = entity->GetComponent<AudioComponent>();
@@ -0,0 +1,160 @@
+#include "SweepAndPrune.h"
+#include "Engine/Core/GameObject/GameObject.h"
+#include "Engine/Core/Components/Components.h"
+#include <cmath>
+
+AABB SweepAndPrune::ComputeWorldAABB(const TransformComponent &tf, const RigidbodyComponent &rb)
+{
+    Vector3f worldPos = tf.GetWorldPosition();
+    if (rb.colliderType == ColliderType::SPHERE)
+    {
+        Vector3f r(rb.boudingRadius, rb.boudingRadius, rb.boudingRadius);
+        return AABB(worldPos - r, worldPos + r);
+    }
+    // 与 GameObject::GetWorldAABB 等价: 旋转后的局部包围盒取 |R| * halfExtents, 省去逐角点旋转
+    Matrix3f rot = tf.GetWorldRotation().toMatrix();
+    Vector3f localCenter = (rb.localAABB.min + rb.localAABB.max) * 0.5f;
+    Vector3f halfExtents = (rb.localAABB.max - rb.localAABB.min) * 0.5f;
+    Vector3f center = worldPos + rot * localCenter;
+    Vector3f extent;
+    for (int i = 0; i < 3; i++)
+    {
+        extent[i] = fabsf(rot(i, 0)) * halfExtents[0] +
+                    fabsf(rot(i, 1)) * halfExtents[1] +
+                    fabsf(rot(i, 2)) * halfExtents[2];
+    }
+    return AABB(center - extent, center + extent);
+}
+
+void SweepAndPrune::RefreshBounds(Proxy &proxy)
+{
+    proxy.bounds = ComputeWorldAABB(*proxy.transform, *proxy.rigidbody);
+}
+
+void SweepAndPrune::Update(const std::vector<GameObject *> &objects)
+{
+    m_stamp++;
+    for (auto *obj : objects)
+    {
+        auto it = m_slotOf.find(obj);
+        if (it != m_slotOf.end() && m_proxies[it->second].objectID == obj->GetID())
+        {
+            Proxy &proxy = m_proxies[it->second];
+            if (!proxy.rigidbody->Collidable || obj->IsWaitingDestroy())
+                continue;
+            proxy.stamp = m_stamp;
+            RefreshBounds(proxy);
+            continue;
+        }
+        if (obj->IsWaitingDestroy())
+            continue;
+        if (!obj->HasComponent<RigidbodyComponent>() || !obj->HasComponent<TransformComponent>())
+            continue;
+        auto &rb = obj->GetComponent<RigidbodyComponent>();
+        if (!rb.Collidable)
+            continue;
+
+        // 地址被新对象复用时, 旧代理直接覆盖
+        uint32_t slot;
+        if (it != m_slotOf.end())
+        {
+            slot = it->second;
+        }
+        else
+        {
+            if (!m_freeSlots.empty())
+            {
+                slot = m_freeSlots.back();
+                m_freeSlots.pop_back();
+            }
+            else
+            {
+                slot = static_cast<uint32_t>(m_proxies.size());
+                m_proxies.emplace_back();
+            }
+            m_slotOf[obj] = slot;
+            m_sorted.push_back(slot);
+        }
+        Proxy &proxy = m_proxies[slot];
+        proxy.object = obj;
+        proxy.objectID = obj->GetID();
+        proxy.transform = &obj->GetComponent<TransformComponent>();
+        proxy.rigidbody = &rb;
+        proxy.stamp = m_stamp;
+        RefreshBounds(proxy);
+    }
+
+    // 移除本帧未出现的代理(失活/销毁/不可碰撞), 保持剩余序列的相对顺序
+    size_t write = 0;
+    for (size_t read = 0; read < m_sorted.size(); read++)
+    {
+        uint32_t slot = m_sorted[read];
+        Proxy &proxy = m_proxies[slot];
+        if (proxy.stamp != m_stamp)
+        {
+            m_slotOf.erase(proxy.object);
+            proxy = Proxy();
+            m_freeSlots.push_back(slot);
+            continue;
+        }
+        m_sorted[write++] = slot;
+    }
+    m_sorted.resize(write);
+
+    InsertionSort();
+    m_stats.proxyCount = m_sorted.size();
+}
+
+void SweepAndPrune::InsertionSort()
+{
+    // 上一帧已有序, 物体位移较小时只需少量交换
+    m_stats.sortSwaps = 0;
+    for (size_t i = 1; i < m_sorted.size(); i++)
+    {
+        uint32_t slot = m_sorted[i];
+        float key = m_proxies[slot].bounds.min[m_axis];
+        size_t j = i;
+        while (j > 0 && m_proxies[m_sorted[j - 1]].bounds.min[m_axis] > key)
+        {
+            m_sorted[j] = m_sorted[j - 1];
+            j--;
+            m_stats.sortSwaps++;
+        }
+        m_sorted[j] = slot;
+    }
+}
+
+const std::vector<SweepAndPrune::Pair> &SweepAndPrune::ComputePairs()
+{
+    m_pairs.clear();
+    const int axis1 = (m_axis + 1) % 3;
+    const int axis2 = (m_axis + 2) % 3;
+    for (size_t i = 0; i < m_sorted.size(); i++)
+    {
+        Proxy &a = m_proxies[m_sorted[i]];
+        float maxOnAxis = a.bounds.max[m_axis];
+        for (size_t j = i + 1; j < m_sorted.size(); j++)
+        {
+            Proxy &b = m_proxies[m_sorted[j]];
+            if (b.bounds.min[m_axis] > maxOnAxis)
+                break;
+            if (a.bounds.max[axis1] < b.bounds.min[axis1] || a.bounds.min[axis1] > b.bounds.max[axis1])
+                continue;
+            if (a.bounds.max[axis2] < b.bounds.min[axis2] || a.bounds.min[axis2] > b.bounds.max[axis2])
+                continue;
+            m_pairs.push_back({&a, &b});
+        }
+    }
+    m_stats.candidatePairs = m_pairs.size();
+    return m_pairs;
+}
+
+void SweepAndPrune::Clear()
+{
+    m_proxies.clear();
+    m_freeSlots.clear();
+    m_sorted.clear();
+    m_slotOf.clear();
+    m_pairs.clear();
+    m_stats = Stats();
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include "Engine/Core/Components/Components.h"
+#include "Engine/Math/Math.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+class GameObject;
+
+// 单轴 Sort-and-Sweep 粗测
+// 代理在帧间保留, 排序序列利用时间相干性做插入排序, 近乎 O(n)
+class SweepAndPrune
+{
+public:
+    struct Proxy
+    {
+        GameObject *object = nullptr;
+        unsigned int objectID = 0;
+        TransformComponent *transform = nullptr;
+        RigidbodyComponent *rigidbody = nullptr;
+        AABB bounds;
+        uint32_t stamp = 0;
+    };
+
+    struct Pair
+    {
+        Proxy *a;
+        Proxy *b;
+    };
+
+    struct Stats
+    {
+        size_t proxyCount = 0;
+        size_t candidatePairs = 0;
+        size_t sortSwaps = 0;
+    };
+
+    // 同步代理: 新增/移除可碰撞对象, 刷新世界包围盒并重新排序
+    void Update(const std::vector<GameObject *> &objects);
+    // 扫描排序轴, 输出包围盒重叠的候选对
+    const std::vector<Pair> &ComputePairs();
+
+    void SetAxis(int axis) { m_axis = (axis >= 0 && axis < 3) ? axis : 0; }
+    void Clear();
+
+    const Stats &GetStats() const { return m_stats; }
+
+    static AABB ComputeWorldAABB(const TransformComponent &tf, const RigidbodyComponent &rb);
+
+private:
+    void RefreshBounds(Proxy &proxy);
+    void InsertionSort();
+
+    int m_axis = 0;
+    uint32_t m_stamp = 0;
+
+    std::vector<Proxy> m_proxies;
+    std::vector<uint32_t> m_freeSlots;
+    std::vector<uint32_t> m_sorted;
+    std::unordered_map<GameObject *, uint32_t> m_slotOf;
+
+    std::vector<Pair> m_pairs;
+    Stats m_stats;
+};
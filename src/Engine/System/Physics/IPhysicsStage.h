@@ -1,8 +1,36 @@
 #pragma once
+#include <cstdint>
 #include <nlohmann/json.hpp>
 using json = nlohmann::json;
 class GameWorld;
 
+// 阶段读写的数据类别, 供调度器判断两个阶段能否并发
+enum PhysicsData : uint32_t
+{
+    PHYSICS_DATA_NONE = 0,
+    PHYSICS_DATA_TRANSFORM = 1u << 0, // 位置/旋转(写入会推入脏变换队列并更新空间哈希)
+    PHYSICS_DATA_BODY = 1u << 1,      // 质量/碰撞体等刚体属性
+    PHYSICS_DATA_VELOCITY = 1u << 2,  // 速度/角速度/动量
+    PHYSICS_DATA_FORCE = 1u << 3,     // 力/力矩累加器(含休眠唤醒)
+    PHYSICS_DATA_WORLD = 1u << 4,     // 事件/回调/对象增删等全局副作用
+    PHYSICS_DATA_ALL = 0xFFFFFFFFu,
+};
+
+struct StageAccess
+{
+    uint32_t reads = PHYSICS_DATA_ALL;
+    uint32_t writes = PHYSICS_DATA_ALL;
+    // 只在 Commit 中写入的数据: 批内其他阶段执行时看不到这些写
+    uint32_t deferred = PHYSICS_DATA_NONE;
+
+    // this 在前, other 在后: other 能否与 this 同批而不改变串行执行的结果
+    bool ConflictsWith(const StageAccess &other) const
+    {
+        return (writes & (other.reads | other.writes)) != 0 || (other.writes & reads) != 0 ||
+               (deferred & (other.reads | other.writes)) != 0;
+    }
+};
+
 class IPhysicsStage
 {
 public:
@@ -10,4 +38,11 @@ public:
 
     virtual void Execute(GameWorld &world, float fixedDeltaTime) = 0;
     virtual void Initialize(const json &data) {};
-};
\ No newline at end of file
+    // 默认读写一切, 与任何阶段都串行
+    virtual StageAccess GetAccess() const { return StageAccess(); }
+
+    // 每步在所有批之前按阶段顺序串行调用, 可在此快照步初的状态; 快照的读不必再声明
+    virtual void BeginStep(GameWorld &) {}
+    // 所在批全部执行完后按阶段顺序串行调用, 应用 Execute 记录下的延迟写 (StageAccess::deferred)
+    virtual void Commit(GameWorld &) {}
+};
@@ -0,0 +1,157 @@
+#include "BatchIntegrator.h"
+#include "Engine/Core/GameWorld.h"
+#include "Engine/Core/Jobs/JobSystem.h"
+#include "Engine/Core/Components/Components.h"
+#include <cmath>
+#include <limits>
+
+namespace
+{
+    bool IsAtRest(const RigidbodyComponent &rb)
+    {
+        return rb.velocity.LengthSquared() == 0.0f &&
+               rb.angularMomentum.LengthSquared() == 0.0f &&
+               rb.angularVelocity.LengthSquared() == 0.0f &&
+               rb.accumulatedForces.LengthSquared() == 0.0f &&
+               rb.accumulatedTorques.LengthSquared() == 0.0f;
+    }
+}
+
+void BatchIntegrator::Integrate(GameWorld &world, JobSystem *jobs, float fixedDeltaTime)
+{
+    m_stats = Stats();
+    Gather(world);
+
+    size_t count = m_bodies.size();
+    m_stats.integrated = count;
+    if (count == 0)
+        return;
+    m_stats.chunks = (count + m_grain - 1) / m_grain;
+
+    if (m_parallel && jobs)
+    {
+        jobs->ParallelFor(count, m_grain, [this, fixedDeltaTime](size_t begin, size_t end)
+                          { IntegrateRange(begin, end, fixedDeltaTime); });
+    }
+    else
+    {
+        IntegrateRange(0, count, fixedDeltaTime);
+    }
+
+    Scatter();
+}
+
+void BatchIntegrator::Gather(GameWorld &world)
+{
+    m_bodies.clear();
+    m_transforms.clear();
+    m_position.clear();
+    m_rotation.clear();
+    m_scale.clear();
+    m_velocity.clear();
+    m_force.clear();
+    m_angularMomentum.clear();
+    m_angularVelocity.clear();
+    m_torque.clear();
+    m_inverseInertia.clear();
+    m_mass.clear();
+    m_drag.clear();
+    m_angularDrag.clear();
+
+    world.View<RigidbodyComponent, TransformComponent>().Each(
+        [this](GameObject &, RigidbodyComponent &rb, TransformComponent &tf)
+        {
+            // 质量为 0 的刚体不移动
+            if (std::abs(rb.mass) <= std::numeric_limits<float>::min())
+                return;
+            if (rb.isSleeping)
+            {
+                m_stats.sleeping++;
+                return;
+            }
+            // 无速度、无动量、无外力: 积分结果不变, 不必写回
+            if (IsAtRest(rb))
+            {
+                m_stats.atRest++;
+                return;
+            }
+            m_bodies.push_back(&rb);
+            m_transforms.push_back(&tf);
+            m_position.push_back(tf.GetWorldPosition());
+            m_rotation.push_back(tf.GetWorldRotation());
+            m_scale.push_back(tf.GetWorldScale());
+            m_velocity.push_back(rb.velocity);
+            m_force.push_back(rb.accumulatedForces);
+            m_angularMomentum.push_back(rb.angularMomentum);
+            m_angularVelocity.push_back(rb.angularVelocity);
+            m_torque.push_back(rb.accumulatedTorques);
+            m_inverseInertia.push_back(rb.inverseInertiaTensor);
+            m_mass.push_back(rb.mass);
+            m_drag.push_back(rb.drag);
+            m_angularDrag.push_back(rb.angularDrag);
+        });
+}
+
+void BatchIntegrator::IntegrateRange(size_t begin, size_t end, float dt)
+{
+    for (size_t i = begin; i < end; i++)
+    {
+        // 1. F = ma  =>  a = F / m
+        Vector3f acceleration = m_force[i] / m_mass[i];
+
+        // 2. v = v + a * t
+        Vector3f &velocity = m_velocity[i];
+        velocity += acceleration * dt;
+
+        // v = v * (1 - drag * t)
+        float dragFactor = 1.0f - (m_drag[i] * dt);
+        if (dragFactor < 0)
+            dragFactor = 0;
+        velocity *= dragFactor;
+
+        // 3. p = p + v * t
+        m_position[i] += velocity * dt;
+
+        // 4. 角动量与角速度
+        Quat4f &rot = m_rotation[i];
+        Vector3f &angularMomentum = m_angularMomentum[i];
+        angularMomentum += m_torque[i] * dt;
+
+        float angularDragFactor = 1.0f - (m_angularDrag[i] * dt);
+        if (angularDragFactor < 0)
+            angularDragFactor = 0;
+        angularMomentum *= angularDragFactor;
+
+        // ω = R * I^-1 * R^T * L, 用三次矩阵乘向量代替构造世界惯性张量
+        Matrix3f rotationMatrix = rot.toMatrix();
+        Vector3f localMomentum = rotationMatrix.transposed() * angularMomentum;
+        Vector3f &angularVelocity = m_angularVelocity[i];
+        angularVelocity = rotationMatrix * (m_inverseInertia[i] * localMomentum);
+
+        if (angularVelocity.Length() > std::numeric_limits<float>::min())
+        {
+            // 角速度四元数 (0, ωx, ωy, ωz)
+            Quat4f omegaQuat(0, angularVelocity.x(), angularVelocity.y(), angularVelocity.z());
+
+            // dq/dt = 0.5 * w * q, 世界系w左乘
+            Quat4f dq = (omegaQuat * rot) * 0.5f;
+
+            // 欧拉方法积分 q(t+dt) = q(t) + dq*dt
+            rot = rot + dq * dt;
+            rot.normalize();
+        }
+    }
+}
+
+void BatchIntegrator::Scatter()
+{
+    for (size_t i = 0; i < m_bodies.size(); i++)
+    {
+        RigidbodyComponent &rb = *m_bodies[i];
+        rb.velocity = m_velocity[i];
+        rb.angularMomentum = m_angularMomentum[i];
+        rb.angularVelocity = m_angularVelocity[i];
+        rb.ClearForces();
+        m_transforms[i]->SetWorldTRS(m_position[i], m_rotation[i], m_scale[i]);
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include "Engine/Math/Math.h"
+#include <cstddef>
+#include <vector>
+
+class GameWorld;
+class JobSystem;
+class TransformComponent;
+struct RigidbodyComponent;
+
+// 半隐式欧拉积分, 数据导向版本
+// 1. 主线程收集需要积分的刚体到 SoA 数组 (世界 TRS 的惰性分解不是线程安全的)
+// 2. 按固定块长并行积分, 每个刚体只读写自己的槽位, 结果与单线程逐位一致
+// 3. 主线程一次性写回组件
+class BatchIntegrator
+{
+public:
+    struct Stats
+    {
+        size_t integrated = 0; // 本步积分的刚体数
+        size_t atRest = 0;     // 完全静止而跳过的刚体数
+        size_t sleeping = 0;   // 休眠而跳过的刚体数
+        size_t chunks = 0;     // 分发的块数
+    };
+
+    void SetParallel(bool parallel) { m_parallel = parallel; }
+    void SetGrain(size_t grain) { m_grain = grain > 0 ? grain : 1; }
+
+    void Integrate(GameWorld &world, JobSystem *jobs, float fixedDeltaTime);
+
+    const Stats &GetStats() const { return m_stats; }
+
+private:
+    void Gather(GameWorld &world);
+    void IntegrateRange(size_t begin, size_t end, float dt);
+    void Scatter();
+
+    bool m_parallel = true;
+    size_t m_grain = 128;
+
+    // SoA: 下标 i 对应同一个刚体
+    std::vector<RigidbodyComponent *> m_bodies;
+    std::vector<TransformComponent *> m_transforms;
+    std::vector<Vector3f> m_position;
+    std::vector<Quat4f> m_rotation;
+    std::vector<Vector3f> m_scale;
+    std::vector<Vector3f> m_velocity;
+    std::vector<Vector3f> m_force;
+    std::vector<Vector3f> m_angularMomentum;
+    std::vector<Vector3f> m_angularVelocity;
+    std::vector<Vector3f> m_torque;
+    std::vector<Matrix3f> m_inverseInertia;
+    std::vector<float> m_mass;
+    std::vector<float> m_drag;
+    std::vector<float> m_angularDrag;
+
+    Stats m_stats;
+};
@@ -0,0 +1,186 @@
+#include "IslandManager.h"
+#include "Engine/Core/GameWorld.h"
+#include "Engine/Core/Components/Components.h"
+#include <limits>
+
+void IslandManager::Initialize(const json &config)
+{
+    m_enabled = config.value("enable", true);
+    m_linearThreshold = config.value("linearThreshold", 0.05f);
+    m_angularThreshold = config.value("angularThreshold", 0.05f);
+    m_accelerationThreshold = config.value("accelerationThreshold", 0.0001f);
+    m_timeToSleep = config.value("timeToSleep", 0.5f);
+}
+
+void IslandManager::ReportContact(RigidbodyComponent *a, RigidbodyComponent *b)
+{
+    if (m_enabled)
+        m_contacts.push_back({a, b});
+}
+
+uint32_t IslandManager::Find(uint32_t node)
+{
+    while (m_parent[node] != node)
+    {
+        m_parent[node] = m_parent[m_parent[node]];
+        node = m_parent[node];
+    }
+    return node;
+}
+
+void IslandManager::Union(uint32_t a, uint32_t b)
+{
+    a = Find(a);
+    b = Find(b);
+    if (a != b)
+        m_parent[b] = a;
+}
+
+void IslandManager::Update(GameWorld &world, float fixedDeltaTime)
+{
+    m_stats = Stats();
+    m_bodies.clear();
+    m_nodeOf.clear();
+    m_parent.clear();
+    m_wokenSleepIslands.clear();
+    m_nodeOfSleepIsland.clear();
+    if (!m_enabled)
+    {
+        m_contacts.clear();
+        m_groundedSleepIslands.clear();
+        return;
+    }
+
+    const float linearSq = m_linearThreshold * m_linearThreshold;
+    const float angularSq = m_angularThreshold * m_angularThreshold;
+
+    // 1. 收集动态刚体, 更新低速计时; 被脚本直接赋予速度的休眠体在这里醒来
+    world.View<RigidbodyComponent, TransformComponent>().Each(
+        [&](GameObject &, RigidbodyComponent &rb, TransformComponent &)
+        {
+            if (rb.mass <= std::numeric_limits<float>::min())
+                return;
+            bool slow = rb.velocity.LengthSquared() < linearSq && rb.angularVelocity.LengthSquared() < angularSq;
+            if (rb.isSleeping && !slow)
+                rb.WakeUp();
+            if (!rb.isSleeping)
+                rb.sleepTimer = slow ? rb.sleepTimer + fixedDeltaTime : 0.0f;
+            if (!rb.isSleeping && rb.sleepIslandID != 0)
+                m_wokenSleepIslands.insert(rb.sleepIslandID);
+
+            m_nodeOf[&rb] = static_cast<uint32_t>(m_bodies.size());
+            m_parent.push_back(static_cast<uint32_t>(m_bodies.size()));
+            m_bodies.push_back(&rb);
+        });
+
+    // 2. 接触图求岛屿; 静态体不传播, 只记录受支撑的刚体
+    m_groundedNodes.clear();
+    for (auto &[a, b] : m_contacts)
+    {
+        auto itA = m_nodeOf.find(a);
+        auto itB = b ? m_nodeOf.find(b) : m_nodeOf.end();
+        if (itA != m_nodeOf.end() && itB != m_nodeOf.end())
+            Union(itA->second, itB->second);
+        else if (itA != m_nodeOf.end())
+            m_groundedNodes.push_back(itA->second);
+        else if (itB != m_nodeOf.end())
+            m_groundedNodes.push_back(itB->second);
+    }
+    m_contacts.clear();
+    // 一起入睡的刚体仍是一个岛: 双方都休眠的接触不会再被上报
+    for (uint32_t i = 0; i < m_bodies.size(); i++)
+    {
+        uint32_t id = m_bodies[i]->sleepIslandID;
+        if (id == 0)
+            continue;
+        auto [it, inserted] = m_nodeOfSleepIsland.try_emplace(id, i);
+        if (!inserted)
+            Union(it->second, i);
+        if (m_groundedSleepIslands.count(id))
+            m_groundedNodes.push_back(i);
+    }
+    m_groundedSleepIslands.clear();
+    m_islandGrounded.assign(m_bodies.size(), 0);
+    for (uint32_t node : m_groundedNodes)
+        m_islandGrounded[Find(node)] = 1;
+
+    // 3. 上一次一起入睡的岛有成员醒来(被接触或受力), 整岛唤醒
+    if (!m_wokenSleepIslands.empty())
+    {
+        for (auto *rb : m_bodies)
+        {
+            if (rb->isSleeping && m_wokenSleepIslands.count(rb->sleepIslandID))
+                rb->WakeUp();
+        }
+    }
+
+    // 4. 岛内任一成员未满足休眠条件则整岛保持清醒;
+    //    不受支撑且净外力产生的加速度不可忽略的岛重新计时, 休眠的也要唤醒
+    m_islandForce.assign(m_bodies.size(), Vector3f::ZERO);
+    m_islandMass.assign(m_bodies.size(), 0.0f);
+    for (uint32_t i = 0; i < m_bodies.size(); i++)
+    {
+        uint32_t root = Find(i);
+        m_islandForce[root] += m_bodies[i]->accumulatedForces;
+        m_islandMass[root] += m_bodies[i]->mass;
+    }
+    m_islandAwake.assign(m_bodies.size(), 0);
+    for (uint32_t i = 0; i < m_bodies.size(); i++)
+    {
+        RigidbodyComponent *rb = m_bodies[i];
+        uint32_t root = Find(i);
+        float limit = m_accelerationThreshold * m_islandMass[root];
+        if (!m_islandGrounded[root] && m_islandForce[root].LengthSquared() > limit * limit)
+        {
+            rb->sleepTimer = 0.0f;
+            m_islandAwake[root] = 1;
+        }
+        else if (!rb->canSleep || (!rb->isSleeping && rb->sleepTimer < m_timeToSleep))
+        {
+            m_islandAwake[root] = 1;
+        }
+    }
+
+    // 5. 唤醒或整体休眠; 并入已休眠岛的刚体沿用其编号
+    std::unordered_map<uint32_t, uint32_t> sleepIDOfRoot;
+    for (uint32_t i = 0; i < m_bodies.size(); i++)
+    {
+        if (m_bodies[i]->isSleeping && !m_islandAwake[Find(i)])
+            sleepIDOfRoot.try_emplace(Find(i), m_bodies[i]->sleepIslandID);
+    }
+    for (uint32_t i = 0; i < m_bodies.size(); i++)
+    {
+        RigidbodyComponent *rb = m_bodies[i];
+        uint32_t root = Find(i);
+        if (root == i)
+        {
+            m_stats.islands++;
+            if (m_islandGrounded[root])
+                m_stats.groundedIslands++;
+        }
+        if (m_islandAwake[root])
+        {
+            if (rb->isSleeping)
+                rb->WakeUp();
+            rb->sleepIslandID = 0;
+            m_stats.awakeBodies++;
+            continue;
+        }
+        if (!rb->isSleeping)
+        {
+            auto [it, inserted] = sleepIDOfRoot.try_emplace(root, m_nextSleepIslandID);
+            if (inserted)
+                m_nextSleepIslandID = m_nextSleepIslandID == std::numeric_limits<uint32_t>::max() ? 1 : m_nextSleepIslandID + 1;
+            rb->isSleeping = true;
+            rb->sleepIslandID = it->second;
+            rb->velocity = Vector3f::ZERO;
+            rb->angularVelocity = Vector3f::ZERO;
+            rb->angularMomentum = Vector3f::ZERO;
+        }
+        // 积分器跳过休眠体, 这里丢弃本步记入的外力
+        rb->ClearForces();
+        if (m_islandGrounded[root])
+            m_groundedSleepIslands.insert(rb->sleepIslandID);
+        m_stats.sleepingBodies++;
+    }
+}
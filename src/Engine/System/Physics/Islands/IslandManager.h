@@ -0,0 +1,70 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "Engine/Math/Math.h"
+#include <nlohmann/json.hpp>
+using json = nlohmann::json;
+
+class GameWorld;
+struct RigidbodyComponent;
+
+// 基于接触图的休眠管理
+// 每步由碰撞/重力阶段上报接触对, 积分前用并查集求出岛屿 (速度尚未叠加本步的重力):
+// 岛内所有刚体持续低速超过 timeToSleep 才整体休眠, 任一成员被唤醒时整岛唤醒
+// 不受支撑的岛还要求全岛净外力产生的加速度低于 accelerationThreshold (成员间的引力相互抵消),
+// 否则弱引力场中缓慢加速的刚体会在低速时入睡, 此后不再受力而被冻结在原地
+class IslandManager
+{
+public:
+    struct Stats
+    {
+        size_t awakeBodies = 0;
+        size_t sleepingBodies = 0;
+        size_t islands = 0;
+        size_t groundedIslands = 0; // 与地面/静态体接触的岛
+    };
+
+    // 场景 physics.sleep: {"enable", "linearThreshold", "angularThreshold", "accelerationThreshold", "timeToSleep"}
+    void Initialize(const json &config);
+
+    // b 为 nullptr 表示与地面等静态支撑接触: 不合并岛屿, 只标记该岛受支撑
+    void ReportContact(RigidbodyComponent *a, RigidbodyComponent *b);
+    void Update(GameWorld &world, float fixedDeltaTime);
+
+    bool IsEnabled() const { return m_enabled; }
+    const Stats &GetStats() const { return m_stats; }
+
+private:
+    uint32_t Find(uint32_t node);
+    void Union(uint32_t a, uint32_t b);
+
+    bool m_enabled = true;
+    float m_linearThreshold = 0.05f;
+    float m_angularThreshold = 0.05f;
+    float m_accelerationThreshold = 0.0001f;
+    float m_timeToSleep = 0.5f;
+
+    std::vector<std::pair<RigidbodyComponent *, RigidbodyComponent *>> m_contacts;
+
+    // 每步重建的临时数据
+    std::vector<RigidbodyComponent *> m_bodies;
+    std::unordered_map<RigidbodyComponent *, uint32_t> m_nodeOf;
+    std::vector<uint32_t> m_parent;
+    std::vector<uint8_t> m_islandAwake;
+    std::vector<uint8_t> m_islandGrounded;
+    std::vector<Vector3f> m_islandForce;
+    std::vector<float> m_islandMass;
+    std::unordered_map<uint32_t, uint32_t> m_nodeOfSleepIsland;
+    std::vector<uint32_t> m_groundedNodes;
+    std::unordered_set<uint32_t> m_wokenSleepIslands;
+
+    // 入睡时受支撑的休眠岛: 休眠体不再上报地面接触, 只能沿用入睡时的判定
+    std::unordered_set<uint32_t> m_groundedSleepIslands;
+    uint32_t m_nextSleepIslandID = 1;
+    Stats m_stats;
+};
@@ -1,6 +1,8 @@
 #include "Engine/System/Physics/PhysicsSystem.h"
 #include "Engine/System/Physics/IPhysicsStage.h"
+#include "Engine/System/Physics/BroadPhase/SweepAndPrune.h"
 #include "Engine/System/Physics/Stages/CollisionStage.h"
 #include "Engine/System/Physics/Stages/CollisionEvent.h"
 #include "Engine/System/Physics/Stages/GravityStage.h"
-#include "Engine/System/Physics/PhysicsStageFactory.h"
\ No newline at end of file
+#include "Engine/System/Physics/PhysicsStageFactory.h"
+#include "Engine/System/Physics/Scheduler/StageScheduler.h"
\ No newline at end of file
@@ -2,95 +2,44 @@
 #include "Engine/Core/GameWorld.h"
 #include "Engine/Core/Components/TransformComponent.h"
 #include "Engine/Core/Components/RigidBodyComponent.h"
-#include "Engine/Math/Math.h"
-#include <limits>
+#include "Engine/Core/Jobs/JobSystem.h"
 void PhysicsSystem::AddStage(std::unique_ptr<IPhysicsStage> stage)
 {
     m_stages.push_back(std::move(stage));
+    m_scheduleDirty = true;
 }
 
 void PhysicsSystem::ClearStages()
 {
     m_stages.clear();
+    m_scheduleDirty = true;
 }
 
 void PhysicsSystem::Update(GameWorld &world, float fixedDeltaTime)
 {
-
-    for (auto &stage : m_stages)
+    if (m_scheduleDirty)
     {
-        stage->Execute(world, fixedDeltaTime);
+        m_scheduler.Build(m_stages);
+        m_scheduleDirty = false;
     }
-
-    Integrate(world, fixedDeltaTime);
+    m_scheduler.Run(world, &world.GetJobSystem(), fixedDeltaTime);
+
+    // 静止判定放在积分前: 落地刚体的速度已被重力阶段清零,
+    // 积分后会带上 g*dt 的残余速度而永远达不到休眠阈值
+    m_islands.Update(world, fixedDeltaTime);
+    m_integrator.Integrate(world, &world.GetJobSystem(), fixedDeltaTime);
+    // 积分结果经 SetWorldTRS 写回, 不经过 UpdateTransforms; 显式让 BVH 过期
+    if (m_integrator.GetStats().integrated > 0)
+        m_query.MarkStale();
 }
 
-void PhysicsSystem::Integrate(GameWorld &world, float fixedDeltaTime)
+void PhysicsSystem::ConfigureIntegrator(const json &config)
 {
-    for (auto *object : world.GetActivateGameObjects())
-    {
-        if (object->HasComponent<RigidbodyComponent>() && object->HasComponent<TransformComponent>())
-        {
-            auto &rb = object->GetComponent<RigidbodyComponent>();
-            auto &tf = object->GetComponent<TransformComponent>();
-
-            // 1. F = ma  =>  a = F / m
-            // 如果质量为0，不移动
-            if (std::abs(rb.mass) <= std::numeric_limits<float>::min())
-                continue;
-
-            Vector3f acceleration = rb.accumulatedForces / rb.mass;
-
-            // 2. v = v + a * t
-            rb.velocity += acceleration * fixedDeltaTime;
-
-            // v = v * (1 - drag * t)
-            float dragFactor = 1.0f - (rb.drag * fixedDeltaTime);
-            if (dragFactor < 0)
-                dragFactor = 0;
-            rb.velocity *= dragFactor;
-
-            // 4. p = p + v * t
-
-            Vector3f pos = tf.GetWorldPosition();
-            Quat4f rot = tf.GetWorldRotation();
-            Vector3f scale = tf.GetWorldScale();
-            pos += rb.velocity * fixedDeltaTime;
-            // tf.SetLocalPosition(tf.GetLocalPosition() + rb.velocity * fixedDeltaTime);
-            tf.SetWorldMatrix(Matrix4f::CreateTransform(pos, rot, scale));
-
-            // angluar velocity
-            Matrix3f rotationMatrix = rot.toMatrix();
-            Matrix3f worldInverseInertia = rotationMatrix * rb.inverseInertiaTensor * rotationMatrix.transposed();
-
-            rb.angularMomentum += rb.accumulatedTorques * fixedDeltaTime;
-
-            float angularDragFactor = 1.0f - (rb.angularDrag * fixedDeltaTime);
-            if (angularDragFactor < 0)
-                angularDragFactor = 0;
-            rb.angularMomentum *= angularDragFactor;
-
-            rb.angularVelocity = worldInverseInertia * rb.angularMomentum;
-
-            if (rb.angularVelocity.Length() > std::numeric_limits<float>::min())
-            {
-                // 角速度四元数 (0, ωx, ωy, ωz)
-                Quat4f omegaQuat(0, rb.angularVelocity.x(), rb.angularVelocity.y(), rb.angularVelocity.z());
-
-                // dq/dt = 0.5 * w * q
-                // 世界系w左乘
-                Quat4f dq = (omegaQuat * rot) * 0.5f;
-
-                // 欧拉方法积分 q(t+dt) = q(t) + dq*dt
-                rot = rot + dq * fixedDeltaTime;
-
-                // 归一化
-                rot.normalize();
+    m_integrator.SetParallel(config.value("parallel", true));
+    m_integrator.SetGrain(config.value("grain", 128));
+}
 
-                tf.SetWorldMatrix(Matrix4f::CreateTransform(pos, rot, scale));
-            }
-            // 5. 清理受力
-            rb.ClearForces();
-        }
-    }
-}
\ No newline at end of file
+void PhysicsSystem::ConfigureScheduler(const json &config)
+{
+    m_scheduler.SetParallel(config.value("parallel", true));
+}
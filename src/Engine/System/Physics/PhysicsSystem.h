@@ -1,5 +1,9 @@
 #pragma once
 #include "IPhysicsStage.h"
+#include "Engine/System/Physics/Integrator/BatchIntegrator.h"
+#include "Engine/System/Physics/Islands/IslandManager.h"
+#include "Engine/System/Physics/Scheduler/StageScheduler.h"
+#include "Engine/System/Ray/PhysicsQuery.h"
 #include <vector>
 #include <memory>
 
@@ -8,11 +12,40 @@ public:
     void Update(GameWorld& world, float fixedDeltaTime);
     void AddStage(std::unique_ptr<IPhysicsStage> stage);
     void ClearStages();
+    // 场景 physics.integrator: {"parallel": bool, "grain": int}
+    void ConfigureIntegrator(const json &config);
+    const BatchIntegrator::Stats &GetIntegratorStats() const { return m_integrator.GetStats(); }
+    // 场景 physics.scheduler: {"parallel": bool}
+    void ConfigureScheduler(const json &config);
+    const StageScheduler::Stats &GetSchedulerStats() const { return m_scheduler.GetStats(); }
+
+    // 射线/重叠/扫掠查询
+    PhysicsQuery &GetQuery() { return m_query; }
+
+    IslandManager &GetIslandManager() { return m_islands; }
+    const IslandManager::Stats &GetSleepStats() const { return m_islands.GetStats(); }
+
+    template <typename T>
+    T *GetStage() const
+    {
+        for (auto &stage : m_stages)
+        {
+            if (auto *typed = dynamic_cast<T *>(stage.get()))
+                return typed;
+        }
+        return nullptr;
+    }
 
 private:
     // 不同物理规则
     std::vector<std::unique_ptr<IPhysicsStage>> m_stages;
-    
+    // 按读写集分批, 阶段增删后重建
+    StageScheduler m_scheduler;
+    bool m_scheduleDirty = true;
+
     // 半euler积分
-    void Integrate(GameWorld& world, float fixedDeltaTime);
+    BatchIntegrator m_integrator;
+    // 休眠与岛屿
+    IslandManager m_islands;
+    PhysicsQuery m_query;
 };
\ No newline at end of file
@@ -0,0 +1,59 @@
+#include "StageScheduler.h"
+#include "Engine/Core/GameWorld.h"
+#include "Engine/Core/Jobs/JobSystem.h"
+
+void StageScheduler::Build(const std::vector<std::unique_ptr<IPhysicsStage>> &stages)
+{
+    m_waves.clear();
+    m_stats = Stats();
+    m_stats.stages = stages.size();
+    for (auto &stage : stages)
+    {
+        StageAccess access = stage->GetAccess();
+        // 只能并入最后一批: 更早的批已经在它之前完成, 顺序不会被打乱
+        if (m_waves.empty() || m_waves.back().access.ConflictsWith(access))
+            m_waves.emplace_back();
+        Wave &wave = m_waves.back();
+        wave.stages.push_back(stage.get());
+        wave.access.reads |= access.reads;
+        wave.access.writes |= access.writes;
+        wave.access.deferred |= access.deferred;
+    }
+    m_stats.waves = m_waves.size();
+    for (auto &wave : m_waves)
+    {
+        if (wave.stages.size() > 1)
+            m_stats.concurrentStages += wave.stages.size();
+    }
+}
+
+void StageScheduler::Run(GameWorld &world, JobSystem *jobs, float fixedDeltaTime)
+{
+    for (auto &wave : m_waves)
+    {
+        for (auto *stage : wave.stages)
+            stage->BeginStep(world);
+    }
+    for (auto &wave : m_waves)
+    {
+        if (wave.stages.size() == 1 || !m_parallel || !jobs)
+        {
+            // 单阶段批: 阶段内部可以自行用 JobSystem 切分逐实体循环
+            for (auto *stage : wave.stages)
+                stage->Execute(world, fixedDeltaTime);
+        }
+        else
+        {
+            // 多阶段批: 每个阶段一个任务, 阶段内部的 ParallelFor 由空闲线程协助
+            jobs->ParallelFor(wave.stages.size(), 1,
+                              [&](size_t begin, size_t end)
+                              {
+                                  for (size_t i = begin; i < end; i++)
+                                      wave.stages[i]->Execute(world, fixedDeltaTime);
+                              });
+        }
+        // 延迟写无论是否并行都在批末提交, 结果与 parallel 开关无关
+        for (auto *stage : wave.stages)
+            stage->Commit(world);
+    }
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include "Engine/System/Physics/IPhysicsStage.h"
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+class GameWorld;
+class JobSystem;
+
+// 按阶段声明的读写集把阶段分成若干批(wave):
+// 批内阶段两两无冲突, 可以并发执行; 批与批之间按场景 JSON 的顺序串行
+// 冲突的阶段永远保持原有先后, 未声明读写集的阶段独占一批
+// 每步先对所有阶段调用 BeginStep, 每批执行完后按顺序调用批内阶段的 Commit
+class StageScheduler
+{
+public:
+    struct Stats
+    {
+        size_t stages = 0;
+        size_t waves = 0;
+        size_t concurrentStages = 0; // 与其他阶段同批执行的阶段数
+    };
+
+    void Build(const std::vector<std::unique_ptr<IPhysicsStage>> &stages);
+    void Run(GameWorld &world, JobSystem *jobs, float fixedDeltaTime);
+
+    void SetParallel(bool parallel) { m_parallel = parallel; }
+    const Stats &GetStats() const { return m_stats; }
+
+private:
+    struct Wave
+    {
+        std::vector<IPhysicsStage *> stages;
+        StageAccess access{PHYSICS_DATA_NONE, PHYSICS_DATA_NONE};
+    };
+
+    std::vector<Wave> m_waves;
+    bool m_parallel = true;
+    Stats m_stats;
+};
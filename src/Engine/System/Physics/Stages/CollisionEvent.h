@@ -13,12 +13,14 @@ struct CollisionEvent : public IEvent
   Vector3f hitpoint;
   Vector3f relativeVelocity;
   float impulse;
+  // 连续碰撞检测命中时为步内的碰撞时刻 [0, 1], 离散检测为 -1
+  float timeOfImpact;
 
-  CollisionEvent(GameObject *object1, GameObject *object2, Vector3f normal, float penetration, Vector3f hitpoint, Vector3f relativeVelocity, float j)
+  CollisionEvent(GameObject *object1, GameObject *object2, Vector3f normal, float penetration, Vector3f hitpoint, Vector3f relativeVelocity, float j, float timeOfImpact = -1.0f)
       : m_object1(object1),
         m_object2(object2),
         normal(normal),
         penetration(penetration),
         hitpoint(hitpoint),
-        relativeVelocity(relativeVelocity), impulse(j) {}
+        relativeVelocity(relativeVelocity), impulse(j), timeOfImpact(timeOfImpact) {}
 };
\ No newline at end of file
@@ -2,67 +2,134 @@
 #include "CollisionEvent.h"
 #include "Engine/Core/GameWorld.h"
 #include "Engine/Core/Components/Components.h"
+#include "Engine/System/Physics/PhysicsSystem.h"
+#include <algorithm>
 #include <limits>
 
-void CollisionStage::Initialize(const json &config) {};
+void CollisionStage::Initialize(const json &config)
+{
+    // 排序轴: 0=x 1=y 2=z, 选物体分布最分散的轴效果最好
+    m_broadPhase.SetAxis(config.value("sweepAxis", 0));
+}
 
 void CollisionStage::Execute(GameWorld &world, float fixedDeltaTime)
 {
-    auto &gameObjects = world.GetActivateGameObjects();
-    // TODO:优化
-
-    for (size_t i = 0; i < gameObjects.size(); i++)
+    // Broad Phase
+    m_broadPhase.Update(world.GetActivateGameObjects());
+    const auto &pairs = m_broadPhase.ComputePairs();
+
+    IslandManager &islands = world.GetPhysicsSystem().GetIslandManager();
+    m_contactCount = 0;
+    m_pendingCallbacks.clear();
+    m_pendingEvents.clear();
+    for (const auto &pair : pairs)
     {
-        auto &go1 = gameObjects[i];
-        if (!go1->HasComponent<RigidbodyComponent>() || !go1->HasComponent<TransformComponent>())
+        GameObject *go1 = pair.a->object;
+        GameObject *go2 = pair.b->object;
+        auto &rb1 = *pair.a->rigidbody;
+        auto &rb2 = *pair.b->rigidbody;
+
+        // 双方都在休眠或静止不动(无质量): 接触状态不会变化
+        bool active1 = !rb1.isSleeping && rb1.mass > std::numeric_limits<float>::min();
+        bool active2 = !rb2.isSleeping && rb2.mass > std::numeric_limits<float>::min();
+        if (!active1 && !active2)
             continue;
 
-        auto &rb1 = go1->GetComponent<RigidbodyComponent>();
-        if (!rb1.Collidable)
-            continue;
+        // TODO:实现更多BoundBox
+        Vector3f normal;
+        Vector3f hitPoint;
+        float penetration = 0.0f;
 
-        for (size_t j = i + 1; j < gameObjects.size(); j++)
+        // Narrow Phase
+        HitBox box1(*pair.a->transform, rb1);
+        HitBox box2(*pair.b->transform, rb2);
+
+        bool isColliding = HitBox::GetCollisionInfo(box1, box2, normal, penetration, hitPoint);
+
+        if (isColliding)
         {
-            auto &go2 = gameObjects[j];
-            if (go1 == go2)
-                continue;
-            if (!go2->HasComponent<RigidbodyComponent>() || !go2->HasComponent<TransformComponent>())
-                continue;
-
-            auto &rb2 = go2->GetComponent<RigidbodyComponent>();
-            if (!rb2.Collidable)
-                continue;
-
-            auto &tf1 = go1->GetComponent<TransformComponent>();
-            auto &tf2 = go2->GetComponent<TransformComponent>();
-
-            // TODO:实现更多BoundBox,优化碰撞检测
-            bool isColliding = false;
-            Vector3f normal;
-            Vector3f hitPoint;
-            float penetration = 0.0f;
-
-            // Broad Phase
-            AABB aabb1 = go1->GetWorldAABB();
-            AABB aabb2 = go2->GetWorldAABB();
-            if (!AABB::IsCollide(aabb1, aabb2))
-                continue;
-            // Narrow Phase
-            HitBox box1(tf1, rb1);
-            HitBox box2(tf2, rb2);
-
-            isColliding = HitBox::GetCollisionInfo(box1, box2, normal, penetration, hitPoint);
-
-            if (isColliding)
-            {
-                if (rb1.collisionCallback)
-                    rb1.collisionCallback(go2);
-                if (rb2.collisionCallback)
-                    rb2.collisionCallback(go1);
-                ResolveCollision(world, go1, go2, normal, penetration, hitPoint);
-            }
+            m_contactCount++;
+            islands.ReportContact(&rb1, &rb2);
+            m_pendingCallbacks.emplace_back(go1, go2);
+            ResolveCollision(world, go1, go2, normal, penetration, hitPoint);
         }
     }
+
+    SweepContinuous(world, fixedDeltaTime);
+}
+
+void CollisionStage::Commit(GameWorld &world)
+{
+    for (auto &[a, b] : m_pendingCallbacks)
+    {
+        auto &rbA = a->GetComponent<RigidbodyComponent>();
+        auto &rbB = b->GetComponent<RigidbodyComponent>();
+        if (rbA.collisionCallback)
+            rbA.collisionCallback(b);
+        if (rbB.collisionCallback)
+            rbB.collisionCallback(a);
+    }
+    for (const auto &event : m_pendingEvents)
+        world.GetEventManager().Emit(event);
+    m_pendingCallbacks.clear();
+    m_pendingEvents.clear();
+}
+
+void CollisionStage::SweepContinuous(GameWorld &world, float fixedDeltaTime)
+{
+    m_ccdHitCount = 0;
+    m_ccdBodies.clear();
+    world.View<RigidbodyComponent, TransformComponent>().Each(
+        [this](GameObject &object, RigidbodyComponent &rb, TransformComponent &)
+        {
+            if (rb.continuousCollision && rb.Collidable && !rb.isSleeping)
+                m_ccdBodies.push_back(&object);
+        });
+    if (m_ccdBodies.empty())
+        return;
+
+    PhysicsQuery &query = world.GetPhysicsSystem().GetQuery();
+    for (auto *object : m_ccdBodies)
+    {
+        auto &rb = object->GetComponent<RigidbodyComponent>();
+        auto &tf = object->GetComponent<TransformComponent>();
+
+        // 盒体用内切球扫掠, 只在本步位移超过自身尺寸时才可能穿透
+        float radius = rb.boudingRadius;
+        if (rb.colliderType == ColliderType::BOX)
+        {
+            Vector3f half = (rb.localAABB.max - rb.localAABB.min) * 0.5f;
+            Vector3f scale = tf.GetWorldScale();
+            radius = std::min({half.x() * std::abs(scale.x()), half.y() * std::abs(scale.y()), half.z() * std::abs(scale.z())});
+        }
+        float travel = rb.velocity.Length() * fixedDeltaTime;
+        if (travel <= radius || travel <= epsilon)
+            continue;
+
+        SphereSweep sweep;
+        sweep.origin = tf.GetWorldPosition();
+        sweep.direction = rb.velocity;
+        sweep.radius = radius;
+        sweep.ignoreInitialOverlap = true;
+        mRaycastHit hit;
+        if (query.SweepSphere(world, &sweep, 1, travel, &hit, object) == 0)
+            continue;
+
+        GameObject *other = hit.entity;
+        auto &otherRb = other->GetComponent<RigidbodyComponent>();
+        m_ccdHitCount++;
+        m_contactCount++;
+
+        // 退回到碰撞时刻; 之后积分器以响应后的速度继续运动
+        Vector3f direction = rb.velocity.Normalized();
+        tf.SetWorldPosition(sweep.origin + direction * hit.distance);
+
+        world.GetPhysicsSystem().GetIslandManager().ReportContact(&rb, &otherRb);
+        m_pendingCallbacks.emplace_back(object, other);
+        // hit.normal 由目标指向扫掠球, ResolveCollision 需要 A->B
+        Vector3f contactPoint = hit.point - hit.normal * radius;
+        ResolveCollision(world, object, other, -hit.normal, 0.0f, contactPoint, hit.distance / travel);
+    }
 }
 float GetInverseMass(const RigidbodyComponent &rb)
 {
@@ -70,7 +137,8 @@ float GetInverseMass(const RigidbodyComponent &rb)
         return 0.0f;
     return 1.0f / rb.mass;
 }
-void CollisionStage::ResolveCollision(GameWorld &world, GameObject *a, GameObject *b, const Vector3f &normal, float penetration, const Vector3f &hitPoint)
+void CollisionStage::ResolveCollision(GameWorld &, GameObject *a, GameObject *b, const Vector3f &normal, float penetration, const Vector3f &hitPoint,
+                                      float timeOfImpact)
 {
     // normal:A->B为正
 
@@ -131,8 +199,8 @@ void CollisionStage::ResolveCollision(GameWorld &world, GameObject *a, GameObjec
 
     // tfA.SetLocalPosition(tfA.GetLocalPosition());
     // tfB.SetLocalPosition(tfB.GetLocalPosition());
-    tfA.SetWorldMatrix(Matrix4f::CreateTransform(posA, _rotA, scaleA));
-    tfB.SetWorldMatrix(Matrix4f::CreateTransform(posB, _rotB, scaleB));
+    tfA.SetWorldTRS(posA, _rotA, scaleA);
+    tfB.SetWorldTRS(posB, _rotB, scaleB);
 
-    world.GetEventManager().Emit(CollisionEvent(a, b, normal, penetration, hitPoint, rV, j));
+    m_pendingEvents.emplace_back(a, b, normal, penetration, hitPoint, rV, j, timeOfImpact);
 }
\ No newline at end of file
@@ -2,6 +2,8 @@
 #include "Engine/System/Physics/IPhysicsStage.h"
 #include "Engine/Core/Components/Components.h"
 #include "Engine/Math/Math.h"
+#include "Engine/System/Physics/BroadPhase/SweepAndPrune.h"
+#include "CollisionEvent.h"
 
 #include <nlohmann/json.hpp>
 using json = nlohmann::json;
@@ -14,9 +16,36 @@ public:
     CollisionStage() = default;
 
     void Execute(GameWorld &world, float fixedDeltaTime) override;
-    void ResolveCollision(GameWorld &world, GameObject *a, GameObject *b, const Vector3f &normal, float penetration, const Vector3f &hitPoint);
+    // 依次触发 Execute 中记录的碰撞回调与 CollisionEvent
+    void Commit(GameWorld &world) override;
+    // timeOfImpact 仅由连续碰撞检测传入, 原样写进 CollisionEvent
+    void ResolveCollision(GameWorld &world, GameObject *a, GameObject *b, const Vector3f &normal, float penetration, const Vector3f &hitPoint,
+                          float timeOfImpact = -1.0f);
     void Initialize(const json &config) override;
+    // 检测与响应读写位置/速度, 并向接触图与查询 BVH 登记;
+    // 回调与事件可能触碰任意数据, 推迟到 Commit
+    StageAccess GetAccess() const override
+    {
+        return {PHYSICS_DATA_TRANSFORM | PHYSICS_DATA_BODY | PHYSICS_DATA_VELOCITY | PHYSICS_DATA_WORLD,
+                PHYSICS_DATA_TRANSFORM | PHYSICS_DATA_VELOCITY | PHYSICS_DATA_FORCE | PHYSICS_DATA_WORLD,
+                PHYSICS_DATA_ALL};
+    }
+
+    const SweepAndPrune::Stats &GetBroadPhaseStats() const { return m_broadPhase.GetStats(); }
+    size_t GetContactCount() const { return m_contactCount; }
+    size_t GetCCDHitCount() const { return m_ccdHitCount; }
 
 private:
+    // 对开启 continuousCollision 的刚体沿本步位移扫掠, 命中时退回碰撞时刻的位置并按接触处理
+    void SweepContinuous(GameWorld &world, float fixedDeltaTime);
+
     float epsilon = 0.0001f;
+    SweepAndPrune m_broadPhase;
+    size_t m_contactCount = 0;
+    size_t m_ccdHitCount = 0;
+    std::vector<GameObject *> m_ccdBodies;
+
+    // 本步的接触对(触发双方的 collisionCallback)与待发送事件
+    std::vector<std::pair<GameObject *, GameObject *>> m_pendingCallbacks;
+    std::vector<CollisionEvent> m_pendingEvents;
 };
\ No newline at end of file
@@ -6,6 +6,7 @@
 
 #include "GravityStage.h"
 #include "Engine/Core/GameWorld.h"
+#include "Engine/System/Physics/PhysicsSystem.h"
 #include "Engine/Core/Components/RigidBodyComponent.h"
 #include "Engine/Core/Components/TransformComponent.h"
 
@@ -31,14 +32,13 @@ void GravityStage::Execute(GameWorld &world, float fixedDeltaTime)
         std::cout << "[Gravity Stage]:Empty Game World" << std::endl;
         return;
     }
-    for (auto &gameObject : gameObjects)
-    {
-        if (gameObject->HasComponent<RigidbodyComponent>())
+    IslandManager &islands = world.GetPhysicsSystem().GetIslandManager();
+    world.View<RigidbodyComponent, TransformComponent>().Each(
+        [this, &islands](GameObject &object, RigidbodyComponent &rb, TransformComponent &tf)
         {
-            auto &rb = gameObject->GetComponent<RigidbodyComponent>();
-            if (rb.mass <= 0.001f)
-                continue;
-            auto &tf = gameObject->GetComponent<TransformComponent>();
+            GameObject *gameObject = &object;
+            if (rb.mass <= 0.001f || rb.isSleeping)
+                return;
             rb.AddForce(m_gravity * rb.mass);
             Vector3f corners[8];
 
@@ -56,6 +56,8 @@ void GravityStage::Execute(GameWorld &world, float fixedDeltaTime)
             Vector3f normal = Vector3f(0.0f, 1.0f, 0.0f);
             if (lowy < ground)
             {
+                // 地面支撑计入接触图
+                islands.ReportContact(&rb, nullptr);
                 float penetration = ground - lowy;
                 if (penetration > slop)
                 {
@@ -128,6 +130,5 @@ void GravityStage::Execute(GameWorld &world, float fixedDeltaTime)
                     }
                 }
             }
-        }
-    }
+        });
 }
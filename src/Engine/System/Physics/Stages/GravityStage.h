@@ -15,6 +15,11 @@ public:
     void Execute(GameWorld &world, float fixedDeltaTime) override;
 
     void Initialize(const json &config) override;
+    StageAccess GetAccess() const override
+    {
+        return {PHYSICS_DATA_TRANSFORM | PHYSICS_DATA_BODY | PHYSICS_DATA_VELOCITY,
+                PHYSICS_DATA_TRANSFORM | PHYSICS_DATA_VELOCITY | PHYSICS_DATA_FORCE | PHYSICS_DATA_WORLD};
+    }
 
 private:
     float ground = 0.0f;
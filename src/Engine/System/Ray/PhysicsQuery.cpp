@@ -0,0 +1,648 @@
+#include "PhysicsQuery.h"
+#include "Engine/Core/GameWorld.h"
+#include "Engine/Core/Components/Components.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+    constexpr uint32_t LEAF_SIZE = 2;
+
+    AABB Merge(const AABB &a, const AABB &b)
+    {
+        AABB out;
+        for (int i = 0; i < 3; i++)
+        {
+            out.min[i] = std::min(a.min[i], b.min[i]);
+            out.max[i] = std::max(a.max[i], b.max[i]);
+        }
+        return out;
+    }
+
+    // 空叶子的包围盒: 与任何盒合并都不改变对方, 也不与任何盒相交
+    AABB EmptyBounds()
+    {
+        const float big = std::numeric_limits<float>::max();
+        return AABB(Vector3f(big, big, big), Vector3f(-big, -big, -big));
+    }
+
+    float HalfSurfaceArea(const AABB &box)
+    {
+        Vector3f d = box.max - box.min;
+        return d.x() * d.y() + d.y() * d.z() + d.z() * d.x();
+    }
+
+    // 把 bounds 并入节点后表面积的增量; 已清空的叶子可以直接复用, 代价最低
+    float InsertCost(const AABB &nodeBounds, bool emptyLeaf, const AABB &bounds)
+    {
+        if (emptyLeaf)
+            return -1.0f;
+        return HalfSurfaceArea(Merge(nodeBounds, bounds)) - HalfSurfaceArea(nodeBounds);
+    }
+
+    // 射线与(外扩后的)包围盒的进入距离, 不相交返回 false
+    bool RayAABB(const AABB &box, float inflate, const Vector3f &origin, const Vector3f &direction, float maxDistance, float &outEnter)
+    {
+        float tMin = 0.0f;
+        float tMax = maxDistance;
+        for (int i = 0; i < 3; i++)
+        {
+            float lo = box.min[i] - inflate;
+            float hi = box.max[i] + inflate;
+            if (std::abs(direction[i]) < 1e-12f)
+            {
+                if (origin[i] < lo || origin[i] > hi)
+                    return false;
+                continue;
+            }
+            float invD = 1.0f / direction[i];
+            float t1 = (lo - origin[i]) * invD;
+            float t2 = (hi - origin[i]) * invD;
+            if (t1 > t2)
+                std::swap(t1, t2);
+            tMin = std::max(tMin, t1);
+            tMax = std::min(tMax, t2);
+            if (tMin > tMax)
+                return false;
+        }
+        outEnter = tMin;
+        return true;
+    }
+
+    // 局部空间射线与盒体求交(slab), 与 mRay 原实现一致
+    bool RayBoxLocal(const Vector3f &boxMin, const Vector3f &boxMax, const Vector3f &localOrigin, const Vector3f &localDir,
+                     float &outDist, Vector3f &outLocalNormal)
+    {
+        float tMin = 0.0f;
+        float tMax = std::numeric_limits<float>::max();
+        Vector3f tempNormal;
+        for (int i = 0; i < 3; ++i)
+        {
+            if (std::abs(localDir[i]) < 1e-6f)
+            {
+                if (localOrigin[i] < boxMin[i] || localOrigin[i] > boxMax[i])
+                    return false;
+            }
+            else
+            {
+                float invD = 1.0f / localDir[i];
+                float t1 = (boxMin[i] - localOrigin[i]) * invD;
+                float t2 = (boxMax[i] - localOrigin[i]) * invD;
+
+                Vector3f normalSide = Vector3f::ZERO;
+                normalSide[i] = (t1 < t2) ? -1.0f : 1.0f;
+                if (t1 > t2)
+                    std::swap(t1, t2);
+                if (t1 > tMin)
+                {
+                    tMin = t1;
+                    tempNormal = normalSide;
+                }
+                if (t2 < tMax)
+                    tMax = t2;
+
+                if (tMin > tMax)
+                    return false;
+            }
+        }
+        outDist = tMin;
+        outLocalNormal = tempNormal;
+        return true;
+    }
+}
+
+void PhysicsQuery::Prepare(GameWorld &world)
+{
+    if (!m_subscribed)
+    {
+        world.SubscribeEntityQuery<RigidbodyComponent, TransformComponent>(
+            [this](GameObject *entity, bool added)
+            { OnMembershipChanged(entity, added); });
+        m_subscribed = true;
+        m_refitsSinceBuild = m_rebuildInterval;
+    }
+    // 合并查询缓存的积压变化, 增减通过 OnMembershipChanged 到达
+    const auto &entities = world.GetEntitiesWith<RigidbodyComponent, TransformComponent>();
+    if (m_refitsSinceBuild >= m_rebuildInterval)
+    {
+        Rebuild(entities);
+    }
+    else
+    {
+        if (m_stale)
+            Refit();
+        for (auto *entity : m_added)
+            Insert(entity);
+    }
+    m_added.clear();
+    m_stale = false;
+}
+
+void PhysicsQuery::OnMembershipChanged(GameObject *entity, bool added)
+{
+    if (added)
+    {
+        m_added.push_back(entity);
+        return;
+    }
+    // 移除通知时对象仍然有效, 之后可能被释放: 立即摘掉它的代理
+    auto it = m_proxyOf.find(entity);
+    if (it != m_proxyOf.end())
+    {
+        Remove(it->second);
+        return;
+    }
+    auto pending = std::find(m_added.begin(), m_added.end(), entity);
+    if (pending != m_added.end())
+        m_added.erase(pending);
+}
+
+void PhysicsQuery::RefreshProxy(Proxy &proxy)
+{
+    const auto &tf = *proxy.transform;
+    const auto &rb = *proxy.rigidbody;
+    proxy.collidable = rb.Collidable;
+    proxy.type = rb.colliderType;
+    proxy.radius = rb.boudingRadius;
+    proxy.boxMin = rb.localAABB.min;
+    proxy.boxMax = rb.localAABB.max;
+    proxy.position = tf.GetWorldPosition();
+    proxy.rotation = tf.GetWorldRotation();
+    proxy.scale = tf.GetWorldScale();
+    proxy.world = tf.GetWorldMatrix();
+    proxy.invWorld = proxy.world.inverse();
+    proxy.unitScale = std::abs(proxy.scale.x() - 1.0f) < 1e-5f && std::abs(proxy.scale.y() - 1.0f) < 1e-5f &&
+                      std::abs(proxy.scale.z() - 1.0f) < 1e-5f;
+
+    if (proxy.type == ColliderType::SPHERE)
+    {
+        Vector3f r(proxy.radius, proxy.radius, proxy.radius);
+        proxy.bounds = AABB(proxy.position - r, proxy.position + r);
+        return;
+    }
+    // 局部盒经完整世界矩阵(含缩放)变换后的包围盒, 与射线在局部空间的求交一致
+    Vector3f localCenter = (proxy.boxMin + proxy.boxMax) * 0.5f;
+    Vector3f halfExtents = (proxy.boxMax - proxy.boxMin) * 0.5f;
+    Vector3f center = (proxy.world * Vector4f(localCenter, 1.0f)).xyz();
+    Vector3f extent;
+    for (int i = 0; i < 3; i++)
+    {
+        extent[i] = std::abs(proxy.world(i, 0)) * halfExtents[0] +
+                    std::abs(proxy.world(i, 1)) * halfExtents[1] +
+                    std::abs(proxy.world(i, 2)) * halfExtents[2];
+    }
+    proxy.bounds = AABB(center - extent, center + extent);
+}
+
+void PhysicsQuery::Rebuild(const std::vector<GameObject *> &entities)
+{
+    m_proxies.clear();
+    m_freeProxies.clear();
+    m_proxyOf.clear();
+    for (auto *entity : entities)
+    {
+        auto &rb = entity->GetComponent<RigidbodyComponent>();
+        if (rb.colliderType != ColliderType::BOX && rb.colliderType != ColliderType::SPHERE)
+            continue;
+        Proxy proxy;
+        proxy.object = entity;
+        proxy.objectID = entity->GetID();
+        proxy.transform = &entity->GetComponent<TransformComponent>();
+        proxy.rigidbody = &rb;
+        RefreshProxy(proxy);
+        m_proxyOf[entity] = static_cast<uint32_t>(m_proxies.size());
+        m_proxies.push_back(proxy);
+    }
+
+    m_order.resize(m_proxies.size());
+    for (uint32_t i = 0; i < m_order.size(); i++)
+        m_order[i] = i;
+    m_nodes.clear();
+    if (!m_proxies.empty())
+    {
+        m_nodes.emplace_back();
+        BuildNode(0, 0, static_cast<uint32_t>(m_proxies.size()));
+    }
+
+    m_refitsSinceBuild = 0;
+    m_stats.rebuilds++;
+    m_stats.proxies = m_proxyOf.size();
+    m_stats.nodes = m_nodes.size();
+}
+
+void PhysicsQuery::Insert(GameObject *entity)
+{
+    auto &rb = entity->GetComponent<RigidbodyComponent>();
+    if (rb.colliderType != ColliderType::BOX && rb.colliderType != ColliderType::SPHERE)
+        return;
+
+    uint32_t index = 0;
+    if (!m_freeProxies.empty())
+    {
+        index = m_freeProxies.back();
+        m_freeProxies.pop_back();
+    }
+    else
+    {
+        index = static_cast<uint32_t>(m_proxies.size());
+        m_proxies.emplace_back();
+    }
+    Proxy &proxy = m_proxies[index];
+    proxy.object = entity;
+    proxy.objectID = entity->GetID();
+    proxy.transform = &entity->GetComponent<TransformComponent>();
+    proxy.rigidbody = &rb;
+    RefreshProxy(proxy);
+    m_proxyOf[entity] = index;
+
+    uint32_t position = static_cast<uint32_t>(m_order.size());
+    m_order.push_back(index);
+    m_stats.inserts++;
+    m_stats.proxies = m_proxyOf.size();
+
+    if (m_nodes.empty())
+    {
+        m_nodes.emplace_back();
+        m_nodes[0].bounds = proxy.bounds;
+        m_nodes[0].first = position;
+        m_nodes[0].count = 1;
+        proxy.leaf = 0;
+        m_stats.nodes = m_nodes.size();
+        return;
+    }
+
+    // 自顶向下沿表面积增量最小的孩子下降, 途经的节点顺路扩大包围盒
+    const AABB bounds = proxy.bounds;
+    uint32_t nodeIndex = 0;
+    while (m_nodes[nodeIndex].left >= 0)
+    {
+        Node &node = m_nodes[nodeIndex];
+        node.bounds = Merge(node.bounds, bounds);
+        uint32_t left = static_cast<uint32_t>(node.left);
+        const Node &a = m_nodes[left];
+        const Node &b = m_nodes[left + 1];
+        float costLeft = InsertCost(a.bounds, a.left < 0 && a.count == 0, bounds);
+        float costRight = InsertCost(b.bounds, b.left < 0 && b.count == 0, bounds);
+        nodeIndex = costLeft <= costRight ? left : left + 1;
+    }
+
+    if (m_nodes[nodeIndex].count == 0)
+    {
+        // 已被移除清空的叶子直接复用
+        Node &leaf = m_nodes[nodeIndex];
+        leaf.bounds = bounds;
+        leaf.first = position;
+        leaf.count = 1;
+        proxy.leaf = nodeIndex;
+        return;
+    }
+
+    // 叶子分裂: 原内容移到左孩子, 新代理独占右孩子
+    uint32_t left = static_cast<uint32_t>(m_nodes.size());
+    m_nodes.resize(m_nodes.size() + 2);
+    Node &leaf = m_nodes[nodeIndex];
+    m_nodes[left] = leaf;
+    m_nodes[left + 1].bounds = bounds;
+    m_nodes[left + 1].first = position;
+    m_nodes[left + 1].count = 1;
+    for (uint32_t k = leaf.first; k < leaf.first + leaf.count; k++)
+        m_proxies[m_order[k]].leaf = left;
+    proxy.leaf = left + 1;
+    leaf.bounds = Merge(leaf.bounds, bounds);
+    leaf.left = static_cast<int32_t>(left);
+    leaf.count = 0;
+    m_stats.nodes = m_nodes.size();
+}
+
+void PhysicsQuery::Remove(uint32_t proxyIndex)
+{
+    Proxy &proxy = m_proxies[proxyIndex];
+    // 从叶子区间中换出; 祖先的包围盒保持偏大, 下次重拟合时收紧
+    Node &leaf = m_nodes[proxy.leaf];
+    for (uint32_t k = leaf.first; k < leaf.first + leaf.count; k++)
+    {
+        if (m_order[k] != proxyIndex)
+            continue;
+        std::swap(m_order[k], m_order[leaf.first + leaf.count - 1]);
+        leaf.count--;
+        break;
+    }
+    m_proxyOf.erase(proxy.object);
+    proxy = Proxy();
+    m_freeProxies.push_back(proxyIndex);
+    m_stats.removes++;
+    m_stats.proxies = m_proxyOf.size();
+}
+
+void PhysicsQuery::BuildNode(uint32_t nodeIndex, uint32_t first, uint32_t count)
+{
+    AABB bounds = m_proxies[m_order[first]].bounds;
+    Vector3f c0 = bounds.min + bounds.max;
+    AABB centroids(c0, c0);
+    for (uint32_t k = first + 1; k < first + count; k++)
+    {
+        const AABB &b = m_proxies[m_order[k]].bounds;
+        bounds = Merge(bounds, b);
+        Vector3f c = b.min + b.max;
+        centroids = Merge(centroids, AABB(c, c));
+    }
+    m_nodes[nodeIndex].bounds = bounds;
+    m_nodes[nodeIndex].first = first;
+    m_nodes[nodeIndex].count = count;
+    if (count <= LEAF_SIZE)
+    {
+        for (uint32_t k = first; k < first + count; k++)
+            m_proxies[m_order[k]].leaf = nodeIndex;
+        return;
+    }
+
+    // 沿质心分布最宽的轴取中位数切分
+    Vector3f spread = centroids.max - centroids.min;
+    int axis = spread.x() > spread.y() ? (spread.x() > spread.z() ? 0 : 2) : (spread.y() > spread.z() ? 1 : 2);
+    uint32_t half = count / 2;
+    std::nth_element(m_order.begin() + first, m_order.begin() + first + half, m_order.begin() + first + count,
+                     [&](uint32_t a, uint32_t b)
+                     {
+                         return m_proxies[a].bounds.min[axis] + m_proxies[a].bounds.max[axis] <
+                                m_proxies[b].bounds.min[axis] + m_proxies[b].bounds.max[axis];
+                     });
+
+    // 左右孩子相邻存放, 下标总大于父节点
+    int32_t left = static_cast<int32_t>(m_nodes.size());
+    m_nodes.resize(m_nodes.size() + 2);
+    m_nodes[nodeIndex].left = left;
+    m_nodes[nodeIndex].count = 0;
+    BuildNode(left, first, half);
+    BuildNode(left + 1, first + half, count - half);
+}
+
+void PhysicsQuery::Refit()
+{
+    for (auto &proxy : m_proxies)
+    {
+        if (proxy.object)
+            RefreshProxy(proxy);
+    }
+    // 孩子的下标总是大于父节点, 逆序遍历即可自底向上
+    for (size_t n = m_nodes.size(); n > 0; n--)
+    {
+        Node &node = m_nodes[n - 1];
+        if (node.left < 0 && node.count == 0)
+        {
+            node.bounds = EmptyBounds();
+        }
+        else if (node.left < 0)
+        {
+            AABB bounds = m_proxies[m_order[node.first]].bounds;
+            for (uint32_t k = node.first + 1; k < node.first + node.count; k++)
+                bounds = Merge(bounds, m_proxies[m_order[k]].bounds);
+            node.bounds = bounds;
+        }
+        else
+        {
+            node.bounds = Merge(m_nodes[node.left].bounds, m_nodes[node.left + 1].bounds);
+        }
+    }
+    m_refitsSinceBuild++;
+    m_stats.refits++;
+}
+
+template <typename Visit>
+void PhysicsQuery::TraverseRay(const Vector3f &origin, const Vector3f &direction, float inflate, float maxDistance, Visit &&visit)
+{
+    if (m_nodes.empty())
+        return;
+    m_stack.clear();
+    m_stack.push_back(0);
+    float limit = maxDistance;
+    while (!m_stack.empty())
+    {
+        const Node &node = m_nodes[m_stack.back()];
+        m_stack.pop_back();
+        if (node.left < 0 && node.count == 0)
+            continue;
+        float enter = 0.0f;
+        if (!RayAABB(node.bounds, inflate, origin, direction, limit, enter))
+            continue;
+        if (node.left < 0)
+        {
+            for (uint32_t k = node.first; k < node.first + node.count; k++)
+                limit = visit(m_proxies[m_order[k]], limit);
+            continue;
+        }
+        m_stack.push_back(static_cast<uint32_t>(node.left));
+        m_stack.push_back(static_cast<uint32_t>(node.left + 1));
+    }
+}
+
+bool PhysicsQuery::RayHitsProxy(const Proxy &proxy, const Vector3f &origin, const Vector3f &direction,
+                                float &outDist, Vector3f &outNormal) const
+{
+    if (proxy.type == ColliderType::BOX)
+    {
+        Vector3f localOrigin = (proxy.invWorld * Vector4f(origin, 1.0f)).xyz();
+        Vector3f localDir = ((proxy.invWorld * Vector4f(direction, 0.0f)).xyz()).Normalized();
+        Vector3f localNormal;
+        if (!RayBoxLocal(proxy.boxMin, proxy.boxMax, localOrigin, localDir, outDist, localNormal))
+            return false;
+        outNormal = proxy.rotation * localNormal;
+        return true;
+    }
+
+    Vector3f oc = -proxy.position + origin;
+    float a = direction * direction;
+    float b = 2.0f * oc * direction;
+    float c = (oc * oc) - (proxy.radius * proxy.radius);
+    float discriminant = b * b - 4 * a * c;
+    if (discriminant < 0)
+        return false;
+    float t = (-b - std::sqrt(discriminant)) / (2.0f * a);
+    if (t < 0)
+        return false;
+    outDist = t;
+    outNormal = (origin + (direction * t) - proxy.position).Normalized();
+    return true;
+}
+
+bool PhysicsQuery::SweepHitsProxy(const Proxy &proxy, const SphereSweep &sweep, const Vector3f &direction,
+                                  float &outDist, Vector3f &outNormal) const
+{
+    if (proxy.type == ColliderType::BOX)
+    {
+        // 局部方向不归一化, 求得的 t 即世界空间距离; 半径按各轴缩放换算到局部
+        Vector3f localOrigin = (proxy.invWorld * Vector4f(sweep.origin, 1.0f)).xyz();
+        Vector3f localDir = (proxy.invWorld * Vector4f(direction, 0.0f)).xyz();
+        Vector3f grow;
+        for (int i = 0; i < 3; i++)
+            grow[i] = sweep.radius / std::max(std::abs(proxy.scale[i]), 1e-6f);
+        Vector3f localNormal;
+        if (!RayBoxLocal(proxy.boxMin - grow, proxy.boxMax + grow, localOrigin, localDir, outDist, localNormal))
+            return false;
+        if (outDist <= 0.0f && sweep.ignoreInitialOverlap)
+            return false;
+        outNormal = outDist > 0.0f ? proxy.rotation * localNormal : -direction;
+        return true;
+    }
+
+    float radius = proxy.radius + sweep.radius;
+    Vector3f oc = sweep.origin - proxy.position;
+    float c = (oc * oc) - radius * radius;
+    if (c <= 0.0f)
+    {
+        if (sweep.ignoreInitialOverlap)
+            return false;
+        outDist = 0.0f;
+        outNormal = oc.LengthSquared() > 1e-12f ? oc.Normalized() : -direction;
+        return true;
+    }
+    float b = oc * direction;
+    float discriminant = b * b - c;
+    if (b > 0.0f || discriminant < 0.0f)
+        return false;
+    outDist = -b - std::sqrt(discriminant);
+    outNormal = (sweep.origin + direction * outDist - proxy.position).Normalized();
+    return true;
+}
+
+bool PhysicsQuery::SphereHitsProxy(const Proxy &proxy, const Vector3f &center, float radius) const
+{
+    if (proxy.type == ColliderType::SPHERE)
+    {
+        float r = proxy.radius + radius;
+        return (center - proxy.position).LengthSquared() <= r * r;
+    }
+    // 局部空间取盒上最近点, 变回世界空间比较距离(正确处理缩放)
+    Vector3f local = (proxy.invWorld * Vector4f(center, 1.0f)).xyz();
+    Vector3f closest;
+    for (int i = 0; i < 3; i++)
+        closest[i] = std::max(proxy.boxMin[i], std::min(proxy.boxMax[i], local[i]));
+    Vector3f worldClosest = (proxy.world * Vector4f(closest, 1.0f)).xyz();
+    return (worldClosest - center).LengthSquared() <= radius * radius;
+}
+
+mRaycastHit PhysicsQuery::Raycast(GameWorld &world, const mRay &ray, float maxDistance, GameObject *ignoreEntity)
+{
+    mRaycastHit hit;
+    RaycastMany(world, &ray, 1, maxDistance, &hit, ignoreEntity);
+    return hit;
+}
+
+size_t PhysicsQuery::RaycastMany(GameWorld &world, const mRay *rays, size_t count, float maxDistance,
+                                 mRaycastHit *outHits, GameObject *ignoreEntity)
+{
+    Prepare(world);
+    size_t hitCount = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        const mRay &ray = rays[i];
+        mRaycastHit &closestHit = outHits[i];
+        closestHit = mRaycastHit();
+        closestHit.distance = std::numeric_limits<float>::max();
+        TraverseRay(ray.origin, ray.direction, 0.0f, maxDistance,
+                    [&](const Proxy &proxy, float limit)
+                    {
+                        if (proxy.object == ignoreEntity || !proxy.rigidbody->Collidable)
+                            return limit;
+                        m_stats.narrowTests++;
+                        float dist = 0.0f;
+                        Vector3f normal;
+                        if (!RayHitsProxy(proxy, ray.origin, ray.direction, dist, normal))
+                            return limit;
+                        if (dist > 0 && dist < maxDistance && dist < closestHit.distance)
+                        {
+                            closestHit.hit = true;
+                            closestHit.distance = dist;
+                            closestHit.entity = proxy.object;
+                            closestHit.normal = normal;
+                            closestHit.point = ray.origin + ray.direction * dist;
+                            // 盒体距离在局部空间度量, 只有无缩放时才能用来裁剪世界空间遍历
+                            if (proxy.type == ColliderType::SPHERE || proxy.unitScale)
+                                return std::min(limit, dist);
+                        }
+                        return limit;
+                    });
+        if (closestHit.hit)
+            hitCount++;
+    }
+    m_stats.queries += count;
+    return hitCount;
+}
+
+size_t PhysicsQuery::SphereOverlap(GameWorld &world, const Vector3f &center, float radius,
+                                   GameObject **outEntities, size_t capacity, GameObject *ignoreEntity)
+{
+    Prepare(world);
+    m_stats.queries++;
+    size_t written = 0;
+    if (m_nodes.empty() || capacity == 0)
+        return 0;
+    Vector3f r(radius, radius, radius);
+    AABB query(center - r, center + r);
+    m_stack.clear();
+    m_stack.push_back(0);
+    while (!m_stack.empty() && written < capacity)
+    {
+        const Node &node = m_nodes[m_stack.back()];
+        m_stack.pop_back();
+        if (!AABB::IsCollide(node.bounds, query))
+            continue;
+        if (node.left >= 0)
+        {
+            m_stack.push_back(static_cast<uint32_t>(node.left));
+            m_stack.push_back(static_cast<uint32_t>(node.left + 1));
+            continue;
+        }
+        for (uint32_t k = node.first; k < node.first + node.count && written < capacity; k++)
+        {
+            const Proxy &proxy = m_proxies[m_order[k]];
+            if (proxy.object == ignoreEntity || !proxy.rigidbody->Collidable)
+                continue;
+            m_stats.narrowTests++;
+            if (SphereHitsProxy(proxy, center, radius))
+                outEntities[written++] = proxy.object;
+        }
+    }
+    return written;
+}
+
+size_t PhysicsQuery::SweepSphere(GameWorld &world, const SphereSweep *sweeps, size_t count, float maxDistance,
+                                 mRaycastHit *outHits, GameObject *ignoreEntity)
+{
+    Prepare(world);
+    size_t hitCount = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        const SphereSweep &sweep = sweeps[i];
+        Vector3f direction = sweep.direction.Normalized();
+        mRaycastHit &closestHit = outHits[i];
+        closestHit = mRaycastHit();
+        closestHit.distance = std::numeric_limits<float>::max();
+        TraverseRay(sweep.origin, direction, sweep.radius, maxDistance,
+                    [&](const Proxy &proxy, float limit)
+                    {
+                        if (proxy.object == ignoreEntity || !proxy.rigidbody->Collidable)
+                            return limit;
+                        m_stats.narrowTests++;
+                        float dist = 0.0f;
+                        Vector3f normal;
+                        if (!SweepHitsProxy(proxy, sweep, direction, dist, normal))
+                            return limit;
+                        if (dist >= 0 && dist < maxDistance && dist < closestHit.distance)
+                        {
+                            closestHit.hit = true;
+                            closestHit.distance = dist;
+                            closestHit.entity = proxy.object;
+                            closestHit.normal = normal;
+                            // 命中时球心位置
+                            closestHit.point = sweep.origin + direction * dist;
+                            return std::min(limit, dist);
+                        }
+                        return limit;
+                    });
+        if (closestHit.hit)
+            hitCount++;
+    }
+    m_stats.queries += count;
+    return hitCount;
+}
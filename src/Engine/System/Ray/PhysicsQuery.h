@@ -0,0 +1,122 @@
+#pragma once
+#include "mRay.h"
+#include "Engine/Math/Math.h"
+#include "Engine/Core/Components/Components.h"
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+class GameObject;
+class GameWorld;
+
+struct SphereSweep
+{
+    Vector3f origin;
+    Vector3f direction;
+    float radius = 0.0f;
+    // 忽略起点即已重叠的物体(由离散检测处理)
+    bool ignoreInitialOverlap = false;
+};
+
+// 场景查询服务: 对可碰撞刚体维护一棵 BVH, 并缓存每个物体的世界逆矩阵
+// 变换有变化时只标记过期, 下一次查询时才重拟合; 实体集合的增减按查询缓存的通知增量插入/移除,
+// 只有拟合次数过多(树质量下降)时才全量重建
+// 批量接口的结果写入调用方提供的缓冲区, 查询过程不分配内存
+class PhysicsQuery
+{
+public:
+    struct Stats
+    {
+        size_t proxies = 0;
+        size_t nodes = 0;
+        size_t rebuilds = 0;
+        size_t refits = 0;
+        size_t inserts = 0;
+        size_t removes = 0;
+        size_t queries = 0;
+        size_t narrowTests = 0; // 实际执行的形状求交次数
+    };
+
+    void MarkStale() { m_stale = true; }
+
+    // 求交规则与 mRay 相同: 命中距离 (0, maxDistance) 内最近的物体
+    mRaycastHit Raycast(GameWorld &world, const mRay &ray, float maxDistance, GameObject *ignoreEntity = nullptr);
+    // outHits[i] 对应 rays[i], 返回命中的射线数
+    size_t RaycastMany(GameWorld &world, const mRay *rays, size_t count, float maxDistance,
+                       mRaycastHit *outHits, GameObject *ignoreEntity = nullptr);
+    // 写入至多 capacity 个与球相交的物体, 返回写入数量
+    size_t SphereOverlap(GameWorld &world, const Vector3f &center, float radius,
+                         GameObject **outEntities, size_t capacity, GameObject *ignoreEntity = nullptr);
+    // 球沿方向扫掠, outHits[i] 对应 sweeps[i]; 起点已重叠时命中距离为 0. 返回命中数
+    // 盒体按局部轴向外扩半径求交, 棱角处略偏保守
+    size_t SweepSphere(GameWorld &world, const SphereSweep *sweeps, size_t count, float maxDistance,
+                       mRaycastHit *outHits, GameObject *ignoreEntity = nullptr);
+
+    void SetRebuildInterval(size_t refits) { m_rebuildInterval = refits; }
+    const Stats &GetStats() const { return m_stats; }
+
+private:
+    struct Proxy
+    {
+        GameObject *object = nullptr;
+        unsigned int objectID = 0;
+        TransformComponent *transform = nullptr;
+        RigidbodyComponent *rigidbody = nullptr;
+
+        bool collidable = false;
+        ColliderType type = ColliderType::SPHERE;
+        float radius = 0.0f;
+        Vector3f boxMin;
+        Vector3f boxMax;
+        Vector3f position;
+        Quat4f rotation;
+        Vector3f scale;
+        bool unitScale = true;
+        Matrix4f world;
+        Matrix4f invWorld;
+        AABB bounds;
+        uint32_t leaf = 0; // 所在叶子节点
+    };
+
+    struct Node
+    {
+        AABB bounds;
+        int32_t left = -1; // -1 为叶子; 右孩子为 left + 1
+        uint32_t first = 0;
+        uint32_t count = 0;
+    };
+
+    void Prepare(GameWorld &world);
+    void Rebuild(const std::vector<GameObject *> &entities);
+    void Refit();
+    void OnMembershipChanged(GameObject *entity, bool added);
+    void Insert(GameObject *entity);
+    void Remove(uint32_t proxyIndex);
+    void RefreshProxy(Proxy &proxy);
+    void BuildNode(uint32_t nodeIndex, uint32_t first, uint32_t count);
+
+    bool RayHitsProxy(const Proxy &proxy, const Vector3f &origin, const Vector3f &direction,
+                      float &outDist, Vector3f &outNormal) const;
+    bool SweepHitsProxy(const Proxy &proxy, const SphereSweep &sweep, const Vector3f &direction,
+                        float &outDist, Vector3f &outNormal) const;
+    bool SphereHitsProxy(const Proxy &proxy, const Vector3f &center, float radius) const;
+
+    // 沿射线遍历, 节点包围盒外扩 inflate; visit(proxy) 返回新的裁剪距离
+    template <typename Visit>
+    void TraverseRay(const Vector3f &origin, const Vector3f &direction, float inflate, float maxDistance, Visit &&visit);
+
+    std::vector<Proxy> m_proxies; // object 为空的是空闲槽位
+    std::vector<uint32_t> m_freeProxies;
+    std::unordered_map<GameObject *, uint32_t> m_proxyOf;
+    std::vector<GameObject *> m_added; // 已加入集合、等待下次查询时插入树中的实体
+    std::vector<uint32_t> m_order;
+    std::vector<Node> m_nodes;
+    std::vector<uint32_t> m_stack;
+
+    bool m_subscribed = false;
+    bool m_stale = true;
+    size_t m_refitsSinceBuild = 0;
+    size_t m_rebuildInterval = 60;
+    Stats m_stats;
+};
@@ -21,9 +21,6 @@ public:
 
     mRay() : origin(0, 0, 0), direction(0, 0, 1) {}
     mRay(const Vector3f &origin, const Vector3f &direction) : origin(origin), direction(direction.Normalized()) {}
+    // 经由 PhysicsSystem 的 BVH 查询; 批量射线请直接使用 PhysicsQuery::RaycastMany
     mRaycastHit Raycast(float maxDistance, GameWorld &world, GameObject *ignoreEntity = nullptr) const;
-
-private:
-    bool IntersectOBB(const TransformComponent &tf, const RigidbodyComponent &rb, float &outDist, Vector3f &outNormal) const;
-    bool IntersectSphere(const TransformComponent &tf, const RigidbodyComponent &rb, float &outDist, Vector3f &outNormal) const;
 };
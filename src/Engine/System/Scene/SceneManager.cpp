@@ -14,6 +14,9 @@ void SceneManager::ParsePhysics(const json &sceneData, GameWorld &gameWorld)
     auto &physicsSystem = gameWorld.GetPhysicsSystem();
     auto &factory = gameWorld.GetPhysicsStageFactory();
     auto stageJson = sceneData["physicsStage"];
+    physicsSystem.ConfigureScheduler(sceneData.value("scheduler", json::object()));
+    physicsSystem.ConfigureIntegrator(sceneData.value("integrator", json::object()));
+    physicsSystem.GetIslandManager().Initialize(sceneData.value("sleep", json::object()));
     physicsSystem.ClearStages();
     for (auto &[stageName, stageConfig] : stageJson.items())
     {
@@ -64,6 +67,22 @@ bool SceneManager::LoadScene(const std::string &scenePath, GameWorld &gameWorld)
     return true;
 }
 
+bool SceneManager::LoadPhysics(const std::string &scenePath, GameWorld &gameWorld)
+{
+    std::ifstream file(scenePath);
+    if (!file.is_open())
+    {
+        std::cerr << "[SceneManager]: Failed to open scene file: " << scenePath << std::endl;
+        return false;
+    }
+    json sceneData = json::parse(file);
+    if (sceneData.contains("physics"))
+    {
+        ParsePhysics(sceneData["physics"], gameWorld);
+    }
+    return true;
+}
+
 void SceneManager::ParseSkybox(const json &sceneData, GameWorld &gameWorld)
 {
     std::string skyboxPath = sceneData["texture"];
@@ -204,6 +223,7 @@ void SceneManager::AddRigidbody(GameObject &gameObject, const json &rigidData)
     rb.drag = rigidData.value("drag", rb.drag);
     rb.angularDrag = rigidData.value("angularDrag", rb.angularDrag);
     rb.elasticity = rigidData.value("elasticity", rb.elasticity);
+    rb.continuousCollision = rigidData.value("continuousCollision", rb.continuousCollision);
 
     if (rigidData.contains("velocity"))
         rb.velocity = JsonParser::ToVector3f(rigidData["velocity"]);
@@ -13,6 +13,8 @@ public:
     ~SceneManager() = default;
 
     bool LoadScene(const std::string &scenePath, GameWorld &gameWorld);
+    // 只读取 physics 段(无窗口世界不加载模型/着色器)
+    bool LoadPhysics(const std::string &scenePath, GameWorld &gameWorld);
 
 private:
     void ParseSkybox(const json &sceneData, GameWorld &gameWorld);
@@ -36,7 +36,11 @@ ScreenManager::ScreenManager(const EngineConfig &config, const std::string audio
     m_activeConfig.fullScreen = IsWindowFullscreen();
 
     // ── Global Network Client ──────────────────────────────────────
+#if defined(PLATFORM_WEB)
     m_networkClient = std::make_shared<NetworkClient>();
+#else
+    m_networkClient = std::make_shared<NetworkClient>(config.networkIOThread);
+#endif
     m_clientIdentity.LoadOrGenerate();
     m_networkClient->SetUUID(m_clientIdentity.GetUUID());
     m_networkClient->SetOnChatMessage(
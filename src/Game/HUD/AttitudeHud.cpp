@@ -12,7 +12,7 @@ GameObject *AttitudeHud::GetLocalPlayer() const
 {
     if (!m_world)
         return nullptr;
-    auto entities = m_world->GetEntitiesWith<NetworkSyncComponent, TransformComponent>();
+    const auto &entities = m_world->GetEntitiesWith<NetworkSyncComponent, TransformComponent>();
     for (auto *obj : entities)
     {
         if (obj->GetComponent<NetworkSyncComponent>().isLocalPlayer)
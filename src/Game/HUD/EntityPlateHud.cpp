@@ -40,7 +40,7 @@ void EntityPlateHud::Draw()
     NetworkClient &netClient = m_world->GetNetworkClient();
     const ClientID localClientID = netClient.GetLocalClientID();
 
-    auto remoteEntities = m_world->GetEntitiesWith<NetworkSyncComponent, TransformComponent>();
+    const auto &remoteEntities = m_world->GetEntitiesWith<NetworkSyncComponent, TransformComponent>();
     for (const auto *obj : remoteEntities)
     {
         if (!obj || !obj->HasComponent<NetworkSyncComponent>() || !obj->HasComponent<TransformComponent>())
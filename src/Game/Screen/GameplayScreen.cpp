@@ -193,6 +193,7 @@ void GameplayScreen::OnExit()
     // Clear network callbacks (sync system is cleaned up above)
     netClient.SetOnPositionBroadcast({});
     netClient.SetOnObjectDespawn({});
+    netClient.SetOnRelevanceExit({});
 
     EnableCursor();
 }
@@ -309,7 +310,69 @@ void GameplayScreen::Draw()
     int total = (int)m_world->GetGameObjects().size();
     int active = (int)m_world->GetActivateGameObjects().size();
     DrawText(TextFormat("Total Entities: %d", total), 10, 50, 20, WHITE);
-    DrawText(TextFormat("Active Entities: %d", active), 10, 80, 20, GREEN);
+    const auto &activeStats = m_world->GetActiveSetStats();
+    DrawText(TextFormat("Active Entities: %d  (SetActive: %d, coalesced: %d)", active,
+                        (int)activeStats.changesQueued, (int)activeStats.changesCoalesced),
+             10, 80, 20, GREEN);
+    if (auto *collision = m_world->GetPhysicsSystem().GetStage<CollisionStage>())
+    {
+        const auto &bp = collision->GetBroadPhaseStats();
+        DrawText(TextFormat("Colliders: %d  Pairs: %d  Contacts: %d",
+                            (int)bp.proxyCount, (int)bp.candidatePairs, (int)collision->GetContactCount()),
+                 10, 110, 20, GREEN);
+    }
+    const auto &tfStats = m_world->GetTransformUpdateStats();
+    DrawText(TextFormat("Transforms: recomputed %d  queued %d",
+                        (int)tfStats.matricesRecomputed, (int)tfStats.dirtyQueued),
+             10, 140, 20, GREEN);
+    const auto &sleepStats = m_world->GetPhysicsSystem().GetSleepStats();
+    DrawText(TextFormat("Bodies: awake %d  sleeping %d  islands %d (grounded %d)",
+                        (int)sleepStats.awakeBodies, (int)sleepStats.sleepingBodies, (int)sleepStats.islands,
+                        (int)sleepStats.groundedIslands),
+             10, 170, 20, GREEN);
+    if (auto *solar = m_world->GetPhysicsSystem().GetStage<SolarStage>())
+    {
+        const auto &ss = solar->GetStats();
+        DrawText(TextFormat("Solar[%s]: bodies %d  interactions %d  %.2f+%.2f ms  err %.4f",
+                            ss.mode == SolarStage::Mode::BarnesHut ? "BH" : "exact", (int)ss.bodies,
+                            (int)ss.interactions, ss.buildMs, ss.forceMs, ss.maxRelativeError),
+                 10, 200, 20, GREEN);
+    }
+    // 视锥剔除: 每个相机视图一行, 阴影通道合计一行
+    int cullRow = 230;
+    int shadowSubmitted = 0, shadowCulled = 0;
+    for (const auto &view : m_world->GetRenderer().GetRenderQueue().GetViewStats())
+    {
+        if (view.shadow)
+        {
+            shadowSubmitted += (int)view.submitted;
+            shadowCulled += (int)view.culled;
+            continue;
+        }
+        DrawText(TextFormat("View %s: drawn %d  culled %d", view.name.c_str(), (int)view.submitted, (int)view.culled),
+                 10, cullRow, 20, GREEN);
+        cullRow += 30;
+    }
+    DrawText(TextFormat("Shadow casters: drawn %d  culled %d", shadowSubmitted, shadowCulled), 10, cullRow, 20, GREEN);
+    const auto &drawStats = m_world->GetRenderer().GetDrawStats();
+    DrawText(TextFormat("Draws: %d (instanced %d / %d objs)  shaders %d  states %d  uniforms: frame %d  material %d",
+                        (int)drawStats.drawCalls, (int)drawStats.instancedDraws, (int)drawStats.instances,
+                        (int)drawStats.shaderBinds, (int)drawStats.stateChanges,
+                        (int)drawStats.frameUploads, (int)drawStats.materialUploads),
+             10, cullRow + 30, 20, GREEN);
+    const auto &uniformStats = ShaderWrapper::GetUniformStats();
+    DrawText(TextFormat("Uniform sets: uploaded %d  skipped (unchanged) %d",
+                        (int)uniformStats.uploads, (int)uniformStats.skipped),
+             10, cullRow + 60, 20, GREEN);
+    const auto &lighting = m_world->GetRenderer().GetLightingManager();
+    if (lighting.IsClusteredLighting())
+    {
+        const auto &clusters = lighting.GetClusterStats();
+        DrawText(TextFormat("Clustered lights: %d (visible %d)  clusters %d/%d  indices %d  max/cluster %d  dropped %d",
+                            (int)clusters.lights, (int)clusters.visibleLights, (int)clusters.occupiedClusters, CLUSTER_COUNT,
+                            (int)clusters.indices, (int)clusters.maxPerCluster, (int)clusters.dropped),
+                 10, cullRow + 90, 20, GREEN);
+    }
 
     if (m_hudManager)
     {
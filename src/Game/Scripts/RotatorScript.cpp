@@ -22,6 +22,6 @@ void RotatorScript::OnFixedUpdate(float fixedDeltaTime)
     Vector3f pos = tf.GetWorldPosition();
 
     rot = (rot * Quat4f(m_angluarVelocity * fixedDeltaTime));
-    tf.SetWorldMatrix(Matrix4f::CreateTransform(pos, rot, scale));
+    tf.SetWorldTRS(pos, rot, scale);
 }
 void RotatorScript::OnDestroy() {}
\ No newline at end of file
@@ -102,36 +102,33 @@ void MineScript::OnFixedUpdate(float dt)
     if (!m_isArmed)
         return;
 
+    auto &world = *owner->GetOwnerWorld();
     Vector3f minePos = owner->GetComponent<TransformComponent>().GetWorldPosition();
-    for (auto *gameObject : owner->GetOwnerWorld()->GetActivateGameObjects())
-    {
-        if (gameObject->GetTag() == "mine")
-            continue;
-        Vector3f pos = gameObject->GetComponent<TransformComponent>().GetWorldPosition();
-        if ((pos - minePos).Length() < m_detectionRadius)
-        {
-            Explode(gameObject);
-        }
-    }
+    static const TagMask notMine = ~TagRegistry::Mask("mine");
+    if (world.QueryRadius(minePos, m_detectionRadius, notMine, m_targets, owner) > 0)
+        Explode(m_targets);
 }
 
-void MineScript::Explode(GameObject *target)
+void MineScript::Explode(const std::vector<GameObject *> &targets)
 {
     auto &world = *owner->GetOwnerWorld();
     Vector3f pos = owner->GetComponent<TransformComponent>().GetWorldPosition();
-    world.GetEventManager().Emit(DamageEvent(target, m_explosionDamage, pos));
+    for (auto *target : targets)
+    {
+        world.GetEventManager().Emit(DamageEvent(target, m_explosionDamage, pos));
+
+        Vector3f targetPos = target->GetComponent<TransformComponent>().GetWorldPosition();
+        Vector3f force = (targetPos - pos).Normalized() * m_expForce;
+        if (target->HasComponent<RigidbodyComponent>())
+        {
+            auto &rb = target->GetComponent<RigidbodyComponent>();
+            rb.AddForce(force * rb.mass);
+        }
+    }
 
     world.GetParticleSystem().Spawn("Explosion", pos);
     // world.GetAudioManager().PlaySpatial("Explosion_Large", pos);
 
-    Vector3f targetPos = target->GetComponent<TransformComponent>().GetWorldPosition();
-    Vector3f force = (targetPos - pos).Normalized() * m_expForce;
-    if (target->HasComponent<RigidbodyComponent>())
-    {
-        auto &rb = target->GetComponent<RigidbodyComponent>();
-        rb.AddForce(force * rb.mass);
-    }
-
     world.GetPool("mine").Recycle(owner);
 }
 
@@ -43,7 +43,8 @@ public:
     void OnFixedUpdate(float fixedDeltaTime) override;
 
 private:
-    void Explode(GameObject *target);
+    // 对半径内所有目标结算伤害与冲击, 然后回收地雷
+    void Explode(const std::vector<GameObject *> &targets);
 
     float m_timer = 0.0f;
     float m_delay = 1.5f;
@@ -51,6 +52,8 @@ private:
     float m_detectionRadius = 10.0f;
     bool m_isArmed = false;
     float m_expForce = 100.0f;
+    // 复用的查询结果缓冲
+    std::vector<GameObject *> m_targets;
 };
 
 class WeaponScript : public IScriptableComponent
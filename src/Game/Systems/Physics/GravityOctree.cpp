@@ -0,0 +1,174 @@
+#include "GravityOctree.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+void GravityOctree::Build(const std::vector<Vector3f> &positions, const std::vector<float> &masses)
+{
+    m_positions = &positions;
+    m_masses = &masses;
+    m_nodes.clear();
+    size_t count = positions.size();
+    m_order.resize(count);
+    m_scratch.resize(count);
+    if (count == 0)
+        return;
+    for (uint32_t i = 0; i < count; i++)
+        m_order[i] = i;
+
+    Vector3f lo = positions[0];
+    Vector3f hi = positions[0];
+    for (const auto &p : positions)
+    {
+        for (int axis = 0; axis < 3; axis++)
+        {
+            lo[axis] = std::min(lo[axis], p[axis]);
+            hi[axis] = std::max(hi[axis], p[axis]);
+        }
+    }
+    Vector3f extent = hi - lo;
+    float halfSize = std::max(extent.x(), std::max(extent.y(), extent.z())) * 0.5f;
+
+    Node root;
+    root.center = (lo + hi) * 0.5f;
+    root.halfSize = halfSize * 1.001f + 1e-3f;
+    root.begin = 0;
+    root.end = static_cast<uint32_t>(count);
+    m_nodes.push_back(root);
+    BuildNode(0, 0);
+}
+
+void GravityOctree::BuildNode(uint32_t nodeIndex, int depth)
+{
+    const auto &positions = *m_positions;
+    const auto &masses = *m_masses;
+    uint32_t begin = m_nodes[nodeIndex].begin;
+    uint32_t end = m_nodes[nodeIndex].end;
+
+    if (end - begin <= LEAF_SIZE || depth >= MAX_DEPTH)
+    {
+        Vector3f weighted = Vector3f::ZERO;
+        float mass = 0.0f;
+        for (uint32_t k = begin; k < end; k++)
+        {
+            uint32_t body = m_order[k];
+            weighted += positions[body] * masses[body];
+            mass += masses[body];
+        }
+        Node &node = m_nodes[nodeIndex];
+        node.mass = mass;
+        node.centerOfMass = mass > 0.0f ? weighted / mass : node.center;
+        return;
+    }
+
+    // 按卦限计数排序, 子节点的刚体在 m_order 中连续
+    Vector3f center = m_nodes[nodeIndex].center;
+    auto octantOf = [&](uint32_t body)
+    {
+        const Vector3f &p = positions[body];
+        return (p.x() >= center.x() ? 1 : 0) | (p.y() >= center.y() ? 2 : 0) | (p.z() >= center.z() ? 4 : 0);
+    };
+    std::array<uint32_t, 9> offsets = {};
+    for (uint32_t k = begin; k < end; k++)
+        offsets[octantOf(m_order[k]) + 1]++;
+    for (int i = 0; i < 8; i++)
+        offsets[i + 1] += offsets[i];
+    std::array<uint32_t, 8> cursor;
+    for (int i = 0; i < 8; i++)
+        cursor[i] = begin + offsets[i];
+    for (uint32_t k = begin; k < end; k++)
+    {
+        uint32_t body = m_order[k];
+        m_scratch[cursor[octantOf(body)]++] = body;
+    }
+    std::copy(m_scratch.begin() + begin, m_scratch.begin() + end, m_order.begin() + begin);
+
+    int32_t firstChild = static_cast<int32_t>(m_nodes.size());
+    float childHalf = m_nodes[nodeIndex].halfSize * 0.5f;
+    m_nodes[nodeIndex].firstChild = firstChild;
+    m_nodes.resize(m_nodes.size() + 8);
+    for (int i = 0; i < 8; i++)
+    {
+        Node &child = m_nodes[firstChild + i];
+        child.center = center + Vector3f((i & 1) ? childHalf : -childHalf,
+                                         (i & 2) ? childHalf : -childHalf,
+                                         (i & 4) ? childHalf : -childHalf);
+        child.halfSize = childHalf;
+        child.begin = begin + offsets[i];
+        child.end = begin + offsets[i + 1];
+    }
+
+    Vector3f weighted = Vector3f::ZERO;
+    float mass = 0.0f;
+    for (int i = 0; i < 8; i++)
+    {
+        // m_nodes 可能在递归中扩容, 只能按下标访问
+        if (m_nodes[firstChild + i].begin == m_nodes[firstChild + i].end)
+            continue;
+        BuildNode(static_cast<uint32_t>(firstChild + i), depth + 1);
+        const Node &child = m_nodes[firstChild + i];
+        weighted += child.centerOfMass * child.mass;
+        mass += child.mass;
+    }
+    Node &node = m_nodes[nodeIndex];
+    node.mass = mass;
+    node.centerOfMass = mass > 0.0f ? weighted / mass : node.center;
+}
+
+bool GravityOctree::Contains(const Node &node, const Vector3f &position)
+{
+    const Vector3f offset = position - node.center;
+    return std::abs(offset.x()) <= node.halfSize && std::abs(offset.y()) <= node.halfSize &&
+           std::abs(offset.z()) <= node.halfSize;
+}
+
+Vector3f GravityOctree::ComputeForce(size_t body, float G, float theta, size_t &interactions) const
+{
+    Vector3f force = Vector3f::ZERO;
+    if (m_nodes.empty())
+        return force;
+    const auto &positions = *m_positions;
+    const auto &masses = *m_masses;
+    const Vector3f &position = positions[body];
+    const float mass = masses[body];
+
+    // 每层最多压入 8 个子节点
+    std::array<uint32_t, 8 * (MAX_DEPTH + 1)> stack;
+    size_t top = 0;
+    stack[top++] = 0;
+    while (top > 0)
+    {
+        const Node &node = m_nodes[stack[--top]];
+        if (node.mass <= 0.0f)
+            continue;
+        if (node.firstChild < 0)
+        {
+            for (uint32_t k = node.begin; k < node.end; k++)
+            {
+                uint32_t other = m_order[k];
+                if (other == body)
+                    continue;
+                auto distance = Vector3f::Distance(position, positions[other]);
+                if (distance <= 1e-5f)
+                    continue;
+                auto f = G * mass * masses[other] / (distance * distance);
+                force += (positions[other] - position).Normalized() * f;
+                interactions++;
+            }
+            continue;
+        }
+        auto distance = Vector3f::Distance(position, node.centerOfMass);
+        // 质心可能偏在节点一角, theta > 1/sqrt(3) 时开角判断本身挡不住包含该刚体的节点,
+        // 近似前再排除它们, 以免把自身质量并入合力
+        if (distance > 1e-5f && node.halfSize * 2.0f < theta * distance && !Contains(node, position))
+        {
+            auto f = G * mass * node.mass / (distance * distance);
+            force += (node.centerOfMass - position).Normalized() * f;
+            interactions++;
+            continue;
+        }
+        for (int i = 0; i < 8; i++)
+            stack[top++] = static_cast<uint32_t>(node.firstChild + i);
+    }
+    return force;
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include "Engine/Math/Math.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Barnes-Hut 八叉树: 每个节点记录总质量与质心
+// 远处节点(边长 / 距离 < theta)整体当作一个质点, 单个刚体的受力为 O(log n)
+// 包含该刚体的节点总是展开, 因此任何 theta 下自身质量都不会计入合力
+class GravityOctree
+{
+public:
+    // 建树后 positions/masses 必须保持有效直到下一次 Build
+    void Build(const std::vector<Vector3f> &positions, const std::vector<float> &masses);
+    // 第 body 个刚体受到的合力; interactions 累加本次参与计算的质点/节点数
+    // 只读, 可在多个线程上同时调用
+    Vector3f ComputeForce(size_t body, float G, float theta, size_t &interactions) const;
+
+    size_t GetNodeCount() const { return m_nodes.size(); }
+
+private:
+    static constexpr uint32_t LEAF_SIZE = 4;
+    static constexpr int MAX_DEPTH = 24;
+
+    struct Node
+    {
+        Vector3f center;
+        float halfSize = 0.0f;
+        Vector3f centerOfMass;
+        float mass = 0.0f;
+        int32_t firstChild = -1; // 8 个子节点连续存放, -1 为叶子
+        uint32_t begin = 0;      // 叶子覆盖 m_order[begin, end)
+        uint32_t end = 0;
+    };
+
+    void BuildNode(uint32_t nodeIndex, int depth);
+    // 含边界: 落在卦限分界面上的刚体对两侧节点都算包含
+    static bool Contains(const Node &node, const Vector3f &position);
+
+    const std::vector<Vector3f> *m_positions = nullptr;
+    const std::vector<float> *m_masses = nullptr;
+    std::vector<Node> m_nodes;
+    std::vector<uint32_t> m_order;
+    std::vector<uint32_t> m_scratch;
+};
@@ -9,4 +9,6 @@ public:
 
     void Execute(GameWorld &world, float fixedDeltaTime) override;
     void Initialize(const json &config) override;
+    // 空阶段, 不读写物理数据
+    StageAccess GetAccess() const override { return {PHYSICS_DATA_NONE, PHYSICS_DATA_NONE}; }
 };
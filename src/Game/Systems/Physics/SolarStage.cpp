@@ -6,44 +6,166 @@
 
 #include "SolarStage.h"
 #include "Engine/Engine.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <iostream>
+
+namespace
+{
+    float ElapsedMs(std::chrono::steady_clock::time_point since)
+    {
+        return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - since).count();
+    }
+}
+
 void SolarStage::Initialize(const json &config)
 {
     m_G = config.value("G", 0.1);
+    m_mode = config.value("mode", std::string("exact")) == "barnesHut" ? Mode::BarnesHut : Mode::Exact;
+    m_theta = config.value("theta", 0.5f);
+    m_parallel = config.value("parallel", true);
+    m_grain = config.value("grain", 32);
+    m_accuracySamples = config.value("accuracySamples", 0);
+}
+
+Vector3f SolarStage::ExactForce(size_t body, size_t &interactions) const
+{
+    Vector3f force = Vector3f::ZERO;
+    const Vector3f &position = m_positions[body];
+    for (size_t j = 0; j < m_bodies.size(); j++)
+    {
+        if (body == j)
+            continue;
+        auto distance = Vector3f::Distance(position, m_positions[j]);
+        if (distance <= 1e-5f)
+            continue;
+
+        auto f = m_G * m_masses[body] * m_masses[j] / (distance * distance);
+        force += (m_positions[j] - position).Normalized() * f;
+        interactions++;
+    }
+    return force;
+}
+
+void SolarStage::ComputeExactSymmetric()
+{
+    // 牛顿第三定律: 每对只算一次, 同时作用于双方
+    size_t count = m_bodies.size();
+    for (size_t i = 0; i < count; i++)
+    {
+        for (size_t j = i + 1; j < count; j++)
+        {
+            auto distance = Vector3f::Distance(m_positions[i], m_positions[j]);
+            if (distance <= 1e-5f)
+                continue;
+            auto f = m_G * m_masses[i] * m_masses[j] / (distance * distance);
+            auto F = (m_positions[j] - m_positions[i]).Normalized() * f;
+            m_forces[i] += F;
+            m_forces[j] -= F;
+        }
+    }
+    m_stats.interactions = count * (count - 1) / 2;
+}
+
+void SolarStage::MeasureAccuracy()
+{
+    m_stats.maxRelativeError = 0.0f;
+    size_t samples = std::min(m_accuracySamples, m_bodies.size());
+    for (size_t s = 0; s < samples; s++)
+    {
+        size_t body = s * m_bodies.size() / samples;
+        size_t unused = 0;
+        Vector3f exact = ExactForce(body, unused);
+        float exactLength = exact.Length();
+        if (exactLength <= 1e-12f)
+            continue;
+        float error = (m_forces[body] - exact).Length() / exactLength;
+        m_stats.maxRelativeError = std::max(m_stats.maxRelativeError, error);
+    }
+}
+
+void SolarStage::BeginStep(GameWorld &world)
+{
+    m_bodies.clear();
+    m_positions.clear();
+    m_masses.clear();
+    m_forces.clear();
+    for (auto &gameObject : world.GetActivateGameObjects())
+    {
+        if (gameObject->HasComponent<RigidbodyComponent>() && gameObject->HasComponent<TransformComponent>())
+        {
+            auto &rb = gameObject->GetComponent<RigidbodyComponent>();
+            m_bodies.push_back(&rb);
+            m_positions.push_back(gameObject->GetComponent<TransformComponent>().GetWorldPosition());
+            m_masses.push_back(rb.mass);
+        }
+    }
 }
+
 void SolarStage::Execute(GameWorld &world, float fixedDeltaTime)
 {
-    auto &gameObjects = world.GetActivateGameObjects();
-    if (gameObjects.empty())
+    if (m_bodies.empty())
     {
         std::cout << "[SloarStage]:Empty Game World" << std::endl;
         return;
     }
-    for (auto &gameObject : gameObjects)
+    m_forces.assign(m_bodies.size(), Vector3f::ZERO);
+
+    m_stats = Stats();
+    m_stats.mode = m_mode;
+    m_stats.bodies = m_bodies.size();
+
+    auto start = std::chrono::steady_clock::now();
+    if (m_mode == Mode::BarnesHut)
     {
-        if (gameObject->HasComponent<RigidbodyComponent>() && gameObject->HasComponent<TransformComponent>())
+        m_octree.Build(m_positions, m_masses);
+        m_stats.treeNodes = m_octree.GetNodeCount();
+        m_stats.buildMs = ElapsedMs(start);
+        start = std::chrono::steady_clock::now();
+    }
+
+    if (m_mode == Mode::Exact && !m_parallel)
+    {
+        ComputeExactSymmetric();
+    }
+    else
+    {
+        // 每个刚体独立求合力, 只写自己的槽位, 可以安全并行
+        // 单个刚体的求和顺序与分块方式无关, 但与 ComputeExactSymmetric 不同, 两者只在浮点误差内一致
+        std::atomic<size_t> interactions{0};
+        auto accumulate = [&](size_t begin, size_t end)
         {
-            auto &rb = gameObject->GetComponent<RigidbodyComponent>();
-            auto &transform = gameObject->GetComponent<TransformComponent>();
-            for (auto &otherGameObject : gameObjects)
+            size_t local = 0;
+            for (size_t i = begin; i < end; i++)
             {
-                if (gameObject == otherGameObject)
-                    continue;
-                if (!otherGameObject->HasComponent<RigidbodyComponent>() ||
-                    !otherGameObject->HasComponent<TransformComponent>())
-                    continue;
-
-                auto &otherRb = otherGameObject->GetComponent<RigidbodyComponent>();
-                auto &otherTransform = otherGameObject->GetComponent<TransformComponent>();
-
-                auto distance = Vector3f::Distance(transform.GetWorldPosition(), otherTransform.GetWorldPosition());
-                if (distance <= 1e-5f)
-                    continue;
-
-                auto f = m_G * rb.mass * otherRb.mass / (distance * distance);
-                auto F = (otherTransform.GetWorldPosition() - transform.GetWorldPosition()).Normalized() * f;
-                rb.AddForce(F);
+                m_forces[i] = m_mode == Mode::BarnesHut ? m_octree.ComputeForce(i, m_G, m_theta, local)
+                                                        : ExactForce(i, local);
             }
-        }
+            interactions.fetch_add(local);
+        };
+        if (m_parallel)
+            world.GetJobSystem().ParallelFor(m_bodies.size(), m_grain, accumulate);
+        else
+            accumulate(0, m_bodies.size());
+        m_stats.interactions = interactions.load();
+    }
+    m_stats.forceMs = ElapsedMs(start);
+
+    if (m_accuracySamples > 0)
+        MeasureAccuracy();
+}
+
+void SolarStage::Commit(GameWorld &)
+{
+    // 休眠刚体仍作为引力源; 它受的引力只记入合力而不经 AddForce 唤醒,
+    // 由 IslandManager 按全岛净加速度决定是否唤醒 (相互吸引而静止接触的刚体保持休眠)
+    // 不按 Vector3f::ZERO 跳过: operator== 带 1e-5 的绝对容差, 会丢掉轻刚体在弱场中的全部引力
+    for (size_t i = 0; i < m_forces.size(); i++)
+    {
+        if (m_bodies[i]->isSleeping)
+            m_bodies[i]->accumulatedForces += m_forces[i];
+        else
+            m_bodies[i]->AddForce(m_forces[i]);
     }
 }
@@ -1,17 +1,74 @@
 #pragma once
 #include "Engine/System/Physics/IPhysicsStage.h"
 #include "Engine/System/Input/InputManager.h"
+#include "Engine/Math/Math.h"
+#include "GravityOctree.h"
 #include "raylib.h"
+#include <string>
+#include <vector>
 class GameWorld;
+struct RigidbodyComponent;
 class SolarStage : public IPhysicsStage
 {
 public:
+    enum class Mode
+    {
+        Exact,     // 逐对精确计算
+        BarnesHut, // 八叉树近似
+    };
+
+    struct Stats
+    {
+        Mode mode = Mode::Exact;
+        size_t bodies = 0;
+        size_t interactions = 0; // 参与计算的质点/节点次数
+        size_t treeNodes = 0;
+        float buildMs = 0.0f;
+        float forceMs = 0.0f;
+        // accuracySamples > 0 时, 抽样刚体相对精确解的最大相对误差
+        float maxRelativeError = 0.0f;
+    };
+
     SolarStage() = default;
 
+    // 在步初快照位置与质量: 引力按本步碰撞/地面修正之前的位置计算
+    void BeginStep(GameWorld &world) override;
     void Execute(GameWorld &world, float fixedDeltaTime) override;
+    // 把算好的合力写入各刚体的力累加器
+    void Commit(GameWorld &world) override;
 
+    // {"G", "mode": "exact" | "barnesHut", "theta", "parallel", "grain", "accuracySamples"}
     void Initialize(const json &config) override;
+    // Execute 只读自己的快照, 力在 Commit 中写入, 可与任何不读写力的阶段同批
+    StageAccess GetAccess() const override
+    {
+        return {PHYSICS_DATA_NONE, PHYSICS_DATA_NONE, PHYSICS_DATA_FORCE};
+    }
+
+    const Stats &GetStats() const { return m_stats; }
 
 private:
+    Vector3f ExactForce(size_t body, size_t &interactions) const;
+    void ComputeExactSymmetric();
+    void MeasureAccuracy();
+
     float m_G = 0.1f;
-};
\ No newline at end of file
+    Mode m_mode = Mode::Exact;
+    // Barnes-Hut 张角, 越小越精确
+    float m_theta = 0.5f;
+    // 逐刚体循环切块到 JobSystem
+    // 精确模式下并行与串行 (ComputeExactSymmetric, 逐对累加) 求和顺序不同,
+    // 合力只在浮点误差范围内一致, 不保证逐位相同
+    bool m_parallel = true;
+    size_t m_grain = 32;
+    size_t m_accuracySamples = 0;
+
+    // BeginStep 收集的世界坐标, 工作线程不再访问 TransformComponent 的惰性缓存
+    std::vector<RigidbodyComponent *> m_bodies;
+    std::vector<Vector3f> m_positions;
+    std::vector<float> m_masses;
+    std::vector<Vector3f> m_forces;
+    GravityOctree m_octree;
+
+    Stats m_stats;
+};
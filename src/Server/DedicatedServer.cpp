@@ -0,0 +1,603 @@
+#include "DedicatedServer.h"
+#include "Engine/Core/GameWorld.h"
+#include "Engine/System/Physics/Physics.h"
+#include "Game/Systems/Physics/SolarStage.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <thread>
+
+namespace
+{
+    constexpr size_t MAX_NICKNAME_LENGTH = 24;
+    /// Objects enter the relevance set at the far radius and leave at far × this,
+    /// so one hovering at the boundary does not flap in and out.
+    constexpr float INTEREST_EXIT_SCALE = 1.1f;
+
+    uint64_t ObjectKey(ClientID ownerID, NetObjectID objectID)
+    {
+        return (static_cast<uint64_t>(ownerID) << 32) | static_cast<uint64_t>(objectID);
+    }
+
+    NetBroadcastEntry MakeBroadcastEntry(GameObject &obj, ClientID ownerID, NetObjectID objectID)
+    {
+        auto &tf = obj.GetComponent<TransformComponent>();
+        auto &rb = obj.GetComponent<RigidbodyComponent>();
+        Vector3f pos = tf.GetWorldPosition();
+        Quat4f rot = tf.GetWorldRotation();
+
+        NetBroadcastEntry e;
+        e.clientID = ownerID;
+        e.objectID = objectID;
+        e.transform.posX = pos.x();
+        e.transform.posY = pos.y();
+        e.transform.posZ = pos.z();
+        e.transform.rotW = rot[0];
+        e.transform.rotX = rot[1];
+        e.transform.rotY = rot[2];
+        e.transform.rotZ = rot[3];
+        e.transform.linVelX = rb.velocity.x();
+        e.transform.linVelY = rb.velocity.y();
+        e.transform.linVelZ = rb.velocity.z();
+        e.transform.angVelX = rb.angularVelocity.x();
+        e.transform.angVelY = rb.angularVelocity.y();
+        e.transform.angVelZ = rb.angularVelocity.z();
+        return e;
+    }
+
+    double ElapsedMs(std::chrono::steady_clock::time_point since)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - since).count();
+    }
+}
+
+// ────────────────────────────────────────────────────────────────────
+DedicatedServer::DedicatedServer(const ServerConfig &config)
+    : m_config(config),
+      m_interestGrid(std::max(config.interestNearRadius, 16.0f))
+{
+    // Only logic stages are registered: no scripts or particles run server-side.
+    m_world = std::make_unique<GameWorld>(
+        HeadlessWorld{},
+        [](ScriptingFactory &, PhysicsStageFactory &physicsStageFactory, ParticleFactory &)
+        {
+            physicsStageFactory.Register("SolarStage", []()
+                                         { return std::make_unique<SolarStage>(); });
+            physicsStageFactory.Register("CollisionStage", []()
+                                         { return std::make_unique<CollisionStage>(); });
+            physicsStageFactory.Register("GravityStage", []()
+                                         { return std::make_unique<GravityStage>(); });
+        },
+        m_config.scenePath);
+
+    m_transport.SetOnPeerConnect([this](PeerID peer)
+                                 { OnPeerConnect(peer); });
+    m_transport.SetOnPeerDisconnect([this](PeerID peer)
+                                    { OnPeerDisconnect(peer); });
+    m_transport.SetOnPeerReceive([this](PeerID peer, const uint8_t *data, size_t len, uint8_t /*ch*/)
+                                 { OnPeerReceive(peer, data, len); });
+}
+
+DedicatedServer::~DedicatedServer()
+{
+    m_transport.Stop();
+}
+
+// ── Lifecycle ──────────────────────────────────────────────────────
+bool DedicatedServer::Start()
+{
+    return m_transport.Start(m_config.port);
+}
+
+void DedicatedServer::Run()
+{
+    using Clock = std::chrono::steady_clock;
+    const float tickRate = m_config.tickRate > 0.0f ? m_config.tickRate : 60.0f;
+    const float fixedDeltaTime = 1.0f / tickRate;
+    const auto tickDuration = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(fixedDeltaTime));
+
+    std::cout << "[DedicatedServer] Running at " << tickRate << " Hz ("
+              << (m_config.deltaSnapshots ? "PositionSnapshot" : "PositionBroadcast") << ")\n";
+
+    auto nextTick = Clock::now();
+    while (!m_stopRequested)
+    {
+        Tick(fixedDeltaTime);
+
+        m_statsTimer += fixedDeltaTime;
+        if (m_config.statsInterval > 0.0f && m_statsTimer >= m_config.statsInterval)
+        {
+            m_statsTimer = 0.0;
+            PrintStats();
+        }
+
+        nextTick += tickDuration;
+        auto now = Clock::now();
+        if (nextTick > now)
+            std::this_thread::sleep_until(nextTick);
+        else if (now - nextTick > tickDuration * 8)
+            nextTick = now; // fell far behind: drop ticks instead of spiralling
+    }
+    std::cout << "[DedicatedServer] Stopping\n";
+}
+
+void DedicatedServer::Tick(float fixedDeltaTime)
+{
+    m_transport.Poll();
+
+    auto start = std::chrono::steady_clock::now();
+    m_world->FixedUpdate(fixedDeltaTime);
+    m_stats.simulateMs = ElapsedMs(start);
+
+    m_serverTick++;
+    start = std::chrono::steady_clock::now();
+    BroadcastState(m_serverTick);
+    m_transport.FlushSend();
+    m_stats.broadcastMs = ElapsedMs(start);
+
+    m_stats.ticks++;
+    m_stats.clients = m_clients.size();
+}
+
+// ── Transport events ───────────────────────────────────────────────
+void DedicatedServer::OnPeerConnect(PeerID peer)
+{
+    RemoteClient &client = m_clients[peer];
+    client.peer = peer;
+    std::cout << "[DedicatedServer] Peer " << peer << " connected\n";
+}
+
+void DedicatedServer::OnPeerDisconnect(PeerID peer)
+{
+    std::cout << "[DedicatedServer] Peer " << peer << " disconnected\n";
+    RemoveClient(peer);
+}
+
+void DedicatedServer::OnPeerReceive(PeerID peer, const uint8_t *data, size_t len)
+{
+    if (len < sizeof(NetPacketHeader))
+        return;
+    auto it = m_clients.find(peer);
+    if (it == m_clients.end())
+        return;
+    RemoteClient &client = it->second;
+
+    m_stats.packetsIn++;
+    m_stats.bytesIn += len;
+
+    NetMessageType type = PacketSerializer::PeekType(data, len);
+    // Everything except Hello requires an assigned ClientID.
+    if (!client.welcomed && type != NetMessageType::ClientHello)
+        return;
+
+    switch (type)
+    {
+    case NetMessageType::ClientHello:
+        HandleHello(client, data, len);
+        break;
+    case NetMessageType::ClientDisconnect:
+        RemoveClient(peer);
+        break;
+    case NetMessageType::Heartbeat:
+        break;
+    case NetMessageType::PositionUpdate:
+        HandlePositionUpdate(client, data, len);
+        break;
+    case NetMessageType::ObjectRelease:
+        HandleObjectRelease(client, data, len);
+        break;
+    case NetMessageType::SnapshotAck:
+    {
+        if (len < sizeof(MsgSnapshotAck))
+            break;
+        auto msg = PacketSerializer::Read<MsgSnapshotAck>(data, len);
+        client.encoder.OnAck(msg.ackTick);
+        break;
+    }
+    case NetMessageType::ChatRequest:
+        HandleChatRequest(client, data, len);
+        break;
+    case NetMessageType::NicknameUpdateRequest:
+        HandleNicknameUpdate(client, data, len);
+        break;
+    default:
+        std::cerr << "[DedicatedServer] Unknown message type: "
+                  << static_cast<int>(type) << "\n";
+        break;
+    }
+}
+
+// ── Message handlers ───────────────────────────────────────────────
+void DedicatedServer::HandleHello(RemoteClient &client, const uint8_t *data, size_t len)
+{
+    if (len < sizeof(MsgClientHello) || client.welcomed)
+        return;
+    auto msg = PacketSerializer::Read<MsgClientHello>(data, len);
+    client.uuid = msg.uuid;
+
+    ClientID assigned = INVALID_CLIENT_ID;
+    if (!msg.uuid.IsNull())
+    {
+        auto known = m_knownUUIDs.find(msg.uuid);
+        if (known != m_knownUUIDs.end())
+        {
+            // Reuse only if the previous session with this UUID is gone.
+            bool inUse = false;
+            for (const auto &[peer, other] : m_clients)
+                inUse |= (&other != &client && other.clientID == known->second);
+            if (!inUse)
+                assigned = known->second;
+        }
+    }
+    if (assigned == INVALID_CLIENT_ID)
+    {
+        assigned = m_nextClientID++;
+        if (!msg.uuid.IsNull())
+            m_knownUUIDs[msg.uuid] = assigned;
+    }
+    client.clientID = assigned;
+    client.welcomed = true;
+
+    SendTo(client, PacketSerializer::WriteServerWelcome(assigned), 0);
+
+    std::vector<PacketSerializer::PlayerMetaEntryData> meta;
+    for (const auto &[peer, other] : m_clients)
+    {
+        if (other.welcomed && !other.nickname.empty())
+            meta.push_back({other.clientID, other.nickname});
+    }
+    SendTo(client, PacketSerializer::WritePlayerMetaSnapshot(meta), 0);
+
+    std::cout << "[DedicatedServer] Peer " << client.peer << " → ClientID " << assigned << "\n";
+}
+
+void DedicatedServer::HandlePositionUpdate(RemoteClient &client, const uint8_t *data, size_t len)
+{
+    if (len < sizeof(MsgPositionUpdate))
+        return;
+    auto msg = PacketSerializer::Read<MsgPositionUpdate>(data, len);
+    // A client may only drive its own objects.
+    if (msg.clientID != client.clientID || msg.objectID == INVALID_NET_OBJECT_ID)
+        return;
+
+    GameObject *obj = nullptr;
+    auto it = client.objects.find(msg.objectID);
+    if (it != client.objects.end())
+        obj = it->second;
+    else
+        obj = &SpawnObject(client, msg.objectID);
+
+    const NetTransformState &ts = msg.transform;
+    Quat4f rotation(ts.rotW, ts.rotX, ts.rotY, ts.rotZ);
+    auto &tf = obj->GetComponent<TransformComponent>();
+    tf.SetLocalPosition(Vector3f(ts.posX, ts.posY, ts.posZ));
+    tf.SetLocalRotation(rotation);
+
+    auto &rb = obj->GetComponent<RigidbodyComponent>();
+    rb.velocity = Vector3f(ts.linVelX, ts.linVelY, ts.linVelZ);
+    rb.SetAnglularVelocity(Vector3f(ts.angVelX, ts.angVelY, ts.angVelZ), rotation);
+    rb.WakeUp();
+}
+
+void DedicatedServer::HandleObjectRelease(RemoteClient &client, const uint8_t *data, size_t len)
+{
+    if (len < sizeof(MsgObjectRelease))
+        return;
+    auto msg = PacketSerializer::Read<MsgObjectRelease>(data, len);
+    if (msg.clientID != client.clientID)
+        return;
+    DespawnObject(client, msg.objectID);
+}
+
+void DedicatedServer::HandleChatRequest(RemoteClient &client, const uint8_t *data, size_t len)
+{
+    if (len < sizeof(MsgChatRequest))
+        return;
+    auto chat = PacketSerializer::ReadChatRequest(data, len);
+    if (chat.text.empty())
+        return;
+
+    std::string senderName =
+        client.nickname.empty() ? "Player" + std::to_string(client.clientID) : client.nickname;
+    auto pkt = PacketSerializer::WriteChatBroadcast(chat.chatType, client.clientID, senderName, chat.text);
+
+    if (chat.chatType != ChatMessageType::Whisper)
+    {
+        SendToAll(pkt, 0);
+        return;
+    }
+    // Whisper: target and sender (echo) only.
+    for (auto &[peer, other] : m_clients)
+    {
+        if (other.clientID == chat.targetClientID || &other == &client)
+            SendTo(other, pkt, 0);
+    }
+}
+
+void DedicatedServer::HandleNicknameUpdate(RemoteClient &client, const uint8_t *data, size_t len)
+{
+    if (len < sizeof(MsgNicknameUpdateRequest))
+        return;
+    auto request = PacketSerializer::ReadNicknameUpdateRequest(data, len);
+
+    NicknameUpdateStatus status = NicknameUpdateStatus::Accepted;
+    if (request.nickname.empty() || request.nickname.size() > MAX_NICKNAME_LENGTH)
+        status = NicknameUpdateStatus::Invalid;
+    else if (IsNicknameTaken(request.nickname, client.clientID))
+        status = NicknameUpdateStatus::Conflict;
+
+    if (status == NicknameUpdateStatus::Accepted)
+        client.nickname = request.nickname;
+
+    SendTo(client, PacketSerializer::WriteNicknameUpdateResult(status, client.nickname), 0);
+    if (status == NicknameUpdateStatus::Accepted)
+        SendToAll(PacketSerializer::WritePlayerMetaUpsert(client.clientID, client.nickname), 0);
+}
+
+// ── Helpers ────────────────────────────────────────────────────────
+GameObject &DedicatedServer::SpawnObject(RemoteClient &client, NetObjectID objectID)
+{
+    GameObject &obj = m_world->CreateGameObject();
+    obj.SetName("remote_plane_" + std::to_string(client.clientID) + "_" + std::to_string(objectID));
+    obj.SetTag("RemotePlayer");
+
+    auto &tf = obj.AddComponent<TransformComponent>();
+    tf.SetOwner(&obj);
+
+    auto &rb = obj.AddComponent<RigidbodyComponent>(m_config.objectMass);
+    float r = m_config.objectRadius;
+    rb.SetSphere(Vector3f(r, r, r));
+    // Clients integrate their own drag; the server only extrapolates between updates.
+    rb.drag = 0.0f;
+    rb.angularDrag = 0.0f;
+
+    auto &sync = obj.AddComponent<NetworkSyncComponent>(objectID, false);
+    sync.ownerClientID = client.clientID;
+
+    obj.SetActive(true);
+    client.objects[objectID] = &obj;
+    return obj;
+}
+
+void DedicatedServer::DespawnObject(RemoteClient &client, NetObjectID objectID)
+{
+    auto it = client.objects.find(objectID);
+    if (it == client.objects.end())
+        return;
+    it->second->SetIsWaitingDestroy(true);
+    m_interestGrid.Remove(it->second);
+    client.objects.erase(it);
+
+    // ObjectDespawn below supersedes a RelevanceExit.
+    const uint64_t key = ObjectKey(client.clientID, objectID);
+    for (auto &[peer, other] : m_clients)
+        other.relevant.erase(key);
+
+    PacketSerializer::BufferWriter out(m_sendBuffer);
+    PacketSerializer::WriteObjectDespawn(out, client.clientID, objectID);
+    SendToAll(m_sendBuffer, 0, &client);
+}
+
+void DedicatedServer::RemoveClient(PeerID peer)
+{
+    auto it = m_clients.find(peer);
+    if (it == m_clients.end())
+        return;
+    RemoteClient &client = it->second;
+
+    std::vector<NetObjectID> owned;
+    for (const auto &[objectID, obj] : client.objects)
+        owned.push_back(objectID);
+    for (NetObjectID objectID : owned)
+        DespawnObject(client, objectID);
+
+    ClientID clientID = client.clientID;
+    bool announced = client.welcomed;
+    m_clients.erase(it);
+    if (announced)
+        SendToAll(PacketSerializer::WritePlayerMetaRemove(clientID), 0);
+}
+
+void DedicatedServer::BroadcastState(uint32_t serverTick)
+{
+    m_entries.clear();
+    m_stats.objects = 0;
+    for (const auto &[peer, client] : m_clients)
+    {
+        m_stats.objects += client.objects.size();
+        for (const auto &[objectID, obj] : client.objects)
+        {
+            if (m_config.interestManagement)
+                m_interestGrid.Update(obj, obj->GetComponent<TransformComponent>().GetWorldPosition());
+            else
+                m_entries.push_back(MakeBroadcastEntry(*obj, client.clientID, objectID));
+        }
+    }
+    m_stats.entriesSent = 0;
+    m_stats.relevant = 0;
+
+    if (!m_config.interestManagement)
+    {
+        if (m_entries.empty())
+            return;
+        if (!m_config.deltaSnapshots)
+        {
+            PacketSerializer::BufferWriter out(m_sendBuffer);
+            PacketSerializer::WritePositionBroadcast(out, m_entries.data(), m_entries.size(), serverTick);
+            SendToAll(m_sendBuffer, 1);
+            m_stats.entriesSent = m_entries.size() * m_clients.size();
+            return;
+        }
+        // Quantize once, then delta-encode per client against its own ack.
+        SnapshotCodec::BuildSnapshot(m_entries, m_snapshot);
+        for (auto &[peer, client] : m_clients)
+        {
+            if (!client.welcomed)
+                continue;
+            client.encoder.Encode(m_snapshot, serverTick, m_sendBuffer);
+            SendTo(client, m_sendBuffer, 1);
+            m_stats.entriesSent += m_snapshot.size();
+        }
+        return;
+    }
+
+    for (auto &[peer, client] : m_clients)
+    {
+        if (!client.welcomed)
+            continue;
+        CollectRelevant(client, serverTick);
+        m_stats.relevant += client.relevant.size();
+        m_stats.entriesSent += m_entries.size();
+
+        if (!m_exits.empty())
+        {
+            // Reliable: a lost exit would leave a frozen ghost on the client.
+            PacketSerializer::BufferWriter out(m_sendBuffer);
+            PacketSerializer::WriteRelevanceExit(out, m_exits.data(), m_exits.size(), serverTick);
+            SendTo(client, m_sendBuffer, 0);
+            m_stats.relevanceExits += m_exits.size();
+        }
+        if (!m_entries.empty())
+            SendState(client, serverTick);
+    }
+}
+
+void DedicatedServer::CollectRelevant(RemoteClient &client, uint32_t serverTick)
+{
+    m_entries.clear();
+    m_exits.clear();
+
+    // The client's own objects are its viewpoints; it simulates them itself.
+    m_viewpoints.clear();
+    m_candidates.clear();
+    const float exitRadius = m_config.interestFarRadius * INTEREST_EXIT_SCALE;
+    for (const auto &[objectID, obj] : client.objects)
+    {
+        Vector3f viewpoint = obj->GetComponent<TransformComponent>().GetWorldPosition();
+        m_viewpoints.push_back(viewpoint);
+        m_interestGrid.QueryRadius(viewpoint, exitRadius, TagRegistry::ALL_TAGS, m_queryResult);
+        m_candidates.insert(m_candidates.end(), m_queryResult.begin(), m_queryResult.end());
+    }
+    if (m_viewpoints.size() > 1)
+    {
+        std::sort(m_candidates.begin(), m_candidates.end());
+        m_candidates.erase(std::unique(m_candidates.begin(), m_candidates.end()), m_candidates.end());
+    }
+
+    const float nearSq = m_config.interestNearRadius * m_config.interestNearRadius;
+    const float farSq = m_config.interestFarRadius * m_config.interestFarRadius;
+    const uint32_t farInterval = std::max<uint32_t>(m_config.farUpdateInterval, 1);
+    for (GameObject *obj : m_candidates)
+    {
+        auto &sync = obj->GetComponent<NetworkSyncComponent>();
+        if (sync.ownerClientID == client.clientID)
+            continue;
+
+        Vector3f pos = obj->GetComponent<TransformComponent>().GetWorldPosition();
+        float distSq = std::numeric_limits<float>::max();
+        for (const Vector3f &viewpoint : m_viewpoints)
+            distSq = std::min(distSq, (pos - viewpoint).LengthSquared());
+
+        const uint64_t key = ObjectKey(sync.ownerClientID, sync.netObjectID);
+        auto it = client.relevant.find(key);
+        const bool entering = it == client.relevant.end();
+        if (entering)
+        {
+            if (distSq > farSq)
+                continue;
+            it = client.relevant.emplace(key, Interest{}).first;
+        }
+        Interest &interest = it->second;
+        interest.seenTick = serverTick;
+
+        // Near tier every tick, far tier every Nth; newly relevant objects at once.
+        if (!entering && distSq > nearSq && serverTick - interest.lastSentTick < farInterval)
+            continue;
+        interest.lastSentTick = serverTick;
+        m_entries.push_back(MakeBroadcastEntry(*obj, sync.ownerClientID, sync.netObjectID));
+    }
+
+    for (auto it = client.relevant.begin(); it != client.relevant.end();)
+    {
+        if (it->second.seenTick == serverTick)
+        {
+            ++it;
+            continue;
+        }
+        NetObjectRef ref;
+        ref.ownerClientID = static_cast<ClientID>(it->first >> 32);
+        ref.objectID = static_cast<NetObjectID>(it->first & 0xFFFFFFFFu);
+        m_exits.push_back(ref);
+        it = client.relevant.erase(it);
+    }
+}
+
+void DedicatedServer::SendState(RemoteClient &client, uint32_t serverTick)
+{
+    if (!m_config.deltaSnapshots)
+    {
+        PacketSerializer::BufferWriter out(m_sendBuffer);
+        PacketSerializer::WritePositionBroadcast(out, m_entries.data(), m_entries.size(), serverTick);
+        SendTo(client, m_sendBuffer, 1);
+        return;
+    }
+    // Entities skipped this tick are simply absent; the delta base still has them.
+    SnapshotCodec::BuildSnapshot(m_entries, m_snapshot);
+    client.encoder.Encode(m_snapshot, serverTick, m_sendBuffer);
+    SendTo(client, m_sendBuffer, 1);
+}
+
+void DedicatedServer::PrintStats()
+{
+    uint64_t snapshotBytes = 0;
+    uint64_t snapshotEntities = 0;
+    for (const auto &[peer, client] : m_clients)
+    {
+        snapshotBytes += client.encoder.GetStats().bytes;
+        snapshotEntities += client.encoder.GetStats().entities;
+    }
+    std::cout << "[DedicatedServer] tick=" << m_serverTick
+              << " clients=" << m_stats.clients
+              << " objects=" << m_stats.objects
+              << " sent=" << m_stats.entriesSent << "/tick"
+              << " relevant=" << m_stats.relevant
+              << " exits=" << m_stats.relevanceExits
+              << " sim=" << m_stats.simulateMs << "ms"
+              << " send=" << m_stats.broadcastMs << "ms"
+              << " in=" << m_stats.bytesIn << "B/" << m_stats.packetsIn
+              << " out=" << m_stats.bytesOut << "B/" << m_stats.packetsOut;
+    if (snapshotEntities > 0)
+        std::cout << " snapshot=" << double(snapshotBytes) / snapshotEntities << "B/entity";
+    std::cout << "\n";
+}
+
+void DedicatedServer::SendTo(RemoteClient &client, const std::vector<uint8_t> &buf, uint8_t channel)
+{
+    if (m_transport.SendTo(client.peer, buf.data(), buf.size(), channel))
+    {
+        m_stats.packetsOut++;
+        m_stats.bytesOut += buf.size();
+    }
+}
+
+void DedicatedServer::SendToAll(const std::vector<uint8_t> &buf, uint8_t channel, const RemoteClient *except)
+{
+    for (auto &[peer, client] : m_clients)
+    {
+        if (!client.welcomed || &client == except)
+            continue;
+        SendTo(client, buf, channel);
+    }
+}
+
+bool DedicatedServer::IsNicknameTaken(const std::string &nickname, ClientID exceptID) const
+{
+    for (const auto &[peer, client] : m_clients)
+    {
+        if (client.clientID != exceptID && client.nickname == nickname)
+            return true;
+    }
+    return false;
+}
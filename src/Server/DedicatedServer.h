@@ -0,0 +1,158 @@
+#pragma once
+#include "Server/ServerTransport.h"
+#include "Engine/Network/Protocol/SnapshotCodec.h"
+#include "Engine/Core/Spatial/SpatialHash.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class GameWorld;
+class GameObject;
+
+/// Command-line / launch settings of the dedicated server.
+struct ServerConfig
+{
+    uint16_t port = DEFAULT_SERVER_PORT;
+    float tickRate = 60.0f;
+    /// Only the "physics" section is read (stages, integrator, sleep, scheduler).
+    std::string scenePath = "assets/scenes/test_scene.json";
+    /// PositionSnapshot (quantized + delta) instead of raw PositionBroadcast.
+    bool deltaSnapshots = true;
+    /// Collision sphere given to every replicated object.
+    float objectRadius = 2.0f;
+    float objectMass = 1.0f;
+    /// Seconds between stats lines on stdout (0 = silent).
+    float statsInterval = 5.0f;
+
+    // ── Interest management ──
+    /// Each client only receives objects near its own; off = everything to everyone.
+    bool interestManagement = true;
+    /// Within this distance of one of the client's objects: sent every tick.
+    float interestNearRadius = 150.0f;
+    /// Up to this distance: sent every `farUpdateInterval` ticks. Objects leave
+    /// the relevance set a little beyond it (hysteresis) with a RelevanceExit.
+    float interestFarRadius = 600.0f;
+    uint32_t farUpdateInterval = 4;
+};
+
+/// Headless authoritative server.
+///
+/// Owns a windowless GameWorld: every object a client reports becomes a
+/// rigidbody that the engine's PhysicsSystem integrates and collides at a
+/// fixed tick. Client updates overwrite their own objects' state; every tick
+/// the simulated state is sent back over nbnet/UDP — per client, only the
+/// objects inside its area of interest, with far objects at a reduced rate.
+class DedicatedServer
+{
+public:
+    struct Stats
+    {
+        uint64_t ticks = 0;
+        size_t clients = 0;
+        size_t objects = 0;
+        uint64_t packetsIn = 0;
+        uint64_t packetsOut = 0;
+        uint64_t bytesIn = 0;
+        uint64_t bytesOut = 0;
+        double simulateMs = 0.0;  // last tick: world FixedUpdate
+        double broadcastMs = 0.0; // last tick: encode + send
+        size_t entriesSent = 0;   // last tick: object states sent, summed over clients
+        size_t relevant = 0;      // last tick: relevance set sizes, summed over clients
+        uint64_t relevanceExits = 0;
+    };
+
+    explicit DedicatedServer(const ServerConfig &config);
+    ~DedicatedServer();
+
+    DedicatedServer(const DedicatedServer &) = delete;
+    DedicatedServer &operator=(const DedicatedServer &) = delete;
+
+    bool Start();
+    /// Fixed-tick loop; returns after RequestStop().
+    void Run();
+    /// Safe to call from a signal handler.
+    void RequestStop() { m_stopRequested = true; }
+
+    /// One server tick: receive, simulate, broadcast.
+    void Tick(float fixedDeltaTime);
+
+    const Stats &GetStats() const { return m_stats; }
+
+private:
+    using PeerID = ServerTransport::PeerID;
+
+    struct Interest
+    {
+        uint32_t lastSentTick = 0;
+        uint32_t seenTick = 0; // last tick it was inside the exit radius
+    };
+
+    struct RemoteClient
+    {
+        PeerID peer = 0;
+        ClientID clientID = INVALID_CLIENT_ID;
+        NetUUID uuid{};
+        std::string nickname;
+        bool welcomed = false;
+        SnapshotEncoder encoder;
+        std::unordered_map<NetObjectID, GameObject *> objects;
+        /// Other clients' objects this client currently receives, keyed owner << 32 | object.
+        std::unordered_map<uint64_t, Interest> relevant;
+    };
+
+    // ── Transport events ───────────────────────────────────────────
+    void OnPeerConnect(PeerID peer);
+    void OnPeerDisconnect(PeerID peer);
+    void OnPeerReceive(PeerID peer, const uint8_t *data, size_t len);
+
+    // ── Message handlers ───────────────────────────────────────────
+    void HandleHello(RemoteClient &client, const uint8_t *data, size_t len);
+    void HandlePositionUpdate(RemoteClient &client, const uint8_t *data, size_t len);
+    void HandleObjectRelease(RemoteClient &client, const uint8_t *data, size_t len);
+    void HandleChatRequest(RemoteClient &client, const uint8_t *data, size_t len);
+    void HandleNicknameUpdate(RemoteClient &client, const uint8_t *data, size_t len);
+
+    // ── Helpers ────────────────────────────────────────────────────
+    GameObject &SpawnObject(RemoteClient &client, NetObjectID objectID);
+    void DespawnObject(RemoteClient &client, NetObjectID objectID);
+    void RemoveClient(PeerID peer);
+    void BroadcastState(uint32_t serverTick);
+    /// Fill m_entries with the objects due for `client` this tick, m_exits with
+    /// those that left its area of interest.
+    void CollectRelevant(RemoteClient &client, uint32_t serverTick);
+    void SendState(RemoteClient &client, uint32_t serverTick);
+    void PrintStats();
+
+    void SendTo(RemoteClient &client, const std::vector<uint8_t> &buf, uint8_t channel);
+    void SendToAll(const std::vector<uint8_t> &buf, uint8_t channel, const RemoteClient *except = nullptr);
+    bool IsNicknameTaken(const std::string &nickname, ClientID exceptID) const;
+
+    ServerConfig m_config;
+    ServerTransport m_transport;
+    std::unique_ptr<GameWorld> m_world;
+
+    std::unordered_map<PeerID, RemoteClient> m_clients;
+    /// Reconnecting clients keep their ClientID (keyed by persistent UUID).
+    std::unordered_map<NetUUID, ClientID, NetUUIDHash> m_knownUUIDs;
+    ClientID m_nextClientID = 1;
+    uint32_t m_serverTick = 0;
+
+    /// Coarse grid over all replicated objects (cell = near radius), refreshed each tick.
+    SpatialHash m_interestGrid;
+
+    // Reused across ticks so steady-state broadcasting does not allocate.
+    std::vector<NetBroadcastEntry> m_entries;
+    std::vector<NetObjectRef> m_exits;
+    std::vector<Vector3f> m_viewpoints;
+    std::vector<GameObject *> m_candidates;
+    std::vector<GameObject *> m_queryResult;
+    std::vector<SnapshotEntity> m_snapshot;
+    std::vector<uint8_t> m_sendBuffer;
+
+    std::atomic<bool> m_stopRequested{false};
+    Stats m_stats;
+    double m_statsTimer = 0.0;
+};
@@ -0,0 +1,76 @@
+// ────────────────────────────────────────────────────────────────────
+// Neural_Wings dedicated server entry point (no window, no renderer).
+//
+//   Neural_Wings-demo-server [--port N] [--tick HZ] [--scene PATH]
+//                            [--full-broadcast] [--stats SECONDS]
+//                            [--no-interest] [--aoi-near R] [--aoi-far R]
+//                            [--aoi-far-interval TICKS]
+// ────────────────────────────────────────────────────────────────────
+
+#include "Server/DedicatedServer.h"
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+static DedicatedServer *g_server = nullptr;
+
+static void HandleSignal(int)
+{
+    if (g_server)
+        g_server->RequestStop();
+}
+
+static void PrintUsage()
+{
+    std::cout << "Usage: Neural_Wings-demo-server [--port N] [--tick HZ] [--scene PATH]\n"
+                 "                                [--full-broadcast] [--stats SECONDS]\n"
+                 "                                [--no-interest] [--aoi-near R] [--aoi-far R]\n"
+                 "                                [--aoi-far-interval TICKS]\n";
+}
+
+int main(int argc, char **argv)
+{
+    ServerConfig config;
+    for (int i = 1; i < argc; ++i)
+    {
+        const char *arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (std::strcmp(arg, "--port") == 0 && hasValue)
+            config.port = static_cast<uint16_t>(std::atoi(argv[++i]));
+        else if (std::strcmp(arg, "--tick") == 0 && hasValue)
+            config.tickRate = static_cast<float>(std::atof(argv[++i]));
+        else if (std::strcmp(arg, "--scene") == 0 && hasValue)
+            config.scenePath = argv[++i];
+        else if (std::strcmp(arg, "--stats") == 0 && hasValue)
+            config.statsInterval = static_cast<float>(std::atof(argv[++i]));
+        else if (std::strcmp(arg, "--full-broadcast") == 0)
+            config.deltaSnapshots = false;
+        else if (std::strcmp(arg, "--no-interest") == 0)
+            config.interestManagement = false;
+        else if (std::strcmp(arg, "--aoi-near") == 0 && hasValue)
+            config.interestNearRadius = static_cast<float>(std::atof(argv[++i]));
+        else if (std::strcmp(arg, "--aoi-far") == 0 && hasValue)
+            config.interestFarRadius = static_cast<float>(std::atof(argv[++i]));
+        else if (std::strcmp(arg, "--aoi-far-interval") == 0 && hasValue)
+            config.farUpdateInterval = static_cast<uint32_t>(std::atoi(argv[++i]));
+        else
+        {
+            PrintUsage();
+            return std::strcmp(arg, "--help") == 0 ? 0 : -1;
+        }
+    }
+
+    DedicatedServer server(config);
+    if (!server.Start())
+        return -1;
+
+    g_server = &server;
+    std::signal(SIGINT, HandleSignal);
+    std::signal(SIGTERM, HandleSignal);
+
+    server.Run();
+
+    g_server = nullptr;
+    return 0;
+}
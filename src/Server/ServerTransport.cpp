@@ -0,0 +1,147 @@
+// ────────────────────────────────────────────────────────────────────
+// ServerTransport  –  nbnet game-server C++ wrapper
+//
+// The nbnet implementation (NBNET_IMPL, client and server halves) is
+// compiled once as C in nbnet_client_impl.c; this file only uses the
+// declarations, exactly like NBNetTransport.cpp.
+// ────────────────────────────────────────────────────────────────────
+
+extern "C"
+{
+#include <nbnet.h>
+#include <net_drivers/udp.h>
+}
+
+#include "ServerTransport.h"
+#include <iostream>
+
+// ── Constants ──────────────────────────────────────────────────────
+// Must match NBNetTransport.cpp, otherwise nbnet rejects the handshake.
+static constexpr const char *NW_PROTOCOL_NAME = "neural_wings";
+
+static uint8_t MapChannel(uint8_t ourChannel)
+{
+    // our convention: 0 = reliable, 1 = unreliable
+    return (ourChannel == 0) ? NBN_CHANNEL_RESERVED_RELIABLE : NBN_CHANNEL_RESERVED_UNRELIABLE;
+}
+
+// ── Lifecycle ──────────────────────────────────────────────────────
+
+ServerTransport::~ServerTransport()
+{
+    Stop();
+}
+
+bool ServerTransport::Start(uint16_t port)
+{
+    if (m_started)
+        Stop();
+
+    // Same rule as the client: drivers may only be registered once per process.
+    static bool s_driverRegistered = false;
+    if (!s_driverRegistered)
+    {
+        NBN_UDP_Register();
+        s_driverRegistered = true;
+    }
+
+    if (NBN_GameServer_StartEx(NW_PROTOCOL_NAME, port, false /* no encryption */) < 0)
+    {
+        std::cerr << "[ServerTransport] NBN_GameServer_StartEx failed on port " << port << "\n";
+        return false;
+    }
+
+    m_started = true;
+    std::cout << "[ServerTransport] Listening on UDP port " << port << "\n";
+    return true;
+}
+
+void ServerTransport::Stop()
+{
+    if (!m_started)
+        return;
+    NBN_GameServer_Stop();
+    m_started = false;
+}
+
+// ── Poll ───────────────────────────────────────────────────────────
+void ServerTransport::Poll()
+{
+    if (!m_started)
+        return;
+
+    int ev;
+    while ((ev = NBN_GameServer_Poll()) != NBN_NO_EVENT)
+    {
+        if (ev < 0)
+        {
+            std::cerr << "[ServerTransport] Poll error\n";
+            return;
+        }
+
+        switch (ev)
+        {
+        case NBN_NEW_CONNECTION:
+        {
+            PeerID peer = NBN_GameServer_GetIncomingConnection();
+            NBN_GameServer_AcceptIncomingConnection();
+            if (m_onConnect)
+                m_onConnect(peer);
+            break;
+        }
+
+        case NBN_CLIENT_DISCONNECTED:
+        {
+            PeerID peer = NBN_GameServer_GetDisconnectedClient();
+            if (m_onDisconnect)
+                m_onDisconnect(peer);
+            break;
+        }
+
+        case NBN_CLIENT_MESSAGE_RECEIVED:
+        {
+            NBN_MessageInfo info = NBN_GameServer_GetMessageInfo();
+            if (info.type == NBN_BYTE_ARRAY_MESSAGE_TYPE)
+            {
+                NBN_ByteArrayMessage *msg =
+                    static_cast<NBN_ByteArrayMessage *>(info.data);
+                if (m_onReceive && msg)
+                {
+                    uint8_t ourChannel =
+                        (info.channel_id == NBN_CHANNEL_RESERVED_RELIABLE) ? 0 : 1;
+                    m_onReceive(info.sender, msg->bytes, msg->length, ourChannel);
+                }
+            }
+            break;
+        }
+        }
+    }
+}
+
+// ── Send ───────────────────────────────────────────────────────────
+bool ServerTransport::SendTo(PeerID peer, const uint8_t *data, size_t len, uint8_t channel)
+{
+    if (!m_started || !data || len == 0)
+        return false;
+
+    if (NBN_GameServer_SendByteArrayTo(
+            peer,
+            const_cast<uint8_t *>(data),
+            static_cast<unsigned int>(len),
+            MapChannel(channel)) < 0)
+    {
+        std::cerr << "[ServerTransport] SendByteArrayTo failed (peer " << peer << ")\n";
+        return false;
+    }
+    return true;
+}
+
+void ServerTransport::FlushSend()
+{
+    if (!m_started)
+        return;
+    if (NBN_GameServer_SendPackets() < 0)
+    {
+        std::cerr << "[ServerTransport] SendPackets failed\n";
+    }
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+/// Server-side nbnet wrapper (UDP driver) used by the dedicated server.
+/// Mirrors NBNetTransport on the client: same protocol name, same channel
+/// convention (0 = reliable, 1 = unreliable).
+class ServerTransport
+{
+public:
+    /// nbnet connection handle of one connected client.
+    using PeerID = uint32_t;
+
+    using OnPeerConnectFn = std::function<void(PeerID peer)>;
+    using OnPeerDisconnectFn = std::function<void(PeerID peer)>;
+    using OnPeerReceiveFn =
+        std::function<void(PeerID peer, const uint8_t *data, size_t len, uint8_t channelID)>;
+
+    ServerTransport() = default;
+    ~ServerTransport();
+
+    ServerTransport(const ServerTransport &) = delete;
+    ServerTransport &operator=(const ServerTransport &) = delete;
+
+    // ── Lifecycle ──────────────────────────────────────────────────
+    bool Start(uint16_t port);
+    void Stop();
+    bool IsRunning() const { return m_started; }
+
+    // ── Runtime ────────────────────────────────────────────────────
+    /// Drain all pending nbnet events and dispatch them to the callbacks.
+    void Poll();
+    bool SendTo(PeerID peer, const uint8_t *data, size_t len, uint8_t channel = 0);
+    /// Flush queued messages of every connection.
+    void FlushSend();
+
+    // ── Callbacks ──────────────────────────────────────────────────
+    void SetOnPeerConnect(OnPeerConnectFn fn) { m_onConnect = std::move(fn); }
+    void SetOnPeerDisconnect(OnPeerDisconnectFn fn) { m_onDisconnect = std::move(fn); }
+    void SetOnPeerReceive(OnPeerReceiveFn fn) { m_onReceive = std::move(fn); }
+
+private:
+    OnPeerConnectFn m_onConnect;
+    OnPeerDisconnectFn m_onDisconnect;
+    OnPeerReceiveFn m_onReceive;
+    bool m_started = false;
+};
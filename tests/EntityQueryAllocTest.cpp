@@ -0,0 +1,103 @@
+// 实体查询缓存检查:
+// 1. 成员不变时反复调用 GetEntitiesWith 既不重建也不分配
+// 2. 对象反复激活/停用时, 从不被读取的签名积压的变化数也有上界(每次 SyncActiveEntities 都会合并)
+// 通过替换全局 operator new 计数; 失败时返回非零, 供 ctest 判定.
+#include "Engine/Core/GameWorld.h"
+#include "Engine/Core/Components/Components.h"
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+namespace
+{
+    size_t g_allocCount = 0;
+    int g_failures = 0;
+
+    void Check(bool condition, const char *what)
+    {
+        std::printf("[EntityQueryAllocTest] %s: %s\n", condition ? "ok" : "FAILED", what);
+        if (!condition)
+            g_failures++;
+    }
+}
+
+void *operator new(size_t size)
+{
+    g_allocCount++;
+    if (void *p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, size_t) noexcept { std::free(p); }
+
+int main()
+{
+    constexpr size_t kBodies = 256;
+    constexpr size_t kProps = 64;
+    constexpr size_t kQueriesPerFrame = 16;
+    constexpr int kFrames = 500;
+
+    GameWorld world(HeadlessWorld{}, [](ScriptingFactory &, PhysicsStageFactory &, ParticleFactory &) {}, "");
+
+    std::vector<GameObject *> bodies;
+    for (size_t i = 0; i < kBodies; i++)
+    {
+        GameObject &object = world.CreateGameObject();
+        object.AddComponent<TransformComponent>().SetLocalPosition(Vector3f((float)i, 0.0f, 0.0f));
+        object.AddComponent<RigidbodyComponent>();
+        object.SetActive(true);
+        bodies.push_back(&object);
+    }
+    for (size_t i = 0; i < kProps; i++)
+    {
+        GameObject &object = world.CreateGameObject();
+        object.AddComponent<TransformComponent>();
+        object.SetActive(true);
+    }
+
+    // 预热: 创建两个签名的缓存; 只读一次的签名之后不再被查询
+    world.FixedUpdate(1.0f / 60.0f);
+    world.GetEntitiesWith<RigidbodyComponent, TransformComponent>();
+    world.GetEntitiesWith<TransformComponent>();
+    world.GetEntitiesWith<RigidbodyComponent>();
+
+    const EntityQueryStats bodyStats = world.GetEntityQueryStats<RigidbodyComponent, TransformComponent>();
+    const size_t before = g_allocCount;
+    size_t seen = 0;
+    for (int frame = 0; frame < kFrames; frame++)
+    {
+        for (size_t q = 0; q < kQueriesPerFrame; q++)
+        {
+            seen += world.GetEntitiesWith<RigidbodyComponent, TransformComponent>().size();
+            seen += world.GetEntitiesWith<TransformComponent>().size();
+        }
+    }
+    const size_t allocs = g_allocCount - before;
+    const EntityQueryStats &afterStats = world.GetEntityQueryStats<RigidbodyComponent, TransformComponent>();
+
+    std::printf("[EntityQueryAllocTest] %d x %zu repeated queries: allocations=%zu rebuilds=%llu updates=%llu\n",
+                kFrames, kQueriesPerFrame, allocs, (unsigned long long)(afterStats.rebuilds - bodyStats.rebuilds),
+                (unsigned long long)(afterStats.updates - bodyStats.updates));
+    Check(seen == (size_t)kFrames * kQueriesPerFrame * (kBodies + kBodies + kProps), "cached sets have the expected size");
+    Check(allocs == 0, "repeated GetEntitiesWith does not allocate");
+    Check(afterStats.rebuilds == bodyStats.rebuilds && afterStats.updates == bodyStats.updates,
+          "repeated GetEntitiesWith neither rebuilds nor updates");
+
+    // 每帧停用一半刚体、再激活上一帧停用的那一半, 集合成员持续变化
+    for (int frame = 0; frame < kFrames; frame++)
+    {
+        for (size_t i = 0; i < kBodies; i++)
+            bodies[i]->SetActive((i + frame) % 2 == 0);
+        world.FixedUpdate(1.0f / 60.0f);
+    }
+    const EntityQueryStats &unread = world.GetEntityQueryStats<RigidbodyComponent>();
+    std::printf("[EntityQueryAllocTest] churn over %d frames: unread query maxPending=%llu updates=%llu\n",
+                kFrames, (unsigned long long)unread.maxPending, (unsigned long long)unread.updates);
+    Check(unread.maxPending <= kBodies, "pending changes of an unread query stay bounded");
+    Check(world.GetEntitiesWith<RigidbodyComponent>().size() == kBodies / 2, "unread query is still correct");
+
+    return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include "Engine/Math/Math.h"
+
+// 数学热点改为内联 + SIMD 之前的标量实现 (逐字取自原 Matrix4f.cpp / Quat4f.cpp),
+// 供 MathKernelTest 做逐位对比、MathBench 做耗时对比
+namespace MathBaseline
+{
+    inline Matrix4f Mul(const Matrix4f &x, const Matrix4f &y)
+    {
+        Matrix4f product(0.0f);
+        for (int i = 0; i < 4; ++i)
+        {
+            for (int j = 0; j < 4; ++j)
+            {
+                for (int k = 0; k < 4; ++k)
+                {
+                    product(i, k) += x(i, j) * y(j, k);
+                }
+            }
+        }
+        return product;
+    }
+
+    inline Vector4f Mul(const Matrix4f &m, const Vector4f &v)
+    {
+        Vector4f output(0, 0, 0, 0);
+        for (int i = 0; i < 4; ++i)
+        {
+            for (int j = 0; j < 4; ++j)
+            {
+                output[i] += m(i, j) * v[j];
+            }
+        }
+        return output;
+    }
+
+    inline Quat4f Mul(const Quat4f &q0, const Quat4f &q1)
+    {
+        return Quat4f(
+            q0.w() * q1.w() - q0.x() * q1.x() - q0.y() * q1.y() - q0.z() * q1.z(),
+            q0.w() * q1.x() + q0.x() * q1.w() + q0.y() * q1.z() - q0.z() * q1.y(),
+            q0.w() * q1.y() - q0.x() * q1.z() + q0.y() * q1.w() + q0.z() * q1.x(),
+            q0.w() * q1.z() + q0.x() * q1.y() - q0.y() * q1.x() + q0.z() * q1.w());
+    }
+
+    // 原 CreateTransform: 两次完整的 4x4 乘法
+    inline Matrix4f CreateTransform(const Vector3f &pos, const Quat4f &rot, const Vector3f &sc)
+    {
+        return Mul(Mul(Matrix4f::translation(pos), Matrix4f::rotation(rot)), Matrix4f::scale(sc));
+    }
+}
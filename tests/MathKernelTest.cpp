@@ -0,0 +1,96 @@
+// 数学内核差分检查: 内联 + SIMD 实现与原标量实现 (MathBaseline.h) 对随机输入逐位比较
+// 覆盖 4x4 乘法、4x4 乘向量、四元数乘法与 CreateTransform.
+// 逐位一致以未开启 FMA 收缩为前提 (见 Engine/Math/Core/Simd.h).
+#include "MathBaseline.h"
+#include <cstdio>
+#include <cstring>
+#include <random>
+
+namespace
+{
+    int g_failures = 0;
+
+    void Check(bool condition, const char *what)
+    {
+        std::printf("[MathKernelTest] %s: %s\n", condition ? "ok" : "FAILED", what);
+        if (!condition)
+            g_failures++;
+    }
+
+    // 逐位比较, 返回不一致的分量数
+    size_t Compare(const float *expected, const float *actual, int count)
+    {
+        size_t mismatches = 0;
+        for (int i = 0; i < count; i++)
+            mismatches += std::memcmp(&expected[i], &actual[i], sizeof(float)) != 0;
+        return mismatches;
+    }
+
+    Quat4f RandomQuat(std::mt19937 &rng)
+    {
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        return Quat4f(unit(rng), unit(rng), unit(rng), unit(rng));
+    }
+
+    // 一半是任意值矩阵, 一半是带精确零元素的 TRS 矩阵 (更接近引擎里的实际输入)
+    Matrix4f RandomMatrix(std::mt19937 &rng, bool trs)
+    {
+        std::uniform_real_distribution<float> value(-100.0f, 100.0f);
+        std::uniform_real_distribution<float> positive(0.1f, 10.0f);
+        if (trs)
+        {
+            return MathBaseline::CreateTransform(Vector3f(value(rng), value(rng), value(rng)), RandomQuat(rng),
+                                                 Vector3f(positive(rng), positive(rng), positive(rng)));
+        }
+        Matrix4f m(0.0f);
+        for (int i = 0; i < 4; i++)
+            for (int j = 0; j < 4; j++)
+                m(i, j) = value(rng);
+        return m;
+    }
+}
+
+int main()
+{
+    constexpr int kSamples = 200000;
+    std::mt19937 rng(6);
+    std::uniform_real_distribution<float> value(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> positive(0.1f, 10.0f);
+
+    size_t mat4Mul = 0, mat4Vec4 = 0, quatMul = 0, transform = 0;
+    for (int s = 0; s < kSamples; s++)
+    {
+        const Matrix4f a = RandomMatrix(rng, s % 2 == 0);
+        const Matrix4f b = RandomMatrix(rng, s % 4 < 2);
+        const Matrix4f expectedM = MathBaseline::Mul(a, b);
+        const Matrix4f actualM = a * b;
+        mat4Mul += Compare(&expectedM(0, 0), &actualM(0, 0), 16);
+
+        // w = 0 的方向向量与 w = 1 的点交替
+        const Vector4f v(value(rng), value(rng), value(rng), s % 2 == 0 ? 0.0f : 1.0f);
+        const Vector4f expectedV = MathBaseline::Mul(a, v);
+        const Vector4f actualV = a * v;
+        mat4Vec4 += Compare(&expectedV[0], &actualV[0], 4);
+
+        const Quat4f q0 = RandomQuat(rng);
+        const Quat4f q1 = RandomQuat(rng);
+        const Quat4f expectedQ = MathBaseline::Mul(q0, q1);
+        const Quat4f actualQ = q0 * q1;
+        quatMul += Compare(&expectedQ[0], &actualQ[0], 4);
+
+        const Vector3f pos(value(rng), value(rng), value(rng));
+        const Vector3f scale(positive(rng), positive(rng), positive(rng));
+        const Matrix4f expectedT = MathBaseline::CreateTransform(pos, q0, scale);
+        const Matrix4f actualT = Matrix4f::CreateTransform(pos, q0, scale);
+        transform += Compare(&expectedT(0, 0), &actualT(0, 0), 16);
+    }
+
+    std::printf("[MathKernelTest] %d samples: mismatching lanes mat4*mat4=%zu mat4*vec4=%zu quat*quat=%zu "
+                "CreateTransform=%zu\n",
+                kSamples, mat4Mul, mat4Vec4, quatMul, transform);
+    Check(mat4Mul == 0, "Matrix4f * Matrix4f matches the scalar baseline bit for bit");
+    Check(mat4Vec4 == 0, "Matrix4f * Vector4f matches the scalar baseline bit for bit");
+    Check(quatMul == 0, "Quat4f * Quat4f matches the scalar baseline bit for bit");
+    Check(transform == 0, "CreateTransform matches translation * rotation * scale bit for bit");
+    return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,98 @@
+// 网络热路径零分配检查:
+// 预热后, 每 tick 的位置广播编解码、快照编码/解码/ACK 不应再触发堆分配.
+// 通过替换全局 operator new 计数; 有分配时返回非零, 供 ctest 判定失败.
+#include "Engine/Network/Protocol/SnapshotCodec.h"
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    size_t g_allocCount = 0;
+}
+
+void *operator new(size_t size)
+{
+    g_allocCount++;
+    if (void *p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, size_t) noexcept { std::free(p); }
+
+int main()
+{
+    constexpr size_t kEntityCount = 32;
+    constexpr uint32_t kWarmupTicks = 40;
+    constexpr uint32_t kMeasuredTicks = 1000;
+
+    std::vector<NetBroadcastEntry> entries(kEntityCount);
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        entries[i].clientID = 1;
+        entries[i].objectID = (NetObjectID)(i + 1);
+    }
+
+    std::vector<uint8_t> sendBuffer;
+    std::vector<uint8_t> broadcastPacket;
+    std::vector<uint8_t> snapshotPacket;
+    std::vector<SnapshotEntity> snapshot;
+    std::vector<NetBroadcastEntry> decoded;
+    std::vector<NetObjectID> seenIDs;
+    seenIDs.reserve(kEntityCount);
+
+    SnapshotEncoder encoder;
+    SnapshotDecoder decoder;
+    bool ok = true;
+
+    auto step = [&](uint32_t tick)
+    {
+        // 服务端: 位置广播
+        PacketSerializer::BufferWriter broadcast(broadcastPacket);
+        PacketSerializer::WritePositionBroadcast(broadcast, entries.data(), entries.size(), tick);
+
+        // 客户端: 零拷贝读取
+        auto view = PacketSerializer::ReadPositionBroadcastView(broadcastPacket.data(), broadcastPacket.size());
+        seenIDs.clear();
+        for (const NetBroadcastEntry &entry : view.entries)
+            seenIDs.push_back(entry.objectID);
+        ok &= seenIDs.size() == kEntityCount;
+
+        // 客户端: 上报自身位置
+        PacketSerializer::BufferWriter update(sendBuffer);
+        PacketSerializer::WritePositionUpdate(update, 1, 2, entries[0].transform);
+
+        // 快照增量编码 -> 解码 -> ACK
+        SnapshotCodec::BuildSnapshot(entries, snapshot);
+        encoder.Encode(snapshot, tick, snapshotPacket);
+        uint32_t serverTick = 0;
+        ok &= decoder.Decode(snapshotPacket.data(), snapshotPacket.size(), serverTick, decoded);
+        encoder.OnAck(serverTick);
+
+        PacketSerializer::BufferWriter ack(sendBuffer);
+        PacketSerializer::WriteSnapshotAck(ack, 1, serverTick);
+    };
+
+    for (uint32_t tick = 1; tick <= kWarmupTicks; tick++)
+        step(tick);
+
+    const size_t before = g_allocCount;
+    for (uint32_t tick = kWarmupTicks + 1; tick <= kWarmupTicks + kMeasuredTicks; tick++)
+        step(tick);
+    const size_t allocs = g_allocCount - before;
+
+    std::printf("[NetworkAllocTest] steady-state allocations over %u ticks: %zu\n", kMeasuredTicks, allocs);
+    if (!ok)
+    {
+        std::printf("[NetworkAllocTest] FAILED: round-trip mismatch\n");
+        return 1;
+    }
+    if (allocs != 0)
+    {
+        std::printf("[NetworkAllocTest] FAILED: hot path allocated\n");
+        return 1;
+    }
+    return 0;
+}
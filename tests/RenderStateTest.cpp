@@ -0,0 +1,246 @@
+// 渲染状态切换检查 (不需要窗口/GL):
+// 用记录型 rlgl 替身代替 raylib, 同一场景分别走
+//   1. 原先逐 pass 的绘制流程: 每次绘制前后刷新批次并重置混合/深度/剔除状态
+//   2. 按 DrawCommand 键排序 + RenderStateCache 的增量切换
+// 每次绘制时核对替身记录的 GL 状态与 pass 要求一致, 并比较两条路径的状态调用次数.
+// ShaderWrapper 只链接下面的替身实现: 构造时分配程序号, Begin/End 记录绑定.
+#include "Engine/Graphics/RenderQueue/RenderQueue.h"
+#include "Engine/Graphics/RenderQueue/RenderStateCache.h"
+#include "raylib.h"
+#include "rlgl.h"
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    // 替身记录的 GL 状态与调用次数
+    struct GLRecorder
+    {
+        bool blend = true;
+        int blendMode = BLEND_ALPHA;
+        bool depthTest = true;
+        bool depthMask = true;
+        bool cull = false;
+        int cullFace = RL_CULL_FACE_BACK;
+        unsigned int program = 0;
+
+        size_t stateCalls = 0; // 混合/深度/剔除相关的 rlgl 调用
+        size_t flushes = 0;
+        size_t shaderBinds = 0;
+    };
+
+    GLRecorder g_gl;
+    unsigned int g_nextProgram = 0;
+    int g_failures = 0;
+
+    void Check(bool condition, const char *what)
+    {
+        std::printf("[RenderStateTest] %s: %s\n", condition ? "ok" : "FAILED", what);
+        if (!condition)
+            g_failures++;
+    }
+}
+
+// ── rlgl / raylib 替身 ──
+void rlEnableColorBlend(void) { g_gl.stateCalls++; g_gl.blend = true; }
+void rlDisableColorBlend(void) { g_gl.stateCalls++; g_gl.blend = false; }
+void rlSetBlendMode(int mode) { g_gl.stateCalls++; g_gl.blendMode = mode; }
+void rlSetBlendFactors(int, int, int) { g_gl.stateCalls++; }
+void rlEnableDepthTest(void) { g_gl.stateCalls++; g_gl.depthTest = true; }
+void rlDisableDepthTest(void) { g_gl.stateCalls++; g_gl.depthTest = false; }
+void rlEnableDepthMask(void) { g_gl.stateCalls++; g_gl.depthMask = true; }
+void rlDisableDepthMask(void) { g_gl.stateCalls++; g_gl.depthMask = false; }
+void rlEnableBackfaceCulling(void) { g_gl.stateCalls++; g_gl.cull = true; }
+void rlDisableBackfaceCulling(void) { g_gl.stateCalls++; g_gl.cull = false; }
+void rlSetCullFace(int mode) { g_gl.stateCalls++; g_gl.cullFace = mode; }
+void rlDrawRenderBatchActive(void) { g_gl.flushes++; }
+// raylib 的 BeginBlendMode/EndBlendMode 先提交批次再切换混合模式
+void BeginBlendMode(int mode)
+{
+    g_gl.flushes++;
+    rlSetBlendMode(mode);
+}
+void EndBlendMode(void)
+{
+    g_gl.flushes++;
+    rlSetBlendMode(BLEND_ALPHA);
+}
+
+ShaderWrapper::ShaderWrapper(const std::string &vsPath, const std::string &fsPath)
+    : m_vsPath(vsPath), m_fsPath(fsPath)
+{
+    m_shader = Shader{};
+    m_shader.id = ++g_nextProgram;
+}
+ShaderWrapper::~ShaderWrapper() = default;
+void ShaderWrapper::Begin() const
+{
+    g_gl.shaderBinds++;
+    g_gl.program = m_shader.id;
+}
+void ShaderWrapper::End() const { g_gl.program = 0; }
+
+namespace
+{
+    struct SceneObject
+    {
+        Mesh mesh{};
+        std::vector<const RenderMaterial *> passes;
+    };
+
+    // 绘制时的 GL 状态应当正好是 pass 要求的状态
+    bool StateMatches(const RenderMaterial &pass)
+    {
+        bool ok = g_gl.program == pass.shader->GetShader().id;
+        ok &= g_gl.blend == (pass.blendMode != BLEND_OPIQUE);
+        if (pass.blendMode != BLEND_OPIQUE)
+            ok &= g_gl.blendMode == pass.blendMode;
+        ok &= g_gl.depthTest == pass.depthTest;
+        ok &= g_gl.depthMask == pass.depthWrite;
+        ok &= g_gl.cull == (pass.cullFace >= 0);
+        if (pass.cullFace >= 0)
+            ok &= g_gl.cullFace == pass.cullFace;
+        return ok;
+    }
+
+    // 原 Renderer::RenderSinglePass 中与状态相关的调用顺序
+    bool LegacyPass(const RenderMaterial &pass)
+    {
+        rlDrawRenderBatchActive();
+        rlEnableDepthTest();
+        rlEnableDepthMask();
+        rlDisableBackfaceCulling();
+        rlSetCullFace(RL_CULL_FACE_BACK);
+        rlEnableColorBlend();
+
+        pass.shader->Begin();
+        if (pass.blendMode == BLEND_OPIQUE)
+            rlDisableColorBlend();
+        else
+            BeginBlendMode(pass.blendMode);
+        if (pass.cullFace >= 0)
+        {
+            rlEnableBackfaceCulling();
+            rlSetCullFace(pass.cullFace);
+        }
+        if (!pass.depthTest)
+            rlDisableDepthTest();
+        if (!pass.depthWrite)
+            rlDisableDepthMask();
+
+        const bool ok = StateMatches(pass); // DrawMesh
+        rlDrawRenderBatchActive();
+        pass.shader->End();
+        EndBlendMode();
+
+        rlEnableColorBlend();
+        rlEnableDepthTest();
+        rlEnableDepthMask();
+        rlDisableBackfaceCulling();
+        return ok;
+    }
+
+    bool DefaultState()
+    {
+        return g_gl.blend && g_gl.blendMode == BLEND_ALPHA && g_gl.depthTest && g_gl.depthMask && !g_gl.cull;
+    }
+}
+
+int main()
+{
+    constexpr int kObjects = 300;
+    constexpr int kShaders = 3;
+    constexpr int kMeshes = 4;
+
+    // 3 个 shader 的不透明 pass (一半背面剔除), 以及 1/4 对象额外的半透明描边 pass
+    std::vector<std::shared_ptr<ShaderWrapper>> shaders;
+    for (int s = 0; s < kShaders; s++)
+        shaders.push_back(std::make_shared<ShaderWrapper>("", ""));
+    std::vector<RenderMaterial> opaque(kShaders * 2);
+    for (int s = 0; s < kShaders; s++)
+    {
+        for (int c = 0; c < 2; c++)
+        {
+            RenderMaterial &pass = opaque[s * 2 + c];
+            pass.shader = shaders[s];
+            pass.blendMode = BLEND_OPIQUE;
+            pass.depthWrite = true;
+            pass.cullFace = c == 0 ? -1 : RL_CULL_FACE_BACK;
+        }
+    }
+    RenderMaterial outline;
+    outline.shader = shaders[0];
+    outline.blendMode = BLEND_ALPHA;
+    outline.depthWrite = false;
+    outline.cullFace = RL_CULL_FACE_FRONT;
+
+    std::vector<SceneObject> objects(kObjects);
+    size_t passCount = 0;
+    for (int i = 0; i < kObjects; i++)
+    {
+        objects[i].mesh.vaoId = 1 + (unsigned int)(i % kMeshes);
+        objects[i].passes.push_back(&opaque[(i * 7) % (kShaders * 2)]);
+        if (i % 4 == 0)
+            objects[i].passes.push_back(&outline);
+        passCount += objects[i].passes.size();
+    }
+
+    // 1. 原流程: 按提交顺序逐 pass 绘制
+    g_gl = GLRecorder();
+    bool legacyOk = true;
+    for (const SceneObject &object : objects)
+    {
+        for (const RenderMaterial *pass : object.passes)
+            legacyOk &= LegacyPass(*pass);
+    }
+    const GLRecorder legacy = g_gl;
+
+    // 2. 排序 + 状态缓存
+    g_gl = GLRecorder();
+    std::vector<DrawCommand> commands;
+    uint32_t sequence = 0;
+    for (uint32_t i = 0; i < objects.size(); i++)
+    {
+        for (size_t p = 0; p < objects[i].passes.size(); p++)
+        {
+            const RenderMaterial &pass = *objects[i].passes[p];
+            commands.push_back({DrawCommand::MakeKey(pass, (int)p, objects[i].mesh, sequence++), i, 0, &pass});
+        }
+    }
+    std::sort(commands.begin(), commands.end());
+
+    RenderStateCache cache;
+    bool sortedOk = true;
+    bool opaqueFirst = true;
+    bool seenOrdered = false;
+    rlDrawRenderBatchActive();
+    cache.Begin();
+    for (const DrawCommand &command : commands)
+    {
+        cache.ApplyShader(*command.pass->shader);
+        cache.ApplyPassState(*command.pass);
+        sortedOk &= StateMatches(*command.pass);
+        const bool ordered = command.pass == &outline;
+        opaqueFirst &= !(seenOrdered && !ordered);
+        seenOrdered |= ordered;
+    }
+    cache.End();
+    const GLRecorder sorted = g_gl;
+
+    std::printf("[RenderStateTest] %zu draws: state calls %zu -> %zu, flushes %zu -> %zu, shader binds %zu -> %zu "
+                "(cache stateChanges=%u)\n",
+                passCount, legacy.stateCalls, sorted.stateCalls, legacy.flushes, sorted.flushes, legacy.shaderBinds,
+                sorted.shaderBinds, cache.GetStats().stateChanges);
+
+    Check(legacyOk, "legacy path draws every pass with its required state");
+    Check(sortedOk, "sorted path draws every pass with its required state");
+    Check(commands.size() == passCount, "every pass becomes one draw command");
+    Check(opaqueFirst, "order-dependent passes sort after all opaque passes");
+    Check(DefaultState() && g_gl.program == 0, "RenderStateCache::End restores the default state");
+    Check(sorted.stateCalls * 10 < legacy.stateCalls, "sorted path issues at least 10x fewer state calls");
+    Check(sorted.flushes == 1, "sorted path flushes the batch once");
+    Check(sorted.shaderBinds < legacy.shaderBinds, "sorted path binds shaders less often");
+    return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,140 @@
+// 物理阶段分批检查:
+// 1. 内置阶段按声明的读写集分批, GravityStage 与 SolarStage 落在同一批
+// 2. 同一场景分别用串行与并行调度推进若干步, 刚体位置逐位一致
+//    (延迟写总在批末按阶段顺序提交, 结果与 parallel 开关无关)
+// 3. 批内阶段嵌套调用 ParallelFor 时每个内层块恰好执行一次
+#include "Engine/Core/GameWorld.h"
+#include "Engine/Core/Components/Components.h"
+#include "Engine/Core/Jobs/JobSystem.h"
+#include "Engine/System/Physics/PhysicsSystem.h"
+#include "Engine/System/Physics/Scheduler/StageScheduler.h"
+#include "Engine/System/Physics/Stages/CollisionStage.h"
+#include "Engine/System/Physics/Stages/GravityStage.h"
+#include "Game/Systems/Physics/NetworkVerifyStage.h"
+#include "Game/Systems/Physics/SolarStage.h"
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    int g_failures = 0;
+
+    void Check(bool condition, const char *what)
+    {
+        std::printf("[StageSchedulerTest] %s: %s\n", condition ? "ok" : "FAILED", what);
+        if (!condition)
+            g_failures++;
+    }
+
+    // 与 SceneManager::ParsePhysics 相同的顺序: 场景 JSON 的键按字典序遍历
+    std::vector<std::unique_ptr<IPhysicsStage>> ShippedStages()
+    {
+        std::vector<std::unique_ptr<IPhysicsStage>> stages;
+        stages.push_back(std::make_unique<CollisionStage>());
+        stages.push_back(std::make_unique<GravityStage>());
+        stages.push_back(std::make_unique<NetworkVerifyStage>());
+        stages.push_back(std::make_unique<SolarStage>());
+        return stages;
+    }
+
+    void CheckWaves()
+    {
+        StageScheduler scheduler;
+
+        std::vector<std::unique_ptr<IPhysicsStage>> forceStages;
+        forceStages.push_back(std::make_unique<GravityStage>());
+        forceStages.push_back(std::make_unique<SolarStage>());
+        scheduler.Build(forceStages);
+        Check(scheduler.GetStats().waves == 1 && scheduler.GetStats().concurrentStages == 2,
+              "GravityStage + SolarStage share one wave");
+
+        scheduler.Build(ShippedStages());
+        // CollisionStage 写位置, 独占第一批; 其余三个阶段同批
+        Check(scheduler.GetStats().waves == 2 && scheduler.GetStats().concurrentStages == 3,
+              "Collision | Gravity + NetworkVerify + Solar");
+    }
+
+    std::vector<Vector3f> Simulate(bool parallel)
+    {
+        GameWorld world(HeadlessWorld{}, [](ScriptingFactory &, PhysicsStageFactory &, ParticleFactory &) {}, "");
+        PhysicsSystem &physics = world.GetPhysicsSystem();
+        physics.ConfigureScheduler(json{{"parallel", parallel}});
+        for (auto &stage : ShippedStages())
+            physics.AddStage(std::move(stage));
+
+        // 4x2x4 个方块, 相邻方块有轻微重叠, 底层贴近地面
+        std::vector<GameObject *> bodies;
+        for (int x = 0; x < 4; x++)
+        {
+            for (int y = 0; y < 2; y++)
+            {
+                for (int z = 0; z < 4; z++)
+                {
+                    GameObject &object = world.CreateGameObject();
+                    auto &tf = object.AddComponent<TransformComponent>();
+                    tf.SetLocalPosition(Vector3f(x * 0.95f, 0.6f + y * 0.95f, z * 0.95f));
+                    auto &rb = object.AddComponent<RigidbodyComponent>();
+                    rb.mass = 1.0f + (x + y + z) % 3;
+                    rb.elasticity = 0.3f;
+                    rb.colliderType = ColliderType::BOX;
+                    rb.SetHitbox(Vector3f(1.0f, 1.0f, 1.0f));
+                    object.SetActive(true);
+                    bodies.push_back(&object);
+                }
+            }
+        }
+
+        for (int step = 0; step < 120; step++)
+            world.FixedUpdate(1.0f / 60.0f);
+
+        std::vector<Vector3f> positions;
+        for (auto *object : bodies)
+            positions.push_back(object->GetComponent<TransformComponent>().GetWorldPosition());
+        return positions;
+    }
+
+    void CheckDeterminism()
+    {
+        std::vector<Vector3f> serial = Simulate(false);
+        std::vector<Vector3f> parallel = Simulate(true);
+        bool identical = serial.size() == parallel.size();
+        for (size_t i = 0; identical && i < serial.size(); i++)
+            identical = std::memcmp(&serial[i], &parallel[i], sizeof(Vector3f)) == 0;
+        Check(identical, "serial and parallel scheduling give bitwise identical positions");
+    }
+
+    void CheckNestedParallelFor()
+    {
+        // 显式指定工作线程数, 单核机器上同样走多线程路径
+        JobSystem jobs(3);
+        constexpr size_t kOuter = 4;
+        constexpr size_t kInner = 1000;
+        std::vector<std::atomic<int>> visits(kOuter * kInner);
+        jobs.ParallelFor(kOuter, 1, [&](size_t begin, size_t end)
+                         {
+                             for (size_t outer = begin; outer < end; outer++)
+                             {
+                                 jobs.ParallelFor(kInner, 64, [&](size_t innerBegin, size_t innerEnd)
+                                                  {
+                                                      for (size_t i = innerBegin; i < innerEnd; i++)
+                                                          visits[outer * kInner + i]++;
+                                                  });
+                             }
+                         });
+        bool once = true;
+        for (auto &count : visits)
+            once &= count.load() == 1;
+        Check(once, "nested ParallelFor runs every inner chunk exactly once");
+    }
+}
+
+int main()
+{
+    CheckWaves();
+    CheckDeterminism();
+    CheckNestedParallelFor();
+    return g_failures == 0 ? 0 : 1;
+}